@@ -0,0 +1,152 @@
+"""ESP32紧凑二进制命令协议（bin1）
+
+帧格式与固件 astrbot_plugin_esp32/src/binary_protocol.h 保持一致，两边必须同步修改。
+无法映射为二进制命令的消息（如astrbot_message）返回None，由调用方改用JSON发送。
+"""
+import struct
+from typing import Optional
+
+ENCODING_NAME = "bin1"
+MAGIC = 0xA5
+VERSION = 1
+
+# magic, version, action, profile, brightness, flags, left_angle, right_angle, duration_ms
+HEADER = struct.Struct("<BBBBBBhhI")
+# flags含FLAG_T0时帧头后跟4字节t0（发送时刻，微秒），设备执行后回传latency消息
+FLAG_T0 = 0x01
+T0 = struct.Struct("<I")
+# flags含FLAG_SEQ时（t0之后）跟4字节命令序号，设备以ack消息回执该序号
+FLAG_SEQ = 0x02
+SEQ = struct.Struct("<I")
+# flags含FLAG_WALK时（seq之后）跟连续步行参数：周期数、步速百分比、选项（WALK_BACKWARD、WALK_UNTIL_STOP）
+FLAG_WALK = 0x04
+WALK = struct.Struct("<HBB")
+WALK_BACKWARD = 0x01
+WALK_UNTIL_STOP = 0x02
+TEXT_MAX_BYTES = 255
+# 亮度字节的特殊值：保持设备当前亮度。自定义命令led_on在JSON路径上不改变亮度，bin1必须编码为它
+BRIGHTNESS_KEEP = 0xFF
+
+# 操作码即固件中CommandAction的数值
+ACTION_CODES = {
+    ("led_control", "on"): 0,
+    ("led_control", "off"): 1,
+    ("led_control", "toggle"): 2,
+    ("led_control", "status"): 3,
+    ("servo_control", "walk_forward"): 4,
+    ("servo_control", "walk_backward"): 5,
+    ("servo_control", "stand_up"): 6,
+    ("servo_control", "stop"): 7,
+    ("servo_control", "left_forward"): 8,
+    ("servo_control", "left_backward"): 9,
+    ("servo_control", "right_forward"): 10,
+    ("servo_control", "right_backward"): 11,
+    ("servo_control", "move_legs"): 12,
+    ("servo_control", "move_left"): 13,
+    ("servo_control", "move_right"): 14,
+    ("servo_control", "status"): 15,
+    ("oled_control", "emotion"): 16,
+    ("oled_control", "text"): 17,
+    ("oled_control", "clear"): 18,
+    ("custom_command", "status"): 19,
+    ("custom_command", "restart"): 20,
+    ("custom_command", "led_on"): 0,
+    ("custom_command", "led_off"): 1,
+    ("oled_control", "page"): 21,
+    ("oled_control", "scroll"): 22,
+    ("servo_control", "walk"): 23,
+}
+
+WALK_CODE = 23
+
+PROFILE_CODES = {"linear": 1, "cubic": 2, "min_jerk": 3}
+
+
+def _clamp(value, low, high):
+    return max(low, min(high, int(value)))
+
+
+def _trim_utf8(text: str, limit: int) -> bytes:
+    """按字节截断文本，不留下半个UTF-8字符"""
+    data = text.encode("utf-8")
+    if len(data) <= limit:
+        return data
+    return data[:limit].decode("utf-8", errors="ignore").encode("utf-8")
+
+
+def encode_command(message: dict) -> Optional[bytes]:
+    """把JSON命令编码为二进制帧，不支持的消息返回None"""
+    message_type = message.get("type")
+    key = message.get("command") if message_type == "custom_command" else message.get("action")
+    code = ACTION_CODES.get((message_type, key))
+    if code is None:
+        return None
+
+    # 与固件的JSON路径一致：led_control不给亮度时为100%，自定义命令忽略亮度字段，只开灯不改亮度
+    if message_type == "custom_command":
+        brightness = BRIGHTNESS_KEEP
+    else:
+        brightness = _clamp(message.get("brightness", 100), 0, 100)
+    t0 = message.get("t0")
+    seq = message.get("seq")
+    flags = (FLAG_T0 if t0 else 0) | (FLAG_SEQ if seq else 0) | (FLAG_WALK if code == WALK_CODE else 0)
+    header = HEADER.pack(
+        MAGIC,
+        VERSION,
+        code,
+        PROFILE_CODES.get(message.get("profile", ""), 0),
+        brightness,
+        flags,
+        _clamp(message.get("left_angle", 90), 0, 180),
+        _clamp(message.get("right_angle", 90), 0, 180),
+        _clamp(message.get("duration_ms", 0), 0, 0xFFFFFFFF),
+    )
+    if t0:
+        header += T0.pack(int(t0) & 0xFFFFFFFF)
+    if seq:
+        header += SEQ.pack(int(seq) & 0xFFFFFFFF)
+    if code == WALK_CODE:
+        walk_flags = (WALK_BACKWARD if message.get("direction") == "backward" else 0) | \
+                     (WALK_UNTIL_STOP if message.get("until_stop") else 0)
+        header += WALK.pack(_clamp(message.get("steps", 0), 0, 0xFFFF), _clamp(message.get("tempo", 100), 1, 255), walk_flags)
+    return header + _trim_utf8(message.get("content", ""), TEXT_MAX_BYTES)
+
+
+def decode_command(frame: bytes) -> dict:
+    """解码二进制帧，用于调试和编码对比"""
+    if len(frame) < HEADER.size:
+        raise ValueError("帧长度不足")
+    magic, version, action, profile, brightness, flags, left_angle, right_angle, duration_ms = HEADER.unpack_from(frame)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("不支持的帧头")
+    offset = HEADER.size
+    t0 = 0
+    if flags & FLAG_T0:
+        (t0,) = T0.unpack_from(frame, offset)
+        offset += T0.size
+    seq = 0
+    if flags & FLAG_SEQ:
+        (seq,) = SEQ.unpack_from(frame, offset)
+        offset += SEQ.size
+    walk = {}
+    if flags & FLAG_WALK:
+        steps, tempo, walk_flags = WALK.unpack_from(frame, offset)
+        offset += WALK.size
+        walk = {
+            "steps": steps,
+            "tempo": tempo,
+            "direction": "backward" if walk_flags & WALK_BACKWARD else "forward",
+            "until_stop": bool(walk_flags & WALK_UNTIL_STOP),
+        }
+    return {
+        "action": action,
+        "profile": profile,
+        "brightness": None if brightness == BRIGHTNESS_KEEP else brightness,
+        "left_angle": left_angle,
+        "right_angle": right_angle,
+        "duration_ms": duration_ms,
+        "t0": t0,
+        "seq": seq,
+        "content": frame[offset:].decode("utf-8"),
+        **walk,
+    }
@@ -0,0 +1,37 @@
+"""命令延迟测量
+
+发送命令时附带t0（本机单调时钟，微秒，取低32位），设备执行后回传latency消息：
+    {"type": "latency", "t0": ..., "action": 操作码, "queue_us": ..., "exec_us": ...,
+     "output_us": ..., "hold_us": ...}
+output_us为设备收到命令到第一次硬件输出（舵机写入、LED PWM、OLED刷新）的时间，-1表示超时仍没有输出；
+hold_us为设备收到命令到发出该报告的时间。往返时间减去hold_us的一半作为单程网络延迟的估计。
+"""
+import time
+
+MASK = 0xFFFFFFFF
+
+
+def now_us() -> int:
+    return (time.monotonic_ns() // 1000) & MASK
+
+
+def stamp(message: dict) -> dict:
+    """返回附带t0的命令副本；t0为0表示不测量，因此跳过0"""
+    stamped = dict(message)
+    stamped["t0"] = now_us() or 1
+    return stamped
+
+
+def estimate(report: dict, received_us: int) -> dict:
+    """由设备回传的latency消息和本机收到它的时刻，估算从发送到硬件输出的端到端延迟"""
+    rtt = (received_us - report["t0"]) & MASK
+    one_way = max(0, (rtt - report.get("hold_us", 0)) // 2)
+    output = report.get("output_us", -1)
+    return {
+        "rtt_us": rtt,
+        "network_us": one_way,
+        "queue_us": report.get("queue_us", 0),
+        "exec_us": report.get("exec_us", 0),
+        "output_us": output,
+        "e2e_us": one_way + output if output >= 0 else None,
+    }
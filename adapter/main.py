@@ -9,6 +9,11 @@ from astrbot.api.star import Context, Star, register
 from astrbot.api import logger
 import astrbot.api.message_components as Comp
 
+from .binary_protocol import ENCODING_NAME as BINARY_ENCODING, encode_command
+from . import latency
+from . import metrics
+from . import pipeline
+
 
 @register("esp32s3_controller", "Jason.Joestar", "ESP32S3 WebSocket控制器插件", "1.0.0", "https://github.com/advent259141/astrbot_plugin_ESP32adapter")
 class ESP32S3Plugin(Star):
@@ -16,6 +21,14 @@ class ESP32S3Plugin(Star):
         super().__init__(context)
         self.websocket_server = None
         self.connected_clients: Set[WebSocketServerProtocol] = set()
+        # 在connected状态中声明支持二进制编码的设备，命令改用二进制帧发送
+        self.binary_clients: Set[WebSocketServerProtocol] = set()
+        # 分帧回传的运行指标报告，收齐后交给等待中的/esp32_metrics指令
+        self.metrics_collector = metrics.MetricsCollector()
+        self.metrics_waiters: list = []
+        # 在connected状态中声明会回执命令序号的设备；没有这样的设备时命令退回为发出即算成功
+        self.ack_clients: Set[WebSocketServerProtocol] = set()
+        self.pipeline = pipeline.CommandPipeline(window=4, timeout=5)
         self.server_host = "0.0.0.0"
         self.server_port = 8765
         
@@ -46,6 +59,7 @@ class ESP32S3Plugin(Star):
             welcome_msg = {
                 "type": "welcome",
                 "message": "欢迎连接到AstrBot ESP32S3控制器",
+                "encodings": ["json", BINARY_ENCODING],
                 "timestamp": asyncio.get_event_loop().time()
             }
             await websocket.send(json.dumps(welcome_msg))
@@ -66,6 +80,10 @@ class ESP32S3Plugin(Star):
             logger.error(f"WebSocket连接处理错误: {e}")        
         finally:
             self.connected_clients.discard(websocket)
+            self.binary_clients.discard(websocket)
+            self.ack_clients.discard(websocket)
+            if not self.ack_clients:
+                self.pipeline.fail_all("disconnected")
     
     async def handle_esp32_message(self, websocket: WebSocketServerProtocol, data: dict):
         """处理来自ESP32的消息"""
@@ -79,6 +97,37 @@ class ESP32S3Plugin(Star):
             status = data.get("status", "unknown")
             logger.info(f"ESP32状态更新: {status}")
             
+            if status == "connected":
+                # 设备每次连接都会重新声明编码能力，旧固件没有该字段时继续使用JSON
+                if BINARY_ENCODING in data.get("encodings", []):
+                    self.binary_clients.add(websocket)
+                    logger.info(f"ESP32设备支持二进制命令编码: {client_addr}")
+                else:
+                    self.binary_clients.discard(websocket)
+                if data.get("acks"):
+                    self.ack_clients.add(websocket)
+                else:
+                    self.ack_clients.discard(websocket)
+            
+        elif message_type == "ack":
+            # 带序号命令的接收/完成/拒绝回执，见pipeline.py
+            if not self.pipeline.on_ack(data):
+                logger.debug(f"收到已过期命令的回执: {data}")
+            
+        elif message_type == "latency":
+            # 命令从发送到设备实际输出的耗时，见latency.py
+            result = latency.estimate(data, latency.now_us())
+            logger.debug(f"ESP32命令延迟 (操作码{data.get('action')}): {result}")
+            
+        elif message_type == "metrics":
+            report = self.metrics_collector.add(data.get("device_id", client_addr), data)
+            if report is not None:
+                logger.info(f"ESP32运行指标 ({client_addr}):\n{metrics.format_report(report)}")
+                waiters, self.metrics_waiters = self.metrics_waiters, []
+                for waiter in waiters:
+                    if not waiter.done():
+                        waiter.set_result(report)
+            
         elif message_type == "heartbeat":
             # 处理心跳消息
             response = {
@@ -96,12 +145,19 @@ class ESP32S3Plugin(Star):
             logger.warning("没有连接的ESP32设备")
             return False
         
+        # 附带发送时刻，设备执行后回传latency消息
+        message = latency.stamp(message)
         message_json = json.dumps(message)
+        # 能映射为二进制命令的消息只编码一次，其余消息仍以JSON发送
+        message_binary = encode_command(message) if self.binary_clients else None
         disconnected_clients = set()
         
         for client in self.connected_clients:
             try:
-                await client.send(message_json)
+                if message_binary is not None and client in self.binary_clients:
+                    await client.send(message_binary)
+                else:
+                    await client.send(message_json)
             except websockets.exceptions.ConnectionClosed:
                 disconnected_clients.add(client)
             except Exception as e:
@@ -110,10 +166,49 @@ class ESP32S3Plugin(Star):
         
         # 清理断开的连接
         self.connected_clients -= disconnected_clients
+        self.binary_clients -= disconnected_clients
+        self.ack_clients -= disconnected_clients
         
         successful_sends = len(self.connected_clients) - len(disconnected_clients)
         return successful_sends > 0
 
+    async def send_command(self, message: dict, wait: bool = True, stage: str = pipeline.COMPLETED) -> dict:
+        """发送一条控制命令，返回设备的回执
+        
+        stage为等待的阶段：completed等到执行完毕（舵机动作为动作结束），accepted只等到设备接收
+        （舵机动作为started/queued）。wait为False时只等到命令进入在途窗口就返回（state为pending），
+        之后可用wait_esp32_commands等待；没有支持回执的设备时退回为发出即返回，state为sent或failed
+        """
+        if not self.ack_clients:
+            success = await self.send_to_esp32(message)
+            return {"state": "sent" if success else "failed"}
+        
+        entry = await self.pipeline.submit(self.send_to_esp32, message, stage)
+        if entry is None:
+            return {"state": "failed"}
+        if not wait:
+            return {"state": "pending", "seq": entry.seq}
+        return await entry.wait()
+
+    @staticmethod
+    def describe_ack(ack: dict, success_text: str, failure_text: str) -> str:
+        """把回执转换为返回给LLM的文本"""
+        state = ack.get("state")
+        status = ack.get("status")
+        if state == "completed" and ack.get("reason"):
+            # 舵机动作被新目标替换、被停止命令打断或在排队时被取消
+            return f"动作没有完整执行：{status or ack['reason']}"
+        if state in ("completed", "sent", "started", "queued"):
+            return f"{success_text}（{status}）" if status else success_text
+        if state == "pending":
+            return f"命令已发出（序号{ack['seq']}），设备正在执行，可调用wait_esp32_commands等待结果"
+        if state == "rejected":
+            return f"设备拒绝执行：{status or ack.get('reason', '未知原因')}"
+        if state == "timeout":
+            reason = "设备已断开连接" if ack.get("reason") == "disconnected" else "等待设备回执超时"
+            return f"{reason}，命令可能没有执行"
+        return failure_text
+
     @filter.event_message_type(filter.EventMessageType.PRIVATE_MESSAGE)
     async def on_all_message(self, event: AstrMessageEvent):
         """监听所有消息并转发给ESP32设备"""
@@ -214,14 +309,54 @@ class ESP32S3Plugin(Star):
             client_addr = f"{client.remote_address[0]}:{client.remote_address[1]}"
             status_info.append(f"  设备{i}: {client_addr}")
         
-        yield event.plain_result("\n".join(status_info))    
+        yield event.plain_result("\n".join(status_info))
+
+    @filter.command("esp32_metrics")
+    async def esp32_metrics_command(self, event: AstrMessageEvent, reset: str = ""):
+        """查看ESP32设备各处理阶段的耗时分布和堆内存水位，参数reset表示查看后清空"""
+        if not self.connected_clients:
+            yield event.plain_result("❌ 没有ESP32设备连接")
+            return
+        
+        waiter = asyncio.get_event_loop().create_future()
+        self.metrics_waiters.append(waiter)
+        await self.send_to_esp32({"type": "metrics", "reset": reset == "reset"})
+        try:
+            report = await asyncio.wait_for(waiter, timeout=5)
+        except asyncio.TimeoutError:
+            yield event.plain_result("❌ 等待ESP32运行指标超时")
+            return
+        yield event.plain_result(f"📊 ESP32运行指标:\n{metrics.format_report(report)}")
+    
+    @filter.command("esp32_servo_calibrate")
+    async def esp32_servo_calibrate_command(self, event: AstrMessageEvent, channel: str, angle: str = "", pulse_us: str = ""):
+        """查看或修改舵机校准表：/esp32_servo_calibrate left|right [角度 脉宽微秒 | reset]"""
+        if not self.connected_clients:
+            yield event.plain_result("❌ 没有ESP32设备连接")
+            return
+        
+        message = {"type": "servo_calibrate", "channel": channel.lower()}
+        if angle == "reset":
+            message["reset"] = True
+        elif angle:
+            if not (angle.isdigit() and pulse_us.isdigit()):
+                yield event.plain_result("❌ 用法: /esp32_servo_calibrate left|right [角度 脉宽微秒 | reset]")
+                return
+            message["angle"] = int(angle)
+            message["pulse_us"] = int(pulse_us)
+        
+        # 校准结果和校准表随完成回执返回；设备不支持回执时只能发出
+        ack = await self.send_command(message)
+        yield event.plain_result(self.describe_ack(ack, "✅ 校准命令已发送", "❌ 发送校准命令失败"))
+    
     @filter.llm_tool(name="control_esp32_led")
-    async def control_esp32_led(self, event: AstrMessageEvent, action: str, brightness: int = 100):
+    async def control_esp32_led(self, event: AstrMessageEvent, action: str, brightness: int = 100, wait: bool = True):
         '''控制ESP32设备的LED灯开关和亮度。
 
         Args:
             action(string): 操作类型，可选值：on（开灯）、off（关灯）、toggle（切换状态）
             brightness(number): LED亮度，范围0-100，默认100
+            wait(boolean): 是否等待设备执行完毕再返回，默认true；连续下发多条命令时可设为false，最后调用wait_esp32_commands统一等待
         '''
         if not self.connected_clients:
             return "没有ESP32设备连接，无法执行LED控制操作"
@@ -244,37 +379,33 @@ class ESP32S3Plugin(Star):
                 "timestamp": asyncio.get_event_loop().time()
             }
             
-            # 发送控制命令到ESP32设备
-            success = await self.send_to_esp32(control_message)
-            
-            if success:
-                # 返回成功信息给LLM
-                action_results = {
-                    "on": f"成功开启LED灯，亮度设置为{brightness}%",
-                    "off": "成功关闭LED灯",
-                    "toggle": f"成功切换LED灯状态，亮度设置为{brightness}%"
-                }
-                return action_results[action.lower()]
-            else:
-                return "发送LED控制指令失败，请检查ESP32设备连接状态"
+            # 发送控制命令到ESP32设备，按设备回执返回结果给LLM
+            ack = await self.send_command(control_message, wait)
+            action_results = {
+                "on": f"成功开启LED灯，亮度设置为{brightness}%",
+                "off": "成功关闭LED灯",
+                "toggle": f"成功切换LED灯状态，亮度设置为{brightness}%"
+            }
+            return self.describe_ack(ack, action_results[action.lower()], "发送LED控制指令失败，请检查ESP32设备连接状态")
                 
         except Exception as e:
             logger.error(f"控制ESP32 LED灯失败: {e}")
             return f"LED控制操作发生错误: {str(e)}"
         
     @filter.llm_tool(name="control_esp32_oled")
-    async def control_esp32_oled(self, event: AstrMessageEvent, action: str, content: str = ""):
+    async def control_esp32_oled(self, event: AstrMessageEvent, action: str, content: str = "", wait: bool = True):
         '''控制ESP32设备的OLED屏幕显示内容。
 
         Args:
-            action(string): 操作类型，可选值：emotion（显示表情）、text（显示文本）、clear（清除屏幕）
-            content(string): 显示内容。当action为emotion时，支持的表情：happy/开心、sad/伤心、angry/生气、surprised/惊讶、sleepy/困、love/爱心、cool/酷、thinking/思考；当action为text时，为要显示的文本内容
+            action(string): 操作类型，可选值：emotion（显示表情）、text（显示文本）、clear（清除屏幕）、page（长文本翻页）、scroll（设置长文本自动滚动速度）
+            content(string): 显示内容。当action为emotion时，支持的表情：happy/开心、sad/伤心、angry/生气、surprised/惊讶、sleepy/困、love/爱心、cool/酷、thinking/思考；当action为text时，为要显示的文本内容；当action为page时，为next（下一页）或prev（上一页）；当action为scroll时，为滚动速度（像素/秒），0表示停止自动滚动
+            wait(boolean): 是否等待设备执行完毕再返回，默认true；连续下发多条命令时可设为false，最后调用wait_esp32_commands统一等待
         '''
         if not self.connected_clients:
             return "没有ESP32设备连接，无法执行OLED控制操作"
         
         # 验证参数
-        valid_actions = ["emotion", "text", "clear"]
+        valid_actions = ["emotion", "text", "clear", "page", "scroll"]
         if action.lower() not in valid_actions:
             return f"无效的操作类型'{action}'，支持的操作：{', '.join(valid_actions)}"
         
@@ -293,6 +424,15 @@ class ESP32S3Plugin(Star):
             if content.lower() not in valid_emotions:
                 return f"不支持的表情'{content}'，支持的表情：{', '.join(valid_emotions)}"
         
+        if action.lower() == "page":
+            content = content.lower() or "next"
+            if content not in ["next", "prev"]:
+                return f"无效的翻页方向'{content}'，支持：next、prev"
+        
+        if action.lower() == "scroll":
+            if not content.isdigit():
+                return f"滚动速度必须是非负整数（像素/秒），当前值：{content}"
+        
         try:
             # 构造控制命令
             control_message = {
@@ -303,72 +443,142 @@ class ESP32S3Plugin(Star):
                 "timestamp": asyncio.get_event_loop().time()
             }
             
-            # 发送控制命令到ESP32设备
-            success = await self.send_to_esp32(control_message)
-            
-            if success:                # 返回成功信息给LLM
-                if action.lower() == "emotion":
-                    return f"成功在OLED屏幕上显示{content}表情"
-                elif action.lower() == "text":
-                    return f"成功在OLED屏幕上显示文本：{content}"
-                elif action.lower() == "clear":
-                    return "成功清除OLED屏幕内容"
+            # 发送控制命令到ESP32设备，按设备回执返回结果给LLM
+            ack = await self.send_command(control_message, wait)
+            if action.lower() == "emotion":
+                success_text = f"成功在OLED屏幕上显示{content}表情"
+            elif action.lower() == "text":
+                success_text = f"成功在OLED屏幕上显示文本：{content}"
+            elif action.lower() == "clear":
+                success_text = "成功清除OLED屏幕内容"
+            elif action.lower() == "page":
+                success_text = "成功翻到下一页" if content == "next" else "成功翻到上一页"
             else:
-                return "发送OLED控制指令失败，请检查ESP32设备连接状态"
+                success_text = f"成功将自动滚动速度设置为{content}像素/秒" if content != "0" else "成功关闭自动滚动"
+            return self.describe_ack(ack, success_text, "发送OLED控制指令失败，请检查ESP32设备连接状态")
         except Exception as e:
             logger.error(f"控制ESP32 OLED屏幕失败: {e}")
             return f"OLED控制操作发生错误: {str(e)}"    
     @filter.llm_tool(name="control_esp32_servo")
-    async def control_esp32_servo(self, event: AstrMessageEvent, action: str, angle: str = "90"):
-        '''控制ESP32设备的SG90舵机旋转角度。
+    async def control_esp32_servo(self, event: AstrMessageEvent, action: str, left_angle: int = 90, right_angle: int = 90, duration_ms: int = 0, wait: bool = True):
+        '''控制ESP32双足机器人的两条腿（SG90舵机）。
 
         Args:
-            action(string): 操作类型，可选值：rotate（旋转到指定角度）、center（回到中位90度）、sweep（扫描模式，左右摆动）
-            angle(string): 目标角度，范围0-180度，默认"90"（仅在action为rotate时有效）
+            action(string): 操作类型，可选值：walk_forward（前进）、walk_backward（后退）、stand_up（站立）、stop（停止）、left_forward/left_backward/right_forward/right_backward（单腿前后摆）、move_legs（两腿转到指定角度）
+            left_angle(number): 左腿目标角度，范围0-180度，默认90（仅在action为move_legs时有效）
+            right_angle(number): 右腿目标角度，范围0-180度，默认90（仅在action为move_legs时有效）
+            duration_ms(number): 转到目标角度的时长（毫秒），0表示直接跳转（仅在action为move_legs时有效）
+            wait(boolean): 是否等待设备执行完毕再返回，默认true；连续下发多条命令时可设为false，最后调用wait_esp32_commands统一等待
         '''
         if not self.connected_clients:
             return "没有ESP32设备连接，无法执行舵机控制操作"
         
         # 验证参数
-        valid_actions = ["rotate", "center", "sweep"]
-        if action.lower() not in valid_actions:
-            return f"无效的操作类型'{action}'，支持的操作：{', '.join(valid_actions)}"
+        action_results = {
+            "walk_forward": "成功开始前进",
+            "walk_backward": "成功开始后退",
+            "stand_up": "成功回到站立姿势",
+            "stop": "成功停止行走",
+            "left_forward": "成功将左腿向前摆",
+            "left_backward": "成功将左腿向后摆",
+            "right_forward": "成功将右腿向前摆",
+            "right_backward": "成功将右腿向后摆",
+            "move_legs": f"成功将左腿转到{left_angle}度、右腿转到{right_angle}度"
+        }
+        if action.lower() not in action_results:
+            return f"无效的操作类型'{action}'，支持的操作：{', '.join(action_results)}"
         
-        # 将角度字符串转换为整数并验证范围
-        try:
-            angle_int = int(angle)
-        except ValueError:
-            return f"角度必须是数字，当前值：{angle}"
-        if angle_int < 0 or angle_int > 180:
-            return f"角度必须在0-180度范围内，当前值：{angle_int}度"
+        for name, value in (("左腿", left_angle), ("右腿", right_angle)):
+            if not 0 <= value <= 180:
+                return f"{name}角度必须在0-180度范围内，当前值：{value}度"
+        if duration_ms < 0:
+            return f"时长不能为负数，当前值：{duration_ms}毫秒"
         
         try:
             # 构造控制命令
             control_message = {
                 "type": "servo_control",
                 "action": action.lower(),
-                "angle": angle_int,
+                "left_angle": left_angle,
+                "right_angle": right_angle,
+                "duration_ms": duration_ms,
                 "from_user": event.get_sender_name(),
                 "timestamp": asyncio.get_event_loop().time()
             }
             
-            # 发送控制命令到ESP32设备
-            success = await self.send_to_esp32(control_message)
-            
-            if success:
-                # 返回成功信息给LLM
-                action_results = {
-                    "rotate": f"成功将舵机旋转到{angle_int}度",
-                    "center": "成功将舵机回到中位（90度）",
-                    "sweep": "成功执行舵机扫描模式（左右摆动）"
-                }
-                return action_results[action.lower()]
-            else:
-                return "发送舵机控制指令失败，请检查ESP32设备连接状态"
+            # 发送控制命令到ESP32设备，按设备回执返回结果给LLM
+            ack = await self.send_command(control_message, wait)
+            return self.describe_ack(ack, action_results[action.lower()], "发送舵机控制指令失败，请检查ESP32设备连接状态")
         except Exception as e:
             logger.error(f"控制ESP32舵机失败: {e}")
             return f"舵机控制操作发生错误: {str(e)}"
     
+    @filter.llm_tool(name="walk_esp32_robot")
+    async def walk_esp32_robot(self, event: AstrMessageEvent, direction: str = "forward", steps: int = 0, duration_ms: int = 0, until_stop: bool = False, tempo: int = 100, wait: bool = True):
+        '''让ESP32双足机器人连续行走，一条命令走完多个步态周期，周期之间不回中心。
+
+        Args:
+            direction(string): 行走方向，可选值：forward（前进）、backward（后退），默认forward
+            steps(number): 走几个步态周期；与duration_ms、until_stop三选一，都不给时走一个周期
+            duration_ms(number): 行走总时长（毫秒），走满后在当前周期结束时停下
+            until_stop(boolean): 为true时一直走，直到调用control_esp32_servo的stop或有其他动作排队
+            tempo(number): 步速百分比，范围1-255，默认100为标准步速，200为两倍速
+            wait(boolean): 是否等待走完再返回，默认true；until_stop为true时只等到开始行走
+        '''
+        if not self.connected_clients:
+            return "没有ESP32设备连接，无法执行行走操作"
+        
+        # 验证参数
+        if direction.lower() not in ["forward", "backward"]:
+            return f"无效的行走方向'{direction}'，支持：forward、backward"
+        if not 0 <= steps <= 65535:
+            return f"步态周期数必须在0-65535之间，当前值：{steps}"
+        if duration_ms < 0:
+            return f"时长不能为负数，当前值：{duration_ms}毫秒"
+        if not 1 <= tempo <= 255:
+            return f"步速必须在1-255之间，当前值：{tempo}"
+        
+        try:
+            # 构造控制命令
+            control_message = {
+                "type": "servo_control",
+                "action": "walk",
+                "direction": direction.lower(),
+                "steps": steps,
+                "duration_ms": duration_ms,
+                "until_stop": until_stop,
+                "tempo": tempo,
+                "from_user": event.get_sender_name(),
+                "timestamp": asyncio.get_event_loop().time()
+            }
+            
+            # 发送控制命令到ESP32设备，按设备回执返回结果给LLM；一直走的命令要等停止后才完成，只等到开始
+            stage = pipeline.ACCEPTED if until_stop else pipeline.COMPLETED
+            ack = await self.send_command(control_message, wait, stage)
+            name = "前进" if direction.lower() == "forward" else "后退"
+            if until_stop:
+                success_text = f"机器人开始持续{name}，需要停下时调用control_esp32_servo的stop"
+            elif steps or not duration_ms:
+                success_text = f"机器人开始{name}{steps or 1}个步态周期"
+            else:
+                success_text = f"机器人开始{name}{duration_ms}毫秒"
+            return self.describe_ack(ack, success_text, "发送行走指令失败，请检查ESP32设备连接状态")
+        except Exception as e:
+            logger.error(f"控制ESP32行走失败: {e}")
+            return f"行走操作发生错误: {str(e)}"
+    
+    @filter.llm_tool(name="wait_esp32_commands")
+    async def wait_esp32_commands(self, event: AstrMessageEvent):
+        '''等待之前以wait=false下发的ESP32控制命令全部执行完毕，返回每条命令的结果。
+        '''
+        if not self.pipeline.in_flight():
+            return "没有正在执行的命令"
+        
+        results = []
+        for ack in await self.pipeline.drain():
+            results.append(f"命令{ack.get('seq')}: {self.describe_ack(ack, '执行完成', '执行失败')}")
+        return "\n".join(results)
+    
     async def terminate(self):
         """插件卸载时的清理工作"""
         logger.info("正在关闭ESP32S3 WebSocket服务器...")
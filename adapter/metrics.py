@@ -0,0 +1,91 @@
+"""设备运行指标
+
+向设备发送 {"type": "metrics", "reset": false} 请求一份报告（reset为true时发完后清空直方图）。
+报告分多帧回传，同一份报告的各帧带相同的report编号，parts为总帧数：
+    {"type": "metrics", "report": 3, "parts": 8, "part": "heap", "free": ..., "min_free": ...,
+     "max_alloc": ..., "min_max_alloc": ..., "arena": ..., "arena_peak": ..., "arena_overflows": ...,
+     "servo_writes": ..., "servo_suppressed": ..., "servo_slew_limited": ..., "dropped_frames": ...}
+    {"type": "metrics", "report": 3, "parts": 8, "part": "stage", "stage": "parse",
+     "count": ..., "max_us": ..., "hist": [...]}
+hist为对数直方图，第0个元素为0微秒，第i个元素为[2^(i-1), 2^i)微秒，末尾的空桶已省略。
+"""
+import math
+
+
+def bucket_upper_us(index: int) -> int:
+    """第index个桶的上界（不含），用作该桶内样本的保守估计"""
+    return 1 if index == 0 else 1 << index
+
+
+def percentile_us(hist: list, fraction: float, max_us: int):
+    """由直方图估算百分位数，结果不超过记录到的最大值"""
+    total = sum(hist)
+    if total == 0:
+        return None
+    rank = max(1, math.ceil(total * fraction))
+    seen = 0
+    for index, count in enumerate(hist):
+        seen += count
+        if seen >= rank:
+            return min(bucket_upper_us(index), max_us)
+    return max_us
+
+
+class MetricsCollector:
+    """按report编号拼合分帧的报告，收齐后返回整理好的结果"""
+
+    def __init__(self):
+        self.partial = {}
+
+    def add(self, device_id: str, frame: dict):
+        key = (device_id, frame.get("report"))
+        parts = self.partial.setdefault(key, [])
+        parts.append(frame)
+        if len(parts) < frame.get("parts", 0):
+            return None
+        del self.partial[key]
+        # 同一设备更早的未收齐报告已被新请求覆盖，不会再收到剩余部分
+        for stale in [k for k in self.partial if k[0] == device_id and k[1] < frame.get("report")]:
+            del self.partial[stale]
+        return summarize(parts)
+
+
+def summarize(parts: list) -> dict:
+    report = {"heap": {}, "stages": {}}
+    for part in parts:
+        if part.get("part") == "heap":
+            report["heap"] = {key: part[key] for key in
+                              ("free", "min_free", "max_alloc", "min_max_alloc", "arena", "arena_peak",
+                               "arena_overflows", "dropped_frames", "servo_writes", "servo_suppressed",
+                               "servo_slew_limited") if key in part}
+        elif part.get("part") == "stage":
+            hist = part.get("hist", [])
+            max_us = part.get("max_us", 0)
+            report["stages"][part["stage"]] = {
+                "count": part.get("count", 0),
+                "p50_us": percentile_us(hist, 0.50, max_us),
+                "p99_us": percentile_us(hist, 0.99, max_us),
+                "max_us": max_us,
+                "hist": hist,
+            }
+    return report
+
+
+def format_report(report: dict) -> str:
+    heap = report["heap"]
+    lines = [
+        f"堆内存: 空闲{heap.get('free', 0)}字节（最低{heap.get('min_free', 0)}），"
+        f"最大可分配块{heap.get('max_alloc', 0)}字节（最低{heap.get('min_max_alloc', 0)}）",
+        f"消息内存池: 峰值{heap.get('arena_peak', 0)}/{heap.get('arena', 0)}字节，"
+        f"超出容量被拒绝{heap.get('arena_overflows', 0)}条",
+        f"丢弃的出站帧: {heap.get('dropped_frames', 0)}",
+        f"舵机写入: {heap.get('servo_writes', 0)}次，省去重复写入{heap.get('servo_suppressed', 0)}次，"
+        f"限速{heap.get('servo_slew_limited', 0)}个控制周期",
+    ]
+    for stage, summary in report["stages"].items():
+        if summary["count"] == 0:
+            lines.append(f"{stage}: 无样本")
+            continue
+        lines.append(f"{stage}: {summary['count']}次 p50≤{summary['p50_us']}μs "
+                     f"p99≤{summary['p99_us']}μs 最大{summary['max_us']}μs")
+    return "\n".join(lines)
@@ -0,0 +1,130 @@
+"""带序号的命令流水线
+
+每条命令附带seq（1起递增，0表示不需要回执），设备依次回传ack消息：
+    {"type": "ack", "device_id": ..., "seq": ..., "state": "accepted" | "started" | "queued" | "completed" | "rejected",
+     "reason": 拒绝原因或动作没有正常完成的原因（可选）, "status": 设备的状态文本（可选）}
+accepted表示命令已进入设备的命令队列，completed表示执行完毕，rejected表示设备拒绝执行
+（reason为queue_full、motion_queue_full、unknown_action、unknown_command、unknown_channel或invalid_calibration）。
+舵机动作进入控制器时先回执started（已开始）或queued（排在当前动作之后），动作结束时再回执completed；
+动作被打断时completed的reason为superseded、preempted或cancelled。
+出站队列紧张时设备可能只发completed，因此completed同时视为accepted。
+
+同一时刻最多window条命令在途，窗口满时submit()等待最早的命令让出位置；命令结束或舵机动作已被控制器接收
+（started/queued）时让出窗口，超过timeout秒仍未到这一步的命令按超时处理。舵机动作可能持续很久，
+接收之后不再计时，直到completed或连接断开。连接多台设备时，第一台设备的回执即决定命令结果。
+"""
+import asyncio
+from typing import Awaitable, Callable, Dict, Optional
+
+MASK = 0xFFFFFFFF
+
+ACCEPTED = "accepted"
+STARTED = "started"
+QUEUED = "queued"
+COMPLETED = "completed"
+REJECTED = "rejected"
+TIMEOUT = "timeout"
+
+FINAL_STATES = (COMPLETED, REJECTED, TIMEOUT)
+
+
+class InFlight:
+    """一条在途命令；accepted和done两个future分别在设备接收和结束时得到回执字典"""
+
+    def __init__(self, seq: int, message: dict, loop: asyncio.AbstractEventLoop, stage: str = COMPLETED):
+        self.seq = seq
+        self.message = message
+        self.stage = stage  # drain()等待的阶段
+        self.accepted = loop.create_future()
+        self.done = loop.create_future()
+        self.expiry: Optional[asyncio.TimerHandle] = None
+        self.settled = False  # 已让出窗口
+
+    def resolve(self, ack: dict):
+        if not self.accepted.done():
+            self.accepted.set_result(ack)
+        if not self.done.done() and ack.get("state") in FINAL_STATES:
+            self.done.set_result(ack)
+
+    async def wait(self, stage: Optional[str] = None) -> dict:
+        """等到设备接收（stage为accepted，舵机动作为started/queued）或执行结束，返回回执；
+        超时的命令返回state为timeout的回执。不指定stage时按提交时给出的阶段等待"""
+        stage = stage or self.stage
+        return await asyncio.shield(self.accepted if stage == ACCEPTED else self.done)
+
+
+class CommandPipeline:
+    def __init__(self, window: int = 4, timeout: float = 5.0):
+        self.window = window
+        self.timeout = timeout
+        self.slots = asyncio.Semaphore(window)
+        self.pending: Dict[int, InFlight] = {}
+        self.next_seq = 1
+
+    def _allocate_seq(self) -> int:
+        seq = self.next_seq
+        self.next_seq = (self.next_seq % MASK) + 1
+        return seq
+
+    async def submit(self, send: Callable[[dict], Awaitable[bool]], message: dict,
+                     stage: str = COMPLETED) -> Optional[InFlight]:
+        """占用一个窗口位置，为命令分配seq后交给send发送；发送失败时释放位置并返回None
+        stage为wait()和drain()默认等待的阶段"""
+        await self.slots.acquire()
+        loop = asyncio.get_event_loop()
+        seq = self._allocate_seq()
+        entry = InFlight(seq, dict(message, seq=seq), loop, stage)
+        self.pending[seq] = entry
+        entry.done.add_done_callback(lambda _: self._release(seq))
+        entry.expiry = loop.call_later(self.timeout, self._expire, seq)
+        try:
+            sent = await send(entry.message)
+        except Exception:
+            self._expire(seq)
+            raise
+        if not sent:
+            self._expire(seq)
+            return None
+        return entry
+
+    def on_ack(self, ack: dict) -> bool:
+        """处理设备回传的ack消息，返回是否对应某条在途命令"""
+        entry = self.pending.get(ack.get("seq", 0))
+        if entry is None:
+            return False
+        entry.resolve(ack)
+        if ack.get("state") in (STARTED, QUEUED):
+            # 动作已交给控制器，窗口让给后续命令，等待completed不再计时
+            self._settle(entry)
+        return True
+
+    def in_flight(self) -> int:
+        return len(self.pending)
+
+    async def drain(self) -> list:
+        """等待当前所有在途命令到达各自的等待阶段，按seq顺序返回它们的回执"""
+        entries = sorted(self.pending.values(), key=lambda entry: entry.seq)
+        return [await entry.wait() for entry in entries]
+
+    def fail_all(self, reason: str):
+        """连接全部断开时结束所有在途命令"""
+        for seq in list(self.pending):
+            self._expire(seq, reason)
+
+    def _expire(self, seq: int, reason: str = TIMEOUT):
+        entry = self.pending.get(seq)
+        if entry is not None:
+            entry.resolve({"seq": seq, "state": TIMEOUT, "reason": reason})
+
+    def _settle(self, entry: InFlight):
+        if entry.settled:
+            return
+        entry.settled = True
+        if entry.expiry is not None:
+            entry.expiry.cancel()
+        self.slots.release()
+
+    def _release(self, seq: int):
+        entry = self.pending.pop(seq, None)
+        if entry is not None:
+            self._settle(entry)
@@ -0,0 +1,52 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+// 主机构建用的Adafruit GFX替身：图形函数逐行移植自原库（与tools/gen_emotion_bitmaps.py相同），
+// 像素结果与设备一致；主机上没有内置5x7字库，字符绘制为字符格大小的方框
+class Adafruit_GFX : public Print {
+protected:
+    int16_t _width, _height;
+    int16_t cursorX, cursorY;
+    uint16_t textColor, textBackground;
+    uint8_t textSizeX, textSizeY;
+    bool wrap;
+    
+    void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color);
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color);
+
+public:
+    Adafruit_GFX(int16_t w, int16_t h);
+    
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void fillScreen(uint16_t color);
+    
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+    
+    void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+    void setTextSize(uint8_t size) { textSizeX = textSizeY = size ? size : 1; }
+    void setTextColor(uint16_t color) { textColor = textBackground = color; }
+    void setTextColor(uint16_t color, uint16_t background) { textColor = color; textBackground = background; }
+    void setTextWrap(bool enabled) { wrap = enabled; }
+    int16_t getCursorX() const { return cursorX; }
+    int16_t getCursorY() const { return cursorY; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    
+    size_t write(uint8_t c) override;
+    using Print::write;
+};
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// 主机构建用的Arduino核心替身：在Linux进程中运行固件的setup()/loop()
+// 只实现固件实际用到的接口；FreeRTOS任务映射为线程，硬件输出记录到仿真轨迹（sim_trace.h）
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define LOW 0x0
+#define HIGH 0x1
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::abs;
+
+// ---- 时间 ----
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// ---- 数学与随机数 ----
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// ---- GPIO与LEDC PWM（写入会记录到仿真轨迹） ----
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+// ---- String ----
+class String {
+private:
+    std::string buffer;
+
+public:
+    String() {}
+    String(const char* text) : buffer(text ? text : "") {}
+    String(const std::string& text) : buffer(text) {}
+    explicit String(char c) : buffer(1, c) {}
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimals = 2);
+    explicit String(double value, unsigned char decimals = 2);
+    
+    const char* c_str() const { return buffer.c_str(); }
+    unsigned int length() const { return buffer.size(); }
+    bool isEmpty() const { return buffer.empty(); }
+    bool reserve(unsigned int size) { buffer.reserve(size); return true; }
+    char charAt(unsigned int index) const { return index < buffer.size() ? buffer[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return buffer[index]; }
+    
+    String& operator+=(const String& other) { buffer += other.buffer; return *this; }
+    String& operator+=(const char* other) { if (other) buffer += other; return *this; }
+    String& operator+=(char c) { buffer += c; return *this; }
+    String& operator+=(int value) { return *this += String(value); }
+    String& operator+=(unsigned int value) { return *this += String(value); }
+    String& operator+=(long value) { return *this += String(value); }
+    String& operator+=(unsigned long value) { return *this += String(value); }
+    bool concat(const String& other) { *this += other; return true; }
+    
+    bool equals(const String& other) const { return buffer == other.buffer; }
+    bool equalsIgnoreCase(const String& other) const;
+    bool operator==(const String& other) const { return buffer == other.buffer; }
+    bool operator==(const char* other) const { return buffer == (other ? other : ""); }
+    bool operator!=(const String& other) const { return !(*this == other); }
+    bool operator!=(const char* other) const { return !(*this == other); }
+    bool operator<(const String& other) const { return buffer < other.buffer; }
+    
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& text, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    bool startsWith(const String& prefix) const;
+    bool endsWith(const String& suffix) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+    void replace(const String& from, const String& to);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    long toInt() const { return atol(buffer.c_str()); }
+    float toFloat() const { return (float)atof(buffer.c_str()); }
+    
+    friend String operator+(const String& a, const String& b);
+};
+
+String operator+(const String& a, const String& b);
+inline String operator+(const String& a, const char* b) { return a + String(b); }
+inline String operator+(const char* a, const String& b) { return String(a) + b; }
+inline String operator+(const String& a, char b) { return a + String(b); }
+
+// ---- Print / Serial（输出到标准输出，多线程下按调用加锁） ----
+class Printable;
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t size);
+    size_t write(const char* text) { return text ? write((const uint8_t*)text, strlen(text)) : 0; }
+    
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text) { return write((const uint8_t*)text.c_str(), text.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return print(String(value)); }
+    size_t print(unsigned int value) { return print(String(value)); }
+    size_t print(long value) { return print(String(value)); }
+    size_t print(unsigned long value) { return print(String(value)); }
+    size_t print(double value, int decimals = 2) { return print(String(value, (unsigned char)decimals)); }
+    size_t print(const Printable& value);
+    
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    size_t println() { return write((const uint8_t*)"\n", 1); }
+    
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t size) override;
+    using Print::write;
+    int available() { return 0; }
+    int read() { return -1; }
+    int availableForWrite() { return 128; }
+    void flush();
+};
+
+extern HardwareSerial Serial;
+
+// ---- ESP ----
+class EspClass {
+public:
+    void restart();  // 主机上退出进程
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize();
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getCycleCount();
+};
+
+extern EspClass ESP;
+
+// ---- FreeRTOS：任务为线程，任务通知为计数信号量，1 tick = 1毫秒 ----
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+struct HostTask;
+struct HostMutex;
+typedef HostTask* TaskHandle_t;
+typedef HostMutex* SemaphoreHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR()
+#define ARDUINO_RUNNING_CORE 1
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(void (*task)(void*), const char* name, uint32_t stackDepth, void* param,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t period);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
+
+// 临界区：主机上为自旋锁
+typedef struct {
+    volatile int locked;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+void portENTER_CRITICAL(portMUX_TYPE* mux);
+void portEXIT_CRITICAL(portMUX_TYPE* mux);
+
+// ---- 硬件定时器：由独立线程按周期调用中断回调 ----
+struct hw_timer_t;
+hw_timer_t* timerBegin(uint8_t num, uint16_t divider, bool countUp);
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(), bool edge);
+void timerAlarmWrite(hw_timer_t* timer, uint64_t alarmValue, bool autoReload);
+void timerAlarmEnable(hw_timer_t* timer);
+void timerAlarmDisable(hw_timer_t* timer);
+void timerEnd(hw_timer_t* timer);
+
+// 固件入口，由host_main.cpp调用
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef HOST_ARDUINO_WEBSOCKETS_H
+#define HOST_ARDUINO_WEBSOCKETS_H
+
+#include <Arduino.h>
+#include <functional>
+#include <string>
+
+// 主机构建用的ArduinoWebsockets替身：基于POSIX套接字的最小WebSocket客户端（RFC 6455，仅ws://），
+// 接口与固件用到的部分一致。服务器地址默认改为本机（见ESP32_SIM_SERVER环境变量）
+namespace websockets {
+
+enum class WebsocketsEvent {
+    ConnectionOpened,
+    ConnectionClosed,
+    GotPing,
+    GotPong
+};
+
+enum class MessageType {
+    Empty,
+    Text,
+    Binary
+};
+
+class WebsocketsMessage {
+private:
+    MessageType type;
+    std::string payload;
+
+public:
+    WebsocketsMessage(MessageType messageType = MessageType::Empty, std::string data = std::string())
+        : type(messageType), payload(data) {}
+    const std::string& rawData() const { return payload; }
+    String data() const { return String(payload); }
+    const char* c_str() const { return payload.c_str(); }
+    uint32_t length() const { return payload.size(); }
+    bool isEmpty() const { return type == MessageType::Empty; }
+    bool isText() const { return type == MessageType::Text; }
+    bool isBinary() const { return type == MessageType::Binary; }
+};
+
+typedef std::function<void(WebsocketsMessage)> MessageCallback;
+typedef std::function<void(WebsocketsEvent, String)> EventCallback;
+
+class WebsocketsClient {
+private:
+    int socketFd;
+    bool connected;
+    std::string receiveBuffer;
+    std::string fragments;     // 分片消息的已收部分
+    MessageType fragmentType;
+    MessageCallback messageCallback;
+    EventCallback eventCallback;
+    
+    bool sendFrame(uint8_t opcode, const char* data, size_t length);
+    bool writeAll(const uint8_t* data, size_t length);
+    bool handshake(const std::string& host, int port, const std::string& path);
+    bool parseFrame();
+    void closeSocket(bool notify);
+
+public:
+    WebsocketsClient();
+    ~WebsocketsClient();
+    
+    void onMessage(MessageCallback callback) { messageCallback = callback; }
+    void onEvent(EventCallback callback) { eventCallback = callback; }
+    
+    bool connect(const String& url);
+    bool available() const { return connected; }
+    bool poll();
+    bool send(const String& data) { return send(data.c_str(), data.length()); }
+    bool send(const char* data, size_t length) { return sendFrame(0x1, data, length); }
+    bool sendBinary(const char* data, size_t length) { return sendFrame(0x2, data, length); }
+    bool ping() { return sendFrame(0x9, "", 0); }
+    void close();
+};
+
+}  // namespace websockets
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef HOST_ESP32SERVO_H
+#define HOST_ESP32SERVO_H
+
+#include <Arduino.h>
+#include "sim_trace.h"
+
+// 主机构建用的ESP32Servo替身：不产生脉冲，把写入的角度和脉宽按引脚记录到仿真轨迹
+class Servo {
+private:
+    int pin;
+    int minPulse;
+    int maxPulse;
+    int pulseWidth;
+
+public:
+    Servo() : pin(-1), minPulse(544), maxPulse(2400), pulseWidth(1500) {}
+    
+    int attach(int servoPin) { return attach(servoPin, 544, 2400); }
+    int attach(int servoPin, int minUs, int maxUs) {
+        pin = servoPin;
+        minPulse = minUs;
+        maxPulse = maxUs;
+        return 1;
+    }
+    void detach() { pin = -1; }
+    bool attached() const { return pin >= 0; }
+    
+    void write(int angle) {
+        angle = constrain(angle, 0, 180);
+        pulseWidth = map(angle, 0, 180, minPulse, maxPulse);
+        simTrace("servo", pin, angle);
+    }
+    void writeMicroseconds(int us) {
+        pulseWidth = constrain(us, minPulse, maxPulse);
+        simTrace("servo_us", pin, pulseWidth);
+    }
+    int read() const { return map(pulseWidth, minPulse, maxPulse, 0, 180); }
+    int readMicroseconds() const { return pulseWidth; }
+};
+
+#endif
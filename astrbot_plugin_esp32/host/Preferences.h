@@ -0,0 +1,55 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+// 主机构建用的Preferences（NVS）替身：键值保存在进程内存中，仿真重启后恢复为空
+class Preferences {
+private:
+    std::string space;
+    bool opened;
+    bool readOnly;
+    
+    static std::map<std::string, std::vector<uint8_t>>& store() {
+        static std::map<std::string, std::vector<uint8_t>> entries;
+        return entries;
+    }
+    std::string fullKey(const char* key) const { return space + "/" + key; }
+
+public:
+    Preferences() : opened(false), readOnly(false) {}
+    
+    bool begin(const char* name, bool readOnlyMode = false) {
+        space = name;
+        opened = true;
+        readOnly = readOnlyMode;
+        return true;
+    }
+    void end() { opened = false; }
+    
+    size_t getBytesLength(const char* key) {
+        auto it = store().find(fullKey(key));
+        return opened && it != store().end() ? it->second.size() : 0;
+    }
+    size_t getBytes(const char* key, void* buffer, size_t maxLength) {
+        auto it = store().find(fullKey(key));
+        if (!opened || it == store().end() || it->second.size() > maxLength) return 0;
+        memcpy(buffer, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+    size_t putBytes(const char* key, const void* value, size_t length) {
+        if (!opened || readOnly) return 0;
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        store()[fullKey(key)].assign(bytes, bytes + length);
+        return length;
+    }
+    bool remove(const char* key) {
+        if (!opened || readOnly) return false;
+        return store().erase(fullKey(key)) > 0;
+    }
+};
+
+#endif
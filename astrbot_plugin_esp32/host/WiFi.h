@@ -0,0 +1,55 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+// 主机构建用的WiFi替身：主机网络总是可用，begin()之后立即视为已连接
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+#define WIFI_STA 1
+
+class IPAddress : public Printable {
+private:
+    uint8_t octets[4];
+
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+    String toString() const {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+        return String(text);
+    }
+    size_t printTo(Print& p) const override { return p.print(toString()); }
+};
+
+class WiFiClass {
+private:
+    wl_status_t currentStatus;
+
+public:
+    WiFiClass() : currentStatus(WL_DISCONNECTED) {}
+    void mode(int m) { (void)m; }
+    void setAutoReconnect(bool enabled) { (void)enabled; }
+    wl_status_t begin(const char* ssid, const char* password) {
+        (void)ssid;
+        (void)password;
+        currentStatus = WL_CONNECTED;
+        return currentStatus;
+    }
+    bool disconnect() { currentStatus = WL_DISCONNECTED; return true; }
+    bool reconnect() { currentStatus = WL_CONNECTED; return true; }
+    wl_status_t status() const { return currentStatus; }
+    IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+    int32_t RSSI() const { return -40; }
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+// 主机构建用的I2C替身：每次传输结束时交给OLED面板模型（sim_trace.h）解析
+class TwoWire {
+private:
+    static const size_t BUFFER_SIZE = 128;  // 与ESP32 Wire缓冲区一致，超出部分丢弃
+    uint8_t address;
+    uint8_t buffer[BUFFER_SIZE];
+    size_t length;
+    uint32_t clock;
+
+public:
+    TwoWire() : address(0), length(0), clock(100000) {}
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+        (void)sda;
+        (void)scl;
+        if (frequency) clock = frequency;
+        return true;
+    }
+    void setClock(uint32_t frequency) { clock = frequency; }
+    uint32_t getClock() const { return clock; }
+    void beginTransmission(uint8_t deviceAddress) {
+        address = deviceAddress;
+        length = 0;
+    }
+    size_t write(uint8_t data) {
+        if (length >= BUFFER_SIZE) return 0;
+        buffer[length++] = data;
+        return 1;
+    }
+    size_t write(const uint8_t* data, size_t count) {
+        size_t written = 0;
+        while (written < count && write(data[written])) written++;
+        return written;
+    }
+    uint8_t endTransmission(bool sendStop = true);
+};
+
+extern TwoWire Wire;
+
+#endif
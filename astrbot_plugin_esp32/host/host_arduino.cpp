@@ -0,0 +1,478 @@
+#include <Arduino.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <malloc.h>
+#include "sim_trace.h"
+
+// ---------------- 时间 ----------------
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// ---------------- 数学与随机数 ----------------
+
+static std::mt19937 randomEngine(12345);
+static std::mutex randomLock;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long howBig) {
+    if (howBig <= 0) return 0;
+    std::lock_guard<std::mutex> guard(randomLock);
+    return (long)(randomEngine() % (unsigned long)howBig);
+}
+
+long random(long howSmall, long howBig) {
+    if (howSmall >= howBig) return howSmall;
+    return howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed) {
+    std::lock_guard<std::mutex> guard(randomLock);
+    randomEngine.seed(seed);
+}
+
+// ---------------- GPIO与LEDC ----------------
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    simTrace("gpio", pin, value);
+}
+
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution) {
+    (void)channel;
+    (void)resolution;
+    return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {
+    (void)pin;
+    (void)channel;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+    simTrace("ledc", channel, (long)duty);
+}
+
+// ---------------- String ----------------
+
+static std::string formatInteger(unsigned long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char digits[72];
+    int pos = sizeof(digits);
+    digits[--pos] = '\0';
+    do {
+        int digit = value % base;
+        digits[--pos] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        value /= base;
+    } while (value > 0);
+    if (negative) digits[--pos] = '-';
+    return std::string(digits + pos);
+}
+
+String::String(int value, unsigned char base) : String((long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base) {
+    // 与Arduino一致：只有十进制输出负号
+    if (value < 0 && base == 10) {
+        buffer = formatInteger(0UL - (unsigned long)value, true, base);
+    } else {
+        buffer = formatInteger((unsigned long)value, false, base);
+    }
+}
+
+String::String(unsigned long value, unsigned char base) : buffer(formatInteger(value, false, base)) {}
+
+String::String(float value, unsigned char decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned char decimals) {
+    char text[64];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    buffer = text;
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (buffer.size() != other.buffer.size()) return false;
+    for (size_t i = 0; i < buffer.size(); i++) {
+        if (tolower((unsigned char)buffer[i]) != tolower((unsigned char)other.buffer[i])) return false;
+    }
+    return true;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = buffer.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+    size_t pos = buffer.find(text.buffer, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t pos = buffer.rfind(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+bool String::startsWith(const String& prefix) const {
+    return buffer.compare(0, prefix.buffer.size(), prefix.buffer) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return buffer.size() >= suffix.buffer.size() &&
+           buffer.compare(buffer.size() - suffix.buffer.size(), suffix.buffer.size(), suffix.buffer) == 0;
+}
+
+String String::substring(unsigned int from) const {
+    return substring(from, buffer.size());
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+        unsigned int swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from >= buffer.size()) return String();
+    if (to > buffer.size()) to = buffer.size();
+    return String(buffer.substr(from, to - from));
+}
+
+void String::toLowerCase() {
+    for (size_t i = 0; i < buffer.size(); i++) buffer[i] = tolower((unsigned char)buffer[i]);
+}
+
+void String::toUpperCase() {
+    for (size_t i = 0; i < buffer.size(); i++) buffer[i] = toupper((unsigned char)buffer[i]);
+}
+
+void String::trim() {
+    size_t begin = 0;
+    while (begin < buffer.size() && isspace((unsigned char)buffer[begin])) begin++;
+    size_t end = buffer.size();
+    while (end > begin && isspace((unsigned char)buffer[end - 1])) end--;
+    buffer = buffer.substr(begin, end - begin);
+}
+
+void String::replace(const String& from, const String& to) {
+    if (from.buffer.empty()) return;
+    size_t pos = 0;
+    while ((pos = buffer.find(from.buffer, pos)) != std::string::npos) {
+        buffer.replace(pos, from.buffer.size(), to.buffer);
+        pos += to.buffer.size();
+    }
+}
+
+void String::remove(unsigned int index) {
+    if (index < buffer.size()) buffer.erase(index);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index < buffer.size()) buffer.erase(index, count);
+}
+
+String operator+(const String& a, const String& b) {
+    String result(a);
+    result.buffer += b.buffer;
+    return result;
+}
+
+// ---------------- Print / Serial ----------------
+
+static std::mutex serialLock;
+HardwareSerial Serial;
+
+size_t Print::write(const uint8_t* data, size_t size) {
+    size_t written = 0;
+    while (written < size && write(data[written])) written++;
+    return written;
+}
+
+size_t Print::print(const Printable& value) {
+    return value.printTo(*this);
+}
+
+int Print::printf(const char* format, ...) {
+    char stackBuffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(stackBuffer, sizeof(stackBuffer), format, args);
+    va_end(args);
+    if (length < 0) return length;
+    if (length < (int)sizeof(stackBuffer)) {
+        return write((const uint8_t*)stackBuffer, length);
+    }
+    
+    std::string text(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&text[0], text.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)text.data(), length);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t size) {
+    std::lock_guard<std::mutex> guard(serialLock);
+    return fwrite(data, 1, size, stdout);
+}
+
+void HardwareSerial::flush() {
+    std::lock_guard<std::mutex> guard(serialLock);
+    fflush(stdout);
+}
+
+// ---------------- ESP ----------------
+
+EspClass ESP;
+
+// 主机堆统计取自glibc，以固件的320KB内部RAM为总量换算剩余值，只用于观察趋势
+static const uint32_t HOST_HEAP_SIZE = 320 * 1024;
+static std::atomic<uint32_t> minFreeHeap(HOST_HEAP_SIZE);
+
+void EspClass::restart() {
+    Serial.println("[sim] ESP.restart()，主机仿真进程退出");
+    Serial.flush();
+    simTraceClose();
+    exit(0);
+}
+
+uint32_t EspClass::getFreeHeap() {
+    struct mallinfo2 info = mallinfo2();
+    uint32_t used = info.uordblks > HOST_HEAP_SIZE ? HOST_HEAP_SIZE : (uint32_t)info.uordblks;
+    uint32_t free = HOST_HEAP_SIZE - used;
+    uint32_t lowest = minFreeHeap.load();
+    while (free < lowest && !minFreeHeap.compare_exchange_weak(lowest, free)) {}
+    return free;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    getFreeHeap();
+    return minFreeHeap.load();
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return getFreeHeap();
+}
+
+uint32_t EspClass::getHeapSize() {
+    return HOST_HEAP_SIZE;
+}
+
+uint32_t EspClass::getCycleCount() {
+    return (uint32_t)(micros() * getCpuFreqMHz());
+}
+
+// ---------------- FreeRTOS ----------------
+
+struct HostTask {
+    std::mutex lock;
+    std::condition_variable wake;
+    uint32_t notifyCount = 0;
+    const char* name = "main";
+};
+
+struct HostMutex {
+    std::timed_mutex lock;
+};
+
+struct TaskStart {
+    HostTask* task;
+    void (*entry)(void*);
+    void* param;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    // 未经xTaskCreatePinnedToCore创建的线程（如main）在首次调用时登记
+    if (!currentTask) {
+        currentTask = new HostTask();
+    }
+    return currentTask;
+}
+
+BaseType_t xTaskCreatePinnedToCore(void (*task)(void*), const char* name, uint32_t stackDepth, void* param,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    // 主机上不区分核心和优先级，栈大小由系统决定
+    (void)stackDepth;
+    (void)priority;
+    (void)core;
+    HostTask* created = new HostTask();
+    created->name = name;
+    if (handle) *handle = created;
+    
+    TaskStart start = {created, task, param};
+    std::thread([start]() {
+        currentTask = start.task;
+        start.entry(start.param);
+    }).detach();
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(millis() / portTICK_PERIOD_MS);
+}
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t period) {
+    *previousWake += period;
+    std::this_thread::sleep_until(bootTime + std::chrono::milliseconds(*previousWake * portTICK_PERIOD_MS));
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return pdFAIL;
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        task->notifyCount++;
+    }
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+    HostTask* task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->lock);
+    if (ticksToWait == portMAX_DELAY) {
+        task->wake.wait(guard, [task]() { return task->notifyCount > 0; });
+    } else {
+        task->wake.wait_for(guard, std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS),
+                            [task]() { return task->notifyCount > 0; });
+    }
+    uint32_t count = task->notifyCount;
+    if (count > 0) {
+        task->notifyCount = clearOnExit ? 0 : count - 1;
+    }
+    return count;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    (void)task;
+    return 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new HostMutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticksToWait) {
+    if (ticksToWait == portMAX_DELAY) {
+        mutex->lock.lock();
+        return pdTRUE;
+    }
+    return mutex->lock.try_lock_for(std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+    mutex->lock.unlock();
+    return pdTRUE;
+}
+
+void portENTER_CRITICAL(portMUX_TYPE* mux) {
+    while (__atomic_exchange_n(&mux->locked, 1, __ATOMIC_ACQUIRE)) {
+        std::this_thread::yield();
+    }
+}
+
+void portEXIT_CRITICAL(portMUX_TYPE* mux) {
+    __atomic_store_n(&mux->locked, 0, __ATOMIC_RELEASE);
+}
+
+// ---------------- 硬件定时器 ----------------
+
+struct hw_timer_t {
+    uint16_t divider;
+    void (*isr)();
+    uint64_t alarmValue;
+    bool autoReload;
+    std::atomic<bool> running;
+};
+
+hw_timer_t* timerBegin(uint8_t num, uint16_t divider, bool countUp) {
+    (void)num;
+    (void)countUp;
+    hw_timer_t* timer = new hw_timer_t();
+    timer->divider = divider ? divider : 1;
+    timer->isr = nullptr;
+    timer->alarmValue = 0;
+    timer->autoReload = false;
+    timer->running = false;
+    return timer;
+}
+
+void timerAttachInterrupt(hw_timer_t* timer, void (*isr)(), bool edge) {
+    (void)edge;
+    timer->isr = isr;
+}
+
+void timerAlarmWrite(hw_timer_t* timer, uint64_t alarmValue, bool autoReload) {
+    timer->alarmValue = alarmValue;
+    timer->autoReload = autoReload;
+}
+
+void timerAlarmEnable(hw_timer_t* timer) {
+    if (timer->running.exchange(true)) return;
+    
+    // 定时器时钟为80MHz APB经分频后的计数频率，换算为线程的唤醒周期
+    std::chrono::nanoseconds period(timer->alarmValue * timer->divider * 1000 / 80);
+    std::thread([timer, period]() {
+        std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now() + period;
+        while (timer->running) {
+            std::this_thread::sleep_until(next);
+            if (!timer->running) break;
+            if (timer->isr) timer->isr();
+            if (!timer->autoReload) {
+                timer->running = false;
+                break;
+            }
+            next += period;
+        }
+    }).detach();
+}
+
+void timerAlarmDisable(hw_timer_t* timer) {
+    timer->running = false;
+}
+
+void timerEnd(hw_timer_t* timer) {
+    // 线程可能仍持有指针，主机上不释放
+    timer->running = false;
+}
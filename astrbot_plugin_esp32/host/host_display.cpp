@@ -0,0 +1,400 @@
+#include <Adafruit_SSD1306.h>
+#include "sim_trace.h"
+
+TwoWire Wire;
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    (void)sendStop;
+    simPanelWrite(address, buffer, length);
+    length = 0;
+    return 0;
+}
+
+// ---------------- Adafruit_GFX ----------------
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : _width(w), _height(h), cursorX(0), cursorY(0), textColor(0xFFFF), textBackground(0xFFFF),
+      textSizeX(1), textSizeY(1), wrap(true) {
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+    }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t swap;
+    if (x0 == x1) {
+        if (y0 > y1) { swap = y0; y0 = y1; y1 = swap; }
+        drawFastVLine(x0, y0, y1 - y0 + 1, color);
+        return;
+    }
+    if (y0 == y1) {
+        if (x0 > x1) { swap = x0; x0 = x1; x1 = swap; }
+        drawFastHLine(x0, y0, x1 - x0 + 1, color);
+        return;
+    }
+    
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        swap = x0; x0 = y0; y0 = swap;
+        swap = x1; x1 = y1; y1 = swap;
+    }
+    if (x0 > x1) {
+        swap = x0; x0 = x1; x1 = swap;
+        swap = y0; y0 = y1; y1 = swap;
+    }
+    
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) {
+            drawPixel(y0, x0, color);
+        } else {
+            drawPixel(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    
+    drawPixel(x0, y0 + r, color);
+    drawPixel(x0, y0 - r, color);
+    drawPixel(x0 + r, y0, color);
+    drawPixel(x0 - r, y0, color);
+    
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + y, y0 + x, color);
+        drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 + y, y0 - x, color);
+        drawPixel(x0 - y, y0 - x, color);
+    }
+}
+
+void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (corners & 0x4) {
+            drawPixel(x0 + x, y0 + y, color);
+            drawPixel(x0 + y, y0 + x, color);
+        }
+        if (corners & 0x2) {
+            drawPixel(x0 + x, y0 - y, color);
+            drawPixel(x0 + y, y0 - x, color);
+        }
+        if (corners & 0x8) {
+            drawPixel(x0 - y, y0 + x, color);
+            drawPixel(x0 - x, y0 + y, color);
+        }
+        if (corners & 0x1) {
+            drawPixel(x0 - y, y0 - x, color);
+            drawPixel(x0 - x, y0 - y, color);
+        }
+    }
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+    
+    delta++;  // 避免在循环中反复+1
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        // 避免重复绘制同一条竖线，INVERSE模式下会互相抵消
+        if (x < (y + 1)) {
+            if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+            if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+        }
+        if (y != py) {
+            if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+            if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    int16_t maxRadius = ((w < h) ? w : h) / 2;
+    if (r > maxRadius) r = maxRadius;
+    drawFastHLine(x + r, y, w - 2 * r, color);
+    drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+    drawFastVLine(x, y + r, h - 2 * r, color);
+    drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+    drawCircleHelper(x + r, y + r, r, 1, color);
+    drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+    drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+    drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    int16_t maxRadius = ((w < h) ? w : h) / 2;
+    if (r > maxRadius) r = maxRadius;
+    fillRect(x + r, y, w - 2 * r, h, color);
+    fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+    fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    int16_t a, b, y, last, swap;
+    
+    // 按y坐标排序 (y2 >= y1 >= y0)
+    if (y0 > y1) { swap = y0; y0 = y1; y1 = swap; swap = x0; x0 = x1; x1 = swap; }
+    if (y1 > y2) { swap = y2; y2 = y1; y1 = swap; swap = x2; x2 = x1; x1 = swap; }
+    if (y0 > y1) { swap = y0; y0 = y1; y1 = swap; swap = x0; x0 = x1; x1 = swap; }
+    
+    if (y0 == y2) {  // 三点在同一行
+        a = b = x0;
+        if (x1 < a) a = x1;
+        else if (x1 > b) b = x1;
+        if (x2 < a) a = x2;
+        else if (x2 > b) b = x2;
+        drawFastHLine(a, y0, b - a + 1, color);
+        return;
+    }
+    
+    int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+            dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+    
+    // 上半部分；y1 == y2时包含y1所在行，否则留给下半部分
+    last = (y1 == y2) ? y1 : y1 - 1;
+    for (y = y0; y <= last; y++) {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b) { swap = a; a = b; b = swap; }
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+    
+    sa = (int32_t)dx12 * (y - y1);
+    sb = (int32_t)dx02 * (y - y0);
+    for (; y <= y2; y++) {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b) { swap = a; a = b; b = swap; }
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+    int16_t byteWidth = (w + 7) / 8;
+    for (int16_t j = 0; j < h; j++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7))) {
+                drawPixel(x + i, y + j, color);
+            }
+        }
+    }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+    if (x >= _width || y >= _height || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0) return;
+    if (bg != color) {
+        fillRect(x, y, 6 * size, 8 * size, bg);
+    }
+    // 没有内置字库：可见字符画成5x7的方框，字符位置和占用范围与设备一致
+    if (c > ' ') {
+        drawRect(x, y, 5 * size, 7 * size, color);
+    }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    if (c == '\n') {
+        cursorX = 0;
+        cursorY += textSizeY * 8;
+    } else if (c != '\r') {
+        if (wrap && cursorX + textSizeX * 6 > _width) {
+            cursorX = 0;
+            cursorY += textSizeY * 8;
+        }
+        drawChar(cursorX, cursorY, c, textColor, textBackground, textSizeX);
+        cursorX += textSizeX * 6;
+    }
+    return 1;
+}
+
+// ---------------- Adafruit_SSD1306 ----------------
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t resetPin,
+                                   uint32_t clkDuring, uint32_t clkAfter)
+    : Adafruit_GFX(w, h), wire(twi), buffer(nullptr), address(0x3C) {
+    (void)resetPin;
+    (void)clkDuring;
+    (void)clkAfter;
+}
+
+Adafruit_SSD1306::~Adafruit_SSD1306() {
+    free(buffer);
+}
+
+bool Adafruit_SSD1306::begin(uint8_t vccState, uint8_t i2cAddress, bool reset, bool periphBegin) {
+    (void)vccState;
+    (void)reset;
+    (void)periphBegin;
+    if (!buffer) {
+        buffer = (uint8_t*)malloc(_width * ((_height + 7) / 8));
+        if (!buffer) return false;
+    }
+    clearDisplay();
+    address = i2cAddress;
+    
+    // 初始化序列只保留面板模型关心的部分：水平寻址模式、开启显示
+    sendCommand(SSD1306_MEMORYMODE);
+    sendCommand(0x00);
+    sendCommand(SSD1306_DISPLAYON);
+    return true;
+}
+
+void Adafruit_SSD1306::sendCommand(uint8_t command) {
+    wire->beginTransmission(address);
+    wire->write((uint8_t)0x00);
+    wire->write(command);
+    wire->endTransmission();
+}
+
+void Adafruit_SSD1306::ssd1306_command(uint8_t command) {
+    sendCommand(command);
+}
+
+void Adafruit_SSD1306::display() {
+    const uint8_t window[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0, (uint8_t)(_width - 1)};
+    wire->beginTransmission(address);
+    wire->write((uint8_t)0x00);
+    wire->write(window, sizeof(window));
+    wire->endTransmission();
+    
+    size_t count = _width * ((_height + 7) / 8);
+    const uint8_t* data = buffer;
+    while (count > 0) {
+        size_t chunk = count > 127 ? 127 : count;
+        wire->beginTransmission(address);
+        wire->write((uint8_t)0x40);
+        wire->write(data, chunk);
+        wire->endTransmission();
+        data += chunk;
+        count -= chunk;
+    }
+}
+
+void Adafruit_SSD1306::clearDisplay() {
+    memset(buffer, 0, _width * ((_height + 7) / 8));
+}
+
+void Adafruit_SSD1306::invertDisplay(bool invert) {
+    sendCommand(invert ? 0xA7 : 0xA6);
+}
+
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
+    if (x < 0 || x >= _width || y < 0 || y >= _height) return false;
+    return buffer[x + (y / 8) * _width] & (1 << (y & 7));
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+    uint8_t* byte = &buffer[x + (y / 8) * _width];
+    uint8_t bit = 1 << (y & 7);
+    switch (color) {
+        case SSD1306_WHITE: *byte |= bit; break;
+        case SSD1306_BLACK: *byte &= ~bit; break;
+        case SSD1306_INVERSE: *byte ^= bit; break;
+    }
+}
+
+void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (y < 0 || y >= _height) return;
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (x + w > _width) w = _width - x;
+    for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+}
+
+void Adafruit_SSD1306::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (x < 0 || x >= _width) return;
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (y + h > _height) h = _height - y;
+    for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+}
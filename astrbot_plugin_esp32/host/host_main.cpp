@@ -0,0 +1,47 @@
+#include <Arduino.h>
+#include <atomic>
+#include <signal.h>
+#include <unistd.h>
+#include "sim_trace.h"
+
+// 主机仿真入口：与Arduino核心相同，先调用一次setup()，之后循环调用loop()
+//
+// 环境变量：
+//   ESP32_SIM_SERVER       WebSocket服务器 host[:port]，默认127.0.0.1和固件配置的端口
+//   ESP32_SIM_TRACE        舵机/LED/OLED输出的CSV轨迹文件
+//   ESP32_SIM_PANEL        退出时把OLED面板内容写成PBM图像
+//   ESP32_SIM_DURATION_MS  运行指定毫秒数后退出，0或未设置表示一直运行到Ctrl+C
+
+static std::atomic<bool> stopRequested(false);
+
+static void onSignal(int signal) {
+    (void)signal;
+    stopRequested = true;
+}
+
+int main() {
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    
+    const char* tracePath = getenv("ESP32_SIM_TRACE");
+    if (tracePath && *tracePath) simTraceOpen(tracePath);
+    const char* panelPath = getenv("ESP32_SIM_PANEL");
+    const char* duration = getenv("ESP32_SIM_DURATION_MS");
+    unsigned long runFor = duration ? strtoul(duration, nullptr, 10) : 0;
+    
+    setup();
+    while (!stopRequested && (runFor == 0 || millis() < runFor)) {
+        loop();
+    }
+    
+    Serial.println("[sim] 仿真结束");
+    if (panelPath && *panelPath && !simPanelDump(panelPath)) {
+        fprintf(stderr, "[sim] 无法写入面板图像: %s\n", panelPath);
+    }
+    simTraceClose();
+    Serial.flush();
+    
+    // 网络任务和舵机控制任务仍在运行，不执行全局对象的析构
+    _exit(0);
+}
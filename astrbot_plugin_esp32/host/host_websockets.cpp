@@ -0,0 +1,326 @@
+#include <ArduinoWebsockets.h>
+#include <WiFi.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+namespace websockets {
+
+static const int CONNECT_TIMEOUT_MS = 3000;
+
+WebsocketsClient::WebsocketsClient()
+    : socketFd(-1), connected(false), fragmentType(MessageType::Empty) {
+}
+
+WebsocketsClient::~WebsocketsClient() {
+    closeSocket(false);
+}
+
+static bool parseUrl(const String& url, std::string& host, int& port, std::string& path) {
+    std::string text(url.c_str());
+    if (text.compare(0, 5, "ws://") != 0) return false;
+    text = text.substr(5);
+    
+    size_t slash = text.find('/');
+    path = slash == std::string::npos ? "/" : text.substr(slash);
+    std::string authority = text.substr(0, slash);
+    size_t colon = authority.rfind(':');
+    if (colon == std::string::npos) {
+        host = authority;
+        port = 80;
+    } else {
+        host = authority.substr(0, colon);
+        port = atoi(authority.c_str() + colon + 1);
+    }
+    return !host.empty() && port > 0;
+}
+
+static void applyServerOverride(std::string& host, int& port) {
+    // 固件中的服务器地址指向局域网主机；主机仿真默认连本机同一端口，
+    // 可用ESP32_SIM_SERVER=host[:port]指定其他服务器
+    const char* override = getenv("ESP32_SIM_SERVER");
+    if (!override || !*override) {
+        host = "127.0.0.1";
+        return;
+    }
+    std::string text(override);
+    size_t colon = text.rfind(':');
+    if (colon == std::string::npos) {
+        host = text;
+    } else {
+        host = text.substr(0, colon);
+        port = atoi(text.c_str() + colon + 1);
+    }
+}
+
+static int connectSocket(const std::string& host, int port) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    char service[8];
+    snprintf(service, sizeof(service), "%d", port);
+    
+    struct addrinfo* results = nullptr;
+    if (getaddrinfo(host.c_str(), service, &hints, &results) != 0) return -1;
+    
+    int fd = -1;
+    for (struct addrinfo* info = results; info; info = info->ai_next) {
+        fd = socket(info->ai_family, info->ai_socktype | SOCK_NONBLOCK, info->ai_protocol);
+        if (fd < 0) continue;
+        
+        // 非阻塞connect加超时，与设备上连接失败后不长时间卡住的行为一致
+        if (::connect(fd, info->ai_addr, info->ai_addrlen) == 0) break;
+        if (errno == EINPROGRESS) {
+            struct pollfd waiter = {fd, POLLOUT, 0};
+            int error = 0;
+            socklen_t length = sizeof(error);
+            if (::poll(&waiter, 1, CONNECT_TIMEOUT_MS) == 1 &&
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0) {
+                break;
+            }
+        }
+        ::close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(results);
+    return fd;
+}
+
+static std::string base64(const uint8_t* data, size_t length) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = data[i] << 16;
+        if (i + 1 < length) chunk |= data[i + 1] << 8;
+        if (i + 2 < length) chunk |= data[i + 2];
+        out += alphabet[(chunk >> 18) & 0x3F];
+        out += alphabet[(chunk >> 12) & 0x3F];
+        out += i + 1 < length ? alphabet[(chunk >> 6) & 0x3F] : '=';
+        out += i + 2 < length ? alphabet[chunk & 0x3F] : '=';
+    }
+    return out;
+}
+
+bool WebsocketsClient::connect(const String& url) {
+    closeSocket(false);
+    
+    std::string host, path;
+    int port;
+    if (!parseUrl(url, host, port, path)) return false;
+    applyServerOverride(host, port);
+    
+    socketFd = connectSocket(host, port);
+    if (socketFd < 0) return false;
+    if (!handshake(host, port, path)) {
+        closeSocket(false);
+        return false;
+    }
+    
+    connected = true;
+    if (eventCallback) eventCallback(WebsocketsEvent::ConnectionOpened, String());
+    return true;
+}
+
+bool WebsocketsClient::handshake(const std::string& host, int port, const std::string& path) {
+    uint8_t nonce[16];
+    for (size_t i = 0; i < sizeof(nonce); i++) nonce[i] = (uint8_t)random(256);
+    
+    char request[512];
+    int length = snprintf(request, sizeof(request),
+                          "GET %s HTTP/1.1\r\n"
+                          "Host: %s:%d\r\n"
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Key: %s\r\n"
+                          "Sec-WebSocket-Version: 13\r\n"
+                          "\r\n",
+                          path.c_str(), host.c_str(), port, base64(nonce, sizeof(nonce)).c_str());
+    if (!writeAll((const uint8_t*)request, length)) return false;
+    
+    // 读到响应头结束为止；多读到的字节已经是第一帧的数据，留在接收缓冲区
+    // 本地调试用途，不校验Sec-WebSocket-Accept
+    std::string response;
+    unsigned long deadline = millis() + CONNECT_TIMEOUT_MS;
+    size_t headerEnd;
+    while ((headerEnd = response.find("\r\n\r\n")) == std::string::npos) {
+        long remaining = (long)(deadline - millis());
+        struct pollfd waiter = {socketFd, POLLIN, 0};
+        if (remaining <= 0 || ::poll(&waiter, 1, remaining) != 1) return false;
+        char chunk[512];
+        ssize_t received = recv(socketFd, chunk, sizeof(chunk), 0);
+        if (received <= 0) return false;
+        response.append(chunk, received);
+    }
+    if (response.compare(0, 12, "HTTP/1.1 101") != 0) return false;
+    
+    receiveBuffer = response.substr(headerEnd + 4);
+    fragments.clear();
+    return true;
+}
+
+bool WebsocketsClient::writeAll(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        ssize_t written = ::send(socketFd, data, length, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+            struct pollfd waiter = {socketFd, POLLOUT, 0};
+            if (::poll(&waiter, 1, CONNECT_TIMEOUT_MS) != 1) return false;
+            continue;
+        }
+        data += written;
+        length -= written;
+    }
+    return true;
+}
+
+bool WebsocketsClient::sendFrame(uint8_t opcode, const char* data, size_t length) {
+    if (socketFd < 0 || (!connected && opcode != 0x8)) return false;
+    
+    // 客户端发出的帧必须加掩码
+    uint8_t header[14];
+    size_t headerLength = 0;
+    header[headerLength++] = 0x80 | opcode;
+    if (length < 126) {
+        header[headerLength++] = 0x80 | (uint8_t)length;
+    } else if (length <= 0xFFFF) {
+        header[headerLength++] = 0x80 | 126;
+        header[headerLength++] = (uint8_t)(length >> 8);
+        header[headerLength++] = (uint8_t)length;
+    } else {
+        header[headerLength++] = 0x80 | 127;
+        for (int shift = 56; shift >= 0; shift -= 8) header[headerLength++] = (uint8_t)((uint64_t)length >> shift);
+    }
+    uint8_t mask[4];
+    for (int i = 0; i < 4; i++) mask[i] = header[headerLength++] = (uint8_t)random(256);
+    
+    std::string frame((const char*)header, headerLength);
+    frame.reserve(headerLength + length);
+    for (size_t i = 0; i < length; i++) frame += (char)(data[i] ^ mask[i & 3]);
+    if (!writeAll((const uint8_t*)frame.data(), frame.size())) {
+        closeSocket(true);
+        return false;
+    }
+    return true;
+}
+
+bool WebsocketsClient::poll() {
+    if (!connected) return false;
+    
+    char chunk[4096];
+    for (;;) {
+        ssize_t received = recv(socketFd, chunk, sizeof(chunk), MSG_DONTWAIT);
+        if (received > 0) {
+            receiveBuffer.append(chunk, received);
+            continue;
+        }
+        if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            // 对端关闭：先处理已收到的完整帧
+            while (connected && parseFrame()) {}
+            closeSocket(true);
+            return false;
+        }
+        break;
+    }
+    
+    bool handled = false;
+    while (connected && parseFrame()) handled = true;
+    return handled;
+}
+
+// 从接收缓冲区取出一帧并处理，数据不足一帧时返回false
+bool WebsocketsClient::parseFrame() {
+    const uint8_t* bytes = (const uint8_t*)receiveBuffer.data();
+    size_t available = receiveBuffer.size();
+    if (available < 2) return false;
+    
+    bool fin = bytes[0] & 0x80;
+    uint8_t opcode = bytes[0] & 0x0F;
+    bool masked = bytes[1] & 0x80;
+    uint64_t length = bytes[1] & 0x7F;
+    size_t offset = 2;
+    if (length == 126) {
+        if (available < 4) return false;
+        length = (bytes[2] << 8) | bytes[3];
+        offset = 4;
+    } else if (length == 127) {
+        if (available < 10) return false;
+        length = 0;
+        for (int i = 0; i < 8; i++) length = (length << 8) | bytes[2 + i];
+        offset = 10;
+    }
+    uint8_t mask[4] = {0, 0, 0, 0};
+    if (masked) {
+        if (available < offset + 4) return false;
+        memcpy(mask, bytes + offset, 4);
+        offset += 4;
+    }
+    if (available < offset + length) return false;
+    
+    std::string payload = receiveBuffer.substr(offset, length);
+    if (masked) {
+        for (size_t i = 0; i < payload.size(); i++) payload[i] ^= mask[i & 3];
+    }
+    receiveBuffer.erase(0, offset + length);
+    
+    switch (opcode) {
+        case 0x0:  // 后续分片
+        case 0x1:
+        case 0x2:
+            if (opcode != 0x0) {
+                fragmentType = opcode == 0x1 ? MessageType::Text : MessageType::Binary;
+                fragments.clear();
+            }
+            fragments += payload;
+            if (fin) {
+                WebsocketsMessage message(fragmentType, fragments);
+                fragments.clear();
+                if (messageCallback) messageCallback(message);
+            }
+            break;
+        case 0x8:  // 关闭：回应后断开
+            sendFrame(0x8, payload.data(), payload.size() >= 2 ? 2 : 0);
+            closeSocket(true);
+            break;
+        case 0x9:
+            sendFrame(0xA, payload.data(), payload.size());
+            if (eventCallback) eventCallback(WebsocketsEvent::GotPing, String(payload));
+            break;
+        case 0xA:
+            if (eventCallback) eventCallback(WebsocketsEvent::GotPong, String(payload));
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+void WebsocketsClient::close() {
+    if (connected) {
+        const char normalClosure[] = {0x03, (char)0xE8};  // 1000
+        sendFrame(0x8, normalClosure, sizeof(normalClosure));
+    }
+    closeSocket(true);
+}
+
+void WebsocketsClient::closeSocket(bool notify) {
+    bool wasConnected = connected;
+    connected = false;
+    if (socketFd >= 0) {
+        ::close(socketFd);
+        socketFd = -1;
+    }
+    receiveBuffer.clear();
+    fragments.clear();
+    if (notify && wasConnected && eventCallback) {
+        eventCallback(WebsocketsEvent::ConnectionClosed, String());
+    }
+}
+
+}  // namespace websockets
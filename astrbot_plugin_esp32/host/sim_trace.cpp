@@ -0,0 +1,148 @@
+#include "sim_trace.h"
+#include <Arduino.h>
+#include <mutex>
+
+// ---------------- 仿真轨迹 ----------------
+
+static std::mutex traceLock;
+static FILE* traceFile = nullptr;
+
+void simTraceOpen(const char* path) {
+    std::lock_guard<std::mutex> guard(traceLock);
+    if (traceFile) fclose(traceFile);
+    traceFile = fopen(path, "w");
+    if (!traceFile) {
+        fprintf(stderr, "[sim] 无法打开轨迹文件: %s\n", path);
+        return;
+    }
+    fputs("time_us,kind,channel,value\n", traceFile);
+}
+
+void simTraceClose() {
+    std::lock_guard<std::mutex> guard(traceLock);
+    if (traceFile) {
+        fclose(traceFile);
+        traceFile = nullptr;
+    }
+}
+
+void simTrace(const char* kind, int channel, long value) {
+    unsigned long now = micros();
+    std::lock_guard<std::mutex> guard(traceLock);
+    if (traceFile) {
+        fprintf(traceFile, "%lu,%s,%d,%ld\n", now, kind, channel, value);
+    }
+}
+
+// ---------------- SSD1306面板模型 ----------------
+
+// 只模拟水平寻址模式下的列/页窗口和显存写入，其他命令按参数个数跳过
+static const int PANEL_WIDTH = 128;
+static const int PANEL_PAGES = 8;
+
+struct PanelState {
+    uint8_t ram[PANEL_WIDTH * PANEL_PAGES];
+    uint8_t columnStart, columnEnd, pageStart, pageEnd;
+    uint8_t column, page;
+    uint8_t pendingCommand;   // 等待参数的命令
+    uint8_t params[2];
+    uint8_t paramCount, paramsNeeded;
+};
+
+static std::mutex panelLock;
+static PanelState panel = {{0}, 0, PANEL_WIDTH - 1, 0, PANEL_PAGES - 1, 0, 0, 0, {0, 0}, 0, 0};
+
+static uint8_t commandParamCount(uint8_t command) {
+    switch (command) {
+        case 0x21: case 0x22:              // 列地址、页地址窗口
+            return 2;
+        case 0x20: case 0x81: case 0x8D:   // 寻址模式、对比度、电荷泵
+        case 0xA8: case 0xD3: case 0xD5:
+        case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static void applyCommand(uint8_t command, const uint8_t* params) {
+    if (command == 0x21) {
+        panel.columnStart = params[0] & 0x7F;
+        panel.columnEnd = params[1] & 0x7F;
+        panel.column = panel.columnStart;
+    } else if (command == 0x22) {
+        panel.pageStart = params[0] & 0x07;
+        panel.pageEnd = params[1] & 0x07;
+        panel.page = panel.pageStart;
+    }
+}
+
+static void feedCommand(uint8_t byte) {
+    if (panel.paramsNeeded > 0) {
+        panel.params[panel.paramCount++] = byte;
+        if (panel.paramCount == panel.paramsNeeded) {
+            applyCommand(panel.pendingCommand, panel.params);
+            panel.paramsNeeded = 0;
+        }
+        return;
+    }
+    panel.pendingCommand = byte;
+    panel.paramCount = 0;
+    panel.paramsNeeded = commandParamCount(byte);
+    if (panel.paramsNeeded == 0) {
+        applyCommand(byte, panel.params);
+    }
+}
+
+static void feedData(uint8_t byte) {
+    panel.ram[panel.page * PANEL_WIDTH + panel.column] = byte;
+    if (panel.column >= panel.columnEnd) {
+        panel.column = panel.columnStart;
+        panel.page = panel.page >= panel.pageEnd ? panel.pageStart : panel.page + 1;
+    } else {
+        panel.column++;
+    }
+}
+
+void simPanelWrite(uint8_t address, const uint8_t* bytes, size_t length) {
+    if (length == 0) return;
+    
+    // 控制字节：0x00后续为命令，0x40后续为显示数据
+    bool data = bytes[0] & 0x40;
+    {
+        std::lock_guard<std::mutex> guard(panelLock);
+        for (size_t i = 1; i < length; i++) {
+            if (data) {
+                feedData(bytes[i]);
+            } else {
+                feedCommand(bytes[i]);
+            }
+        }
+    }
+    if (data) {
+        simTrace("oled", address, (long)(length - 1));
+    }
+}
+
+const uint8_t* simPanelBuffer(int& width, int& height) {
+    width = PANEL_WIDTH;
+    height = PANEL_PAGES * 8;
+    return panel.ram;
+}
+
+bool simPanelDump(const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    
+    std::lock_guard<std::mutex> guard(panelLock);
+    fprintf(file, "P1\n%d %d\n", PANEL_WIDTH, PANEL_PAGES * 8);
+    for (int y = 0; y < PANEL_PAGES * 8; y++) {
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            bool on = panel.ram[(y / 8) * PANEL_WIDTH + x] & (1 << (y & 7));
+            fputc(on ? '1' : '0', file);
+        }
+        fputc('\n', file);
+    }
+    fclose(file);
+    return true;
+}
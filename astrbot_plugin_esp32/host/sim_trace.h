@@ -0,0 +1,20 @@
+#ifndef SIM_TRACE_H
+#define SIM_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 仿真轨迹：主机构建把所有硬件输出按时间顺序记录为CSV，每行为
+//   微秒时间戳,类型,通道,值
+// 类型：servo（角度）、servo_us（脉宽）、ledc（PWM占空比）、oled（I2C显示数据字节数）
+// 由环境变量ESP32_SIM_TRACE指定输出文件，未设置时不记录
+void simTraceOpen(const char* path);
+void simTraceClose();
+void simTrace(const char* kind, int channel, long value);
+
+// OLED面板模型：解析发往SSD1306的I2C命令和显示数据，得到面板上实际显示的内容
+void simPanelWrite(uint8_t address, const uint8_t* bytes, size_t length);
+const uint8_t* simPanelBuffer(int& width, int& height);  // 页排列，与SSD1306显存一致
+bool simPanelDump(const char* path);                     // 写出PBM图像
+
+#endif
@@ -0,0 +1,109 @@
+#include "binary_log.h"
+
+// 记录体之前的帧头：魔数和长度
+static const uint8_t RECORD_HEADER = 2;
+
+// 环形缓冲区中存放已经成帧的记录，输出任务只需按顺序写出字节
+static uint8_t ring[LOG_BUFFER_SIZE];
+static uint32_t ringHead = 0;  // 下一个要写出的字节
+static uint32_t ringUsed = 0;
+static uint32_t droppedTotal = 0;
+static uint32_t droppedPending = 0;  // 尚未以LOG_DROPPED记录报告的丢弃数
+static portMUX_TYPE ringLock = portMUX_INITIALIZER_UNLOCKED;
+
+LogRecord::LogRecord(LogId id) : length(RECORD_HEADER) {
+    appendInt(millis());
+    uint16_t number = (uint16_t)id;
+    bytes[length++] = number & 0xFF;
+    bytes[length++] = number >> 8;
+}
+
+void LogRecord::appendInt(uint32_t value) {
+    // 预留校验字节；放不下的参数直接省略，解码器会显示为缺失
+    if (length + 4 + 1 > LOG_RECORD_MAX) return;
+    for (uint8_t i = 0; i < 4; i++) {
+        bytes[length++] = (value >> (8 * i)) & 0xFF;
+    }
+}
+
+void LogRecord::appendString(const char* text) {
+    if (length + 1 + 1 > LOG_RECORD_MAX) return;
+    size_t room = LOG_RECORD_MAX - length - 1 - 1;
+    if (room > LOG_MAX_STRING) room = LOG_MAX_STRING;
+    
+    size_t count = 0;
+    while (count < room && text && text[count]) count++;
+    // 截断时不留下半个UTF-8字符
+    if (text && text[count]) {
+        while (count > 0 && ((uint8_t)text[count] & 0xC0) == 0x80) count--;
+    }
+    bytes[length++] = (uint8_t)count;
+    memcpy(bytes + length, text, count);
+    length += count;
+}
+
+void LogRecord::finish() {
+    uint8_t checksum = 0;
+    for (uint8_t i = RECORD_HEADER; i < length; i++) {
+        checksum ^= bytes[i];
+    }
+    bytes[0] = LOG_RECORD_MAGIC;
+    bytes[1] = length - RECORD_HEADER;
+    bytes[length++] = checksum;
+}
+
+void binaryLogCommit(const LogRecord& record) {
+    // 临界区内只做内存拷贝；缓冲区放不下时丢弃整条记录，不阻塞调用方
+    portENTER_CRITICAL(&ringLock);
+    if (ringUsed + record.size() > LOG_BUFFER_SIZE) {
+        droppedTotal++;
+        droppedPending++;
+    } else {
+        uint32_t tail = (ringHead + ringUsed) % LOG_BUFFER_SIZE;
+        for (uint8_t i = 0; i < record.size(); i++) {
+            ring[tail] = record.data()[i];
+            tail = tail + 1 == LOG_BUFFER_SIZE ? 0 : tail + 1;
+        }
+        ringUsed += record.size();
+    }
+    portEXIT_CRITICAL(&ringLock);
+}
+
+uint32_t binaryLogDropped() {
+    return droppedTotal;
+}
+
+// 输出任务：优先级低于网络和执行任务，串口写入阻塞时只影响它自己
+static void logTask(void* param) {
+    uint8_t chunk[LOG_RECORD_MAX * 2];
+    for (;;) {
+        uint32_t count = 0;
+        uint32_t dropped = 0;
+        portENTER_CRITICAL(&ringLock);
+        while (count < sizeof(chunk) && count < ringUsed) {
+            chunk[count] = ring[(ringHead + count) % LOG_BUFFER_SIZE];
+            count++;
+        }
+        ringHead = (ringHead + count) % LOG_BUFFER_SIZE;
+        ringUsed -= count;
+        if (ringUsed == 0) {
+            dropped = droppedPending;
+            droppedPending = 0;
+        }
+        portEXIT_CRITICAL(&ringLock);
+        
+        if (count > 0) {
+            Serial.write(chunk, count);
+            continue;
+        }
+        if (dropped > 0) {
+            LOG(LOG_DROPPED, dropped);
+            continue;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL));
+    }
+}
+
+void binaryLogBegin() {
+    xTaskCreatePinnedToCore(logTask, "log", LOG_TASK_STACK, nullptr, LOG_TASK_PRIORITY, nullptr, tskNO_AFFINITY);
+}
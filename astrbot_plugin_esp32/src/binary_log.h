@@ -0,0 +1,81 @@
+#ifndef BINARY_LOG_H
+#define BINARY_LOG_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "log_messages.h"
+
+// 延迟的二进制日志：调用方只把消息编号和参数编码进环形缓冲区，由低优先级任务慢慢写到串口
+// 串口上每条记录为 0x1E 长度 记录体 校验，记录体为 毫秒时间戳(4) 消息编号(2) 参数...，
+// 整数参数为4字节小端序，字符串为1字节长度加内容，校验为记录体各字节异或；用tools/log_decode.py解码
+// 低于LOG_LEVEL的消息在编译期去掉，参数表达式也不会求值
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE 4
+
+#define LOG_RECORD_MAGIC 0x1E  // 文本中不会出现的控制字符，解码器据此把记录与普通串口输出分开
+#define LOG_RECORD_MAX 64      // 单条记录（含帧头和校验）最大字节数
+#define LOG_MAX_STRING 32      // 单个字符串参数最多记录的字节数
+
+enum class LogId : uint16_t {
+#define X(name, level, format) name,
+    LOG_MESSAGES(X)
+#undef X
+    Count
+};
+
+#define X(name, level, format) static const uint8_t LOG_LEVEL_OF_##name = LOG_LEVEL_##level;
+LOG_MESSAGES(X)
+#undef X
+
+// 记录一条日志，例如 LOG(SERVO_CONTROL, action, leftAngle, rightAngle, duration, fromUser)
+#define LOG(name, ...) do { \
+        if (LOG_LEVEL_OF_##name >= LOG_LEVEL) binaryLogWrite(LogId::name, ##__VA_ARGS__); \
+    } while (0)
+
+// 单条记录的编码缓冲区，放在调用方的栈上
+class LogRecord {
+private:
+    uint8_t bytes[LOG_RECORD_MAX];
+    uint8_t length;
+    
+    void appendInt(uint32_t value);
+    void appendString(const char* text);
+
+public:
+    explicit LogRecord(LogId id);
+    template <typename T>
+    void append(T value) { appendInt((uint32_t)value); }
+    void append(const char* text) { appendString(text); }
+    void append(char* text) { appendString(text); }
+    void append(const String& text) { appendString(text.c_str()); }
+    void finish();  // 填写长度和校验
+    const uint8_t* data() const { return bytes; }
+    uint8_t size() const { return length; }
+};
+
+void binaryLogBegin();  // 启动输出任务，在setup()最开始调用
+void binaryLogCommit(const LogRecord& record);
+uint32_t binaryLogDropped();  // 因缓冲区满丢弃的记录总数
+
+inline void binaryLogEncode(LogRecord& record) {
+}
+
+template <typename T, typename... Rest>
+inline void binaryLogEncode(LogRecord& record, T value, Rest... rest) {
+    record.append(value);
+    binaryLogEncode(record, rest...);
+}
+
+template <typename... Args>
+void binaryLogWrite(LogId id, Args... args) {
+    LogRecord record(id);
+    binaryLogEncode(record, args...);
+    record.finish();
+    binaryLogCommit(record);
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "binary_protocol.h"
+#include <string.h>
+
+static uint16_t readU16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t readU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int16_t clampAngle(int16_t angle) {
+    if (angle < 0) return 0;
+    if (angle > 180) return 180;
+    return angle;
+}
+
+BinaryDecodeResult decodeBinaryCommand(const uint8_t* data, size_t length, Command& command) {
+    if (length < BINARY_HEADER_SIZE) {
+        return BinaryDecodeResult::TooShort;
+    }
+    if (data[0] != BINARY_PROTOCOL_MAGIC) {
+        return BinaryDecodeResult::BadMagic;
+    }
+    if (data[1] != BINARY_PROTOCOL_VERSION) {
+        return BinaryDecodeResult::BadVersion;
+    }
+    if (data[2] >= COMMAND_ACTION_COUNT) {
+        return BinaryDecodeResult::UnknownAction;
+    }
+    size_t textOffset = BINARY_HEADER_SIZE;
+    command.t0 = 0;
+    if (data[5] & BINARY_FLAG_T0) {
+        if (length < BINARY_HEADER_SIZE + 4) {
+            return BinaryDecodeResult::TooShort;
+        }
+        command.t0 = readU32(data + textOffset);
+        textOffset += 4;
+    }
+    command.seq = 0;
+    if (data[5] & BINARY_FLAG_SEQ) {
+        if (length < textOffset + 4) {
+            return BinaryDecodeResult::TooShort;
+        }
+        command.seq = readU32(data + textOffset);
+        textOffset += 4;
+    }
+    command.walkSteps = 0;
+    command.walkTempo = 100;
+    command.walkFlags = 0;
+    if (data[5] & BINARY_FLAG_WALK) {
+        if (length < textOffset + 4) {
+            return BinaryDecodeResult::TooShort;
+        }
+        command.walkSteps = readU16(data + textOffset);
+        command.walkTempo = data[textOffset + 2] != 0 ? data[textOffset + 2] : 100;
+        command.walkFlags = data[textOffset + 3];
+        textOffset += 4;
+    }
+    size_t textLength = length - textOffset;
+    if (textLength >= sizeof(command.text)) {
+        return BinaryDecodeResult::TextTooLong;
+    }
+    
+    // 与JSON路径做相同的范围限制
+    command.action = static_cast<CommandAction>(data[2]);
+    command.profile = data[3] <= 3 ? data[3] : 0;
+    // 0xFF为保持当前亮度（自定义命令led_on），与JSON路径的LED_BRIGHTNESS_KEEP相同，其余值截到100
+    if (data[4] == BINARY_BRIGHTNESS_KEEP) {
+        command.brightness = LED_BRIGHTNESS_KEEP;
+    } else {
+        command.brightness = data[4] <= 100 ? data[4] : 100;
+    }
+    command.leftAngle = clampAngle((int16_t)readU16(data + 6));
+    command.rightAngle = clampAngle((int16_t)readU16(data + 8));
+    command.durationMs = readU32(data + 10);
+    memcpy(command.text, data + textOffset, textLength);
+    command.text[textLength] = '\0';
+    return BinaryDecodeResult::Ok;
+}
+
+const char* binaryDecodeResultName(BinaryDecodeResult result) {
+    switch (result) {
+        case BinaryDecodeResult::Ok: return "ok";
+        case BinaryDecodeResult::TooShort: return "too_short";
+        case BinaryDecodeResult::BadMagic: return "bad_magic";
+        case BinaryDecodeResult::BadVersion: return "bad_version";
+        case BinaryDecodeResult::UnknownAction: return "unknown_action";
+        case BinaryDecodeResult::TextTooLong: return "text_too_long";
+    }
+    return "unknown";
+}
@@ -0,0 +1,52 @@
+#ifndef BINARY_PROTOCOL_H
+#define BINARY_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "command.h"
+
+// 紧凑二进制命令协议，以WebSocket二进制帧发送，JSON仍作为默认和兜底编码
+//
+// 帧格式（小端序）：
+//   0  uint8   magic      固定为BINARY_PROTOCOL_MAGIC
+//   1  uint8   version    协议版本
+//   2  uint8   action     CommandAction的数值
+//   3  uint8   profile    插值曲线，0表示不修改，否则为MotionProfile + 1
+//   4  uint8   brightness LED亮度百分比，BINARY_BRIGHTNESS_KEEP表示保持当前亮度
+//   5  uint8   flags      BINARY_FLAG_*，旧版本中为保留字节，固定填0
+//   6  int16   leftAngle
+//   8  int16   rightAngle
+//   10 uint32  durationMs
+//   .. uint32  t0         仅flags含BINARY_FLAG_T0时存在，服务器发送时刻（微秒）
+//   .. uint32  seq        仅flags含BINARY_FLAG_SEQ时存在，命令序号，紧跟在t0之后
+//   .. uint16  walkSteps  以下三项仅flags含BINARY_FLAG_WALK时存在，紧跟在seq之后
+//   .. uint8   walkTempo
+//   .. uint8   walkFlags  WALK_FLAG_*
+//   .. ...     text       OLED文本等附带内容，长度为帧剩余部分，不含结尾0
+//
+// Python端的编码实现见adapter/binary_protocol.py，两边必须同步修改
+
+#define BINARY_ENCODING_NAME "bin1"  // 握手时声明的编码名称
+
+const uint8_t BINARY_PROTOCOL_MAGIC = 0xA5;
+const uint8_t BINARY_PROTOCOL_VERSION = 1;
+const size_t BINARY_HEADER_SIZE = 14;
+const uint8_t BINARY_FLAG_T0 = 0x01;   // 帧头后附带4字节t0，设备执行后回传延迟测量结果
+const uint8_t BINARY_FLAG_SEQ = 0x02;  // 附带4字节命令序号，设备以ack回传接受和完成状态
+const uint8_t BINARY_BRIGHTNESS_KEEP = 0xFF;  // 亮度字节的特殊值，解码为LED_BRIGHTNESS_KEEP
+const uint8_t BINARY_FLAG_WALK = 0x04; // 附带4字节连续步行参数（步数、步速、选项），步行总时长使用durationMs
+
+enum class BinaryDecodeResult : uint8_t {
+    Ok,
+    TooShort,
+    BadMagic,
+    BadVersion,
+    UnknownAction,
+    TextTooLong
+};
+
+// 把一帧直接解码到命令结构体，不做任何堆分配
+BinaryDecodeResult decodeBinaryCommand(const uint8_t* data, size_t length, Command& command);
+const char* binaryDecodeResultName(BinaryDecodeResult result);
+
+#endif
@@ -0,0 +1,522 @@
+// 由 tools/gen_cjk_font.py 生成，请勿手动修改
+// 字体来源: esp32cjk_12.bdf (-astrbot-esp32cjk-medium-r-normal--12-120-75-75-c-120-iso10646-1)
+// COPYRIGHT: Copyright (c) 2026 astrbot_plugin_esp32 contributors
+// NOTICE: MIT License, same as astrbot_plugin_esp32
+// 许可: MIT（与本插件相同）
+// 字符表: 458个字符（cjk_charset.txt，其中固件状态文本和表情名称199个）
+#ifndef CJK_FONT_H
+#define CJK_FONT_H
+
+#include <Arduino.h>
+
+#define CJK_GLYPH_WIDTH 12
+#define CJK_GLYPH_HEIGHT 12
+#define CJK_GLYPH_BYTES 18  // 每个字形逐行连续打包的字节数
+
+const uint16_t CJK_GLYPH_COUNT = 458;
+
+// 按升序排列的码点，与CJK_GLYPHS中的字形一一对应
+const uint16_t CJK_CODEPOINTS[] PROGMEM = {
+    0x00B7, 0x2014, 0x2018, 0x2019, 0x201C, 0x201D, 0x2026, 0x3001, 0x3002, 0x300A, 0x300B, 0x3010,
+    0x3011, 0x4E00, 0x4E03, 0x4E07, 0x4E09, 0x4E0A, 0x4E0B, 0x4E0D, 0x4E0E, 0x4E1C, 0x4E22, 0x4E24,
+    0x4E2A, 0x4E2D, 0x4E3A, 0x4E3B, 0x4E3D, 0x4E48, 0x4E4B, 0x4E50, 0x4E5D, 0x4E5F, 0x4E60, 0x4E66,
+    0x4E86, 0x4E8B, 0x4E8C, 0x4E8E, 0x4E91, 0x4E94, 0x4E9B, 0x4EAE, 0x4EBA, 0x4EBF, 0x4EC0, 0x4ECA,
+    0x4ECE, 0x4ED6, 0x4EE4, 0x4EE5, 0x4EEC, 0x4F11, 0x4F1A, 0x4F24, 0x4F4D, 0x4F55, 0x4F5C, 0x4F60,
+    0x4FDD, 0x4FE1, 0x500D, 0x5012, 0x5019, 0x5047, 0x505C, 0x50CF, 0x5168, 0x516B, 0x516C, 0x516D,
+    0x5173, 0x5174, 0x5176, 0x5185, 0x518D, 0x519B, 0x51AC, 0x51B2, 0x51B7, 0x51C6, 0x51C9, 0x51E0,
+    0x51FA, 0x5206, 0x5217, 0x521D, 0x5230, 0x5236, 0x5237, 0x524D, 0x529B, 0x529F, 0x52A0, 0x52A8,
+    0x52A9, 0x5316, 0x5317, 0x533A, 0x5341, 0x5343, 0x5348, 0x534A, 0x5357, 0x539F, 0x53BB, 0x53C8,
+    0x53CB, 0x53D1, 0x53D6, 0x53D8, 0x53EA, 0x53EF, 0x53F3, 0x53F7, 0x5403, 0x540C, 0x540E, 0x5411,
+    0x5417, 0x5426, 0x5427, 0x542C, 0x542F, 0x5440, 0x544A, 0x5462, 0x5468, 0x547D, 0x548C, 0x54C8,
+    0x54E6, 0x54EA, 0x54ED, 0x5531, 0x554A, 0x5594, 0x559C, 0x559D, 0x55EF, 0x563F, 0x5668, 0x56DB,
+    0x56DE, 0x56E0, 0x56F0, 0x56FD, 0x56FE, 0x5728, 0x5730, 0x5740, 0x574F, 0x58F0, 0x5907, 0x590D,
+    0x590F, 0x5916, 0x591A, 0x5927, 0x5929, 0x592A, 0x5931, 0x5934, 0x5979, 0x597D, 0x5982, 0x59CB,
+    0x5B50, 0x5B58, 0x5B66, 0x5B83, 0x5B89, 0x5B8C, 0x5B9A, 0x5B9D, 0x5B9E, 0x5BB6, 0x5BBD, 0x5BF9,
+    0x5C06, 0x5C0F, 0x5C11, 0x5C31, 0x5C4F, 0x5DE5, 0x5DE6, 0x5DF2, 0x5E05, 0x5E0C, 0x5E2E, 0x5E38,
+    0x5E55, 0x5E74, 0x5E76, 0x5E94, 0x5EA6, 0x5F00, 0x5F03, 0x5F53, 0x5F88, 0x5F97, 0x5FAE, 0x5FC3,
+    0x5FC5, 0x5FD8, 0x5FD9, 0x5FEB, 0x6001, 0x600E, 0x6012, 0x601D, 0x603B, 0x6062, 0x606F, 0x60A8,
+    0x60C5, 0x60CA, 0x60F3, 0x610F, 0x611F, 0x6124, 0x61C2, 0x620F, 0x6210, 0x6211, 0x6240, 0x624B,
+    0x6253, 0x6267, 0x628A, 0x62D2, 0x62F7, 0x6307, 0x6362, 0x6392, 0x63A5, 0x63D0, 0x64CD, 0x6536,
+    0x6548, 0x6570, 0x6587, 0x65AD, 0x65B0, 0x65B9, 0x65C1, 0x65E0, 0x65E5, 0x65E9, 0x65F6, 0x660E,
+    0x661F, 0x6625, 0x6628, 0x662F, 0x663E, 0x665A, 0x6674, 0x6696, 0x66FF, 0x6700, 0x6708, 0x6709,
+    0x670B, 0x671B, 0x671F, 0x672A, 0x672B, 0x672C, 0x673A, 0x6765, 0x67E5, 0x6807, 0x6821, 0x6837,
+    0x6848, 0x68C0, 0x6A59, 0x6B22, 0x6B4C, 0x6B62, 0x6B63, 0x6B64, 0x6B65, 0x6BEB, 0x6C14, 0x6C34,
+    0x6CA1, 0x6CD5, 0x6D88, 0x6E05, 0x6E29, 0x6E34, 0x6E38, 0x6E7F, 0x6EDA, 0x6EE1, 0x6F02, 0x706D,
+    0x706F, 0x7070, 0x70B9, 0x70ED, 0x7136, 0x7184, 0x7231, 0x7279, 0x72B6, 0x7387, 0x73A9, 0x73B0,
+    0x7406, 0x751F, 0x7528, 0x7535, 0x767D, 0x767E, 0x7684, 0x76EE, 0x76F4, 0x76F8, 0x770B, 0x771F,
+    0x7740, 0x7761, 0x77E5, 0x7801, 0x793A, 0x79CB, 0x79CD, 0x79D2, 0x79FB, 0x7A0D, 0x7ACB, 0x7AD9,
+    0x7B11, 0x7B2C, 0x7B49, 0x7B54, 0x7D20, 0x7D2B, 0x7D2F, 0x7EA2, 0x7ECF, 0x7ED8, 0x7ED9, 0x7EDC,
+    0x7EDD, 0x7EED, 0x7EFF, 0x7F13, 0x7F51, 0x7F6E, 0x7F8E, 0x7FFB, 0x8001, 0x8003, 0x8005, 0x800C,
+    0x80FD, 0x8109, 0x811A, 0x817F, 0x81EA, 0x81F4, 0x821E, 0x8235, 0x8272, 0x8282, 0x84DD, 0x884C,
+    0x8868, 0x88AB, 0x897F, 0x8981, 0x89C1, 0x89C9, 0x89D2, 0x89E3, 0x8BA4, 0x8BB0, 0x8BB6, 0x8BBE,
+    0x8BC9, 0x8BDD, 0x8BE2, 0x8BE5, 0x8BEF, 0x8BF4, 0x8BF7, 0x8C01, 0x8C22, 0x8D1D, 0x8D25, 0x8D70,
+    0x8D77, 0x8DD1, 0x8DEF, 0x8DF3, 0x8EAB, 0x8F6C, 0x8FB9, 0x8FC7, 0x8FCE, 0x8FD0, 0x8FD8, 0x8FD9,
+    0x8FDB, 0x8FDE, 0x9000, 0x9001, 0x901A, 0x901F, 0x9053, 0x90A3, 0x90E8, 0x90FD, 0x914D, 0x9177,
+    0x91CC, 0x91CD, 0x949F, 0x9519, 0x957F, 0x95ED, 0x95EE, 0x95F4, 0x961F, 0x9633, 0x9634, 0x9664,
+    0x96BE, 0x96E8, 0x96EA, 0x96F6, 0x96FE, 0x9700, 0x9752, 0x9762, 0x97F3, 0x9875, 0x987B, 0x98CE,
+    0x996D, 0x997F, 0x9AD8, 0x9EC4, 0x9ED1, 0x9ED8, 0xFF01, 0xFF08, 0xFF09, 0xFF0C, 0xFF1A, 0xFF1B,
+    0xFF1F, 0xFF5E,
+};
+
+const uint8_t CJK_GLYPHS[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ·
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // —
+    0x01, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ‘
+    0x30, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ’
+    0x02, 0x40, 0x48, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // “
+    0x6C, 0x02, 0x40, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ”
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // …
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x10, 0x00, 0x00,  // 、
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x88, 0x08, 0x80, 0x70, 0x00, 0x00,  // 。
+    0x00, 0x00, 0x48, 0x09, 0x01, 0x20, 0x24, 0x04, 0x80, 0x24, 0x01, 0x20, 0x09, 0x00, 0x48, 0x00, 0x00, 0x00,  // 《
+    0x00, 0x02, 0x40, 0x12, 0x00, 0x90, 0x04, 0x80, 0x24, 0x04, 0x80, 0x90, 0x12, 0x02, 0x40, 0x00, 0x00, 0x00,  // 》
+    0x03, 0xC0, 0x38, 0x03, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x03, 0x00, 0x38, 0x03, 0xC0, 0x00,  // 【
+    0x78, 0x03, 0x80, 0x18, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x18, 0x03, 0x80, 0x78, 0x00, 0x00,  // 】
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 一
+    0x10, 0x01, 0x00, 0x10, 0x01, 0x04, 0x1E, 0x8F, 0x00, 0x10, 0x01, 0x00, 0x10, 0x21, 0x02, 0x0F, 0xC0, 0x00,  // 七
+    0xFF, 0xE1, 0x00, 0x10, 0x01, 0xFC, 0x10, 0x41, 0x04, 0x20, 0x42, 0x04, 0x40, 0x48, 0x04, 0x03, 0x80, 0x00,  // 万
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,  // 三
+    0x04, 0x00, 0x40, 0x04, 0x00, 0x7C, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x00,  // 上
+    0xFF, 0xE0, 0x40, 0x04, 0x00, 0x60, 0x05, 0x00, 0x48, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 下
+    0xFF, 0xE0, 0x20, 0x04, 0x00, 0xC0, 0x15, 0x02, 0x48, 0x44, 0x48, 0x42, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 不
+    0x20, 0x03, 0xF8, 0x20, 0x02, 0x00, 0x3F, 0x80, 0x08, 0xFF, 0xE0, 0x08, 0x00, 0x80, 0x08, 0x03, 0x00, 0x00,  // 与
+    0x08, 0x0F, 0xFE, 0x10, 0x02, 0x40, 0x7F, 0xC0, 0x40, 0x24, 0x84, 0x44, 0x84, 0x20, 0x40, 0x18, 0x00, 0x00,  // 东
+    0x00, 0xC3, 0xF0, 0x04, 0x07, 0xFC, 0x04, 0x0F, 0xFE, 0x08, 0x01, 0x10, 0x20, 0x8F, 0xF8, 0x00, 0x40, 0x00,  // 丢
+    0xFF, 0xE1, 0x10, 0x7F, 0xC5, 0x14, 0x51, 0x45, 0x9C, 0x6A, 0xC4, 0x44, 0x40, 0x44, 0x04, 0x41, 0x80, 0x00,  // 两
+    0x04, 0x00, 0xA0, 0x11, 0x02, 0x08, 0xC0, 0x60, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 个
+    0x04, 0x00, 0x40, 0x7F, 0xC4, 0x44, 0x44, 0x44, 0x44, 0x7F, 0xC0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 中
+    0x10, 0x00, 0xA0, 0x02, 0x07, 0xFC, 0x02, 0x40, 0x44, 0x0A, 0x41, 0x14, 0x20, 0x44, 0x04, 0x03, 0x80, 0x00,  // 为
+    0x04, 0x00, 0x20, 0x7F, 0xC0, 0x40, 0x04, 0x03, 0xF8, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x00,  // 主
+    0xFF, 0xE0, 0x00, 0x7B, 0xC4, 0xA4, 0x6B, 0x45, 0xAC, 0x4A, 0x44, 0xA4, 0x4A, 0x44, 0xA4, 0x5A, 0xC0, 0x00,  // 丽
+    0x04, 0x00, 0x80, 0x10, 0x02, 0x00, 0x44, 0x00, 0x80, 0x10, 0x02, 0x10, 0x40, 0x8F, 0xF8, 0x00, 0x40, 0x00,  // 么
+    0x08, 0x00, 0x40, 0x7F, 0x00, 0x20, 0x04, 0x00, 0x80, 0x10, 0x02, 0x00, 0x50, 0x08, 0xC0, 0x03, 0xE0, 0x00,  // 之
+    0x01, 0x83, 0xE0, 0x20, 0x02, 0x40, 0x7F, 0xE0, 0x40, 0x24, 0x84, 0x44, 0x84, 0x20, 0x40, 0x18, 0x00, 0x00,  // 乐
+    0x10, 0x01, 0x00, 0xFE, 0x01, 0x20, 0x12, 0x01, 0x20, 0x22, 0x02, 0x20, 0x42, 0x28, 0x22, 0x03, 0xC0, 0x00,  // 九
+    0x08, 0x00, 0x80, 0x48, 0x04, 0xFC, 0x78, 0x44, 0x84, 0x48, 0xC4, 0x80, 0x40, 0x24, 0x02, 0x3F, 0xC0, 0x00,  // 也
+    0x7F, 0x80, 0x08, 0x20, 0x81, 0x08, 0x08, 0x80, 0x08, 0x01, 0x80, 0x68, 0x38, 0x80, 0x08, 0x07, 0x00, 0x00,  // 习
+    0x04, 0x00, 0x58, 0x7F, 0x80, 0x48, 0x04, 0x8F, 0xFC, 0x04, 0x40, 0x44, 0x04, 0x40, 0x44, 0x04, 0xC0, 0x00,  // 书
+    0x7F, 0x80, 0x08, 0x01, 0x00, 0x20, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x18, 0x00, 0x00,  // 了
+    0x04, 0x0F, 0xFE, 0x3F, 0x82, 0x48, 0x3F, 0x80, 0x40, 0x7F, 0xC0, 0x44, 0xFF, 0xE0, 0x44, 0x1C, 0x00, 0x00,  // 事
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,  // 二
+    0x7F, 0xC0, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x18, 0x00, 0x00,  // 于
+    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x80, 0x10, 0x02, 0x10, 0x40, 0x8F, 0xF8, 0x00, 0x40, 0x00,  // 云
+    0x7F, 0xC0, 0x80, 0x08, 0x00, 0x80, 0x7F, 0x00, 0x90, 0x09, 0x01, 0x10, 0x11, 0x01, 0x10, 0xFF, 0xE0, 0x00,  // 五
+    0x44, 0x04, 0x48, 0x75, 0x04, 0x60, 0x44, 0x4F, 0x3C, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,  // 些
+    0x04, 0x0F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x8F, 0xFE, 0x80, 0x23, 0xF8, 0x11, 0x02, 0x12, 0xC1, 0xC0, 0x00,  // 亮
+    0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x0A, 0x00, 0xA0, 0x11, 0x01, 0x10, 0x20, 0x84, 0x04, 0x80, 0x20, 0x00,  // 人
+    0x20, 0x04, 0xFC, 0x40, 0x4C, 0x08, 0x41, 0x04, 0x20, 0x44, 0x04, 0x80, 0x48, 0x24, 0x82, 0x47, 0xC0, 0x00,  // 亿
+    0x21, 0x04, 0x10, 0x41, 0x0C, 0x10, 0x4F, 0xE4, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x00, 0x00,  // 什
+    0x04, 0x00, 0xA0, 0x11, 0x02, 0x08, 0xC4, 0x60, 0x20, 0x7F, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x00, 0x00,  // 今
+    0x21, 0x02, 0x10, 0x21, 0x02, 0x10, 0x31, 0x05, 0x28, 0x52, 0x84, 0xA4, 0x8C, 0x48, 0x42, 0x00, 0x00, 0x00,  // 从
+    0x22, 0x04, 0x20, 0x4A, 0x0C, 0xBC, 0x4E, 0x44, 0xA4, 0x4A, 0xC4, 0xA0, 0x48, 0x24, 0x82, 0x47, 0xC0, 0x00,  // 他
+    0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x84, 0x20, 0x20, 0x7F, 0x00, 0x10, 0x06, 0x00, 0x40, 0x04, 0x00, 0x00,  // 令
+    0x20, 0x42, 0x04, 0x24, 0x42, 0x24, 0x22, 0x42, 0x08, 0x24, 0x83, 0x94, 0x62, 0x28, 0x40, 0x00, 0x00, 0x00,  // 以
+    0x28, 0x04, 0x5E, 0x48, 0x2C, 0x82, 0x48, 0x24, 0x82, 0x48, 0x24, 0x82, 0x48, 0x24, 0x82, 0x48, 0x60, 0x00,  // 们
+    0x21, 0x04, 0x10, 0x4F, 0xEC, 0x10, 0x43, 0x84, 0x38, 0x45, 0x44, 0x92, 0x41, 0x04, 0x10, 0x41, 0x00, 0x00,  // 休
+    0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x9F, 0x20, 0x00, 0xFF, 0xE0, 0x80, 0x12, 0x02, 0x10, 0x7F, 0x80, 0x00,  // 会
+    0x24, 0x04, 0x7E, 0x48, 0x0C, 0x20, 0x4F, 0xE4, 0x22, 0x42, 0x24, 0x42, 0x44, 0x24, 0x82, 0x40, 0xC0, 0x00,  // 伤
+    0x21, 0x04, 0x10, 0x4F, 0xEC, 0x00, 0x44, 0x44, 0x44, 0x42, 0x44, 0x28, 0x40, 0x84, 0xFE, 0x40, 0x00, 0x00,  // 位
+    0x2F, 0xE4, 0x04, 0x4E, 0x4C, 0xA4, 0x4A, 0x44, 0xE4, 0x40, 0x44, 0x04, 0x40, 0x44, 0x04, 0x41, 0x80, 0x00,  // 何
+    0x24, 0x04, 0x40, 0x4F, 0xEC, 0xA0, 0x42, 0x04, 0x3E, 0x42, 0x04, 0x20, 0x43, 0xE4, 0x20, 0x42, 0x00, 0x00,  // 作
+    0x24, 0x04, 0x40, 0x4F, 0xEC, 0x82, 0x49, 0x24, 0x10, 0x45, 0x44, 0x52, 0x49, 0x24, 0x10, 0x46, 0x00, 0x00,  // 你
+    0x27, 0xC4, 0x44, 0x44, 0x4C, 0x7C, 0x41, 0x04, 0xFE, 0x41, 0x04, 0x38, 0x45, 0x44, 0x92, 0x41, 0x00, 0x00,  // 保
+    0x21, 0x04, 0xFE, 0x40, 0x0C, 0x7C, 0x40, 0x04, 0x7C, 0x40, 0x04, 0x7C, 0x44, 0x44, 0x44, 0x47, 0xC0, 0x00,  // 信
+    0x21, 0x04, 0xFE, 0x40, 0x0C, 0x44, 0x42, 0x84, 0xFE, 0x40, 0x04, 0x7C, 0x44, 0x44, 0x44, 0x47, 0xC0, 0x00,  // 倍
+    0x2F, 0x24, 0x46, 0x49, 0x6C, 0xF6, 0x44, 0x64, 0x46, 0x4F, 0x64, 0x46, 0x44, 0x24, 0xF2, 0x40, 0x60, 0x00,  // 倒
+    0x22, 0x04, 0xBE, 0x4A, 0x0C, 0xFE, 0x49, 0x04, 0xBE, 0x48, 0x84, 0xFE, 0x41, 0x44, 0x22, 0x44, 0x20, 0x00,  // 候
+    0x2E, 0xE4, 0x82, 0x4E, 0x4C, 0x8E, 0x4E, 0xA4, 0x8A, 0x4E, 0x44, 0x8A, 0x49, 0x24, 0x80, 0x48, 0x00, 0x00,  // 假
+    0x21, 0x04, 0xFE, 0x47, 0xCC, 0x44, 0x47, 0xC4, 0xFE, 0x48, 0x24, 0x7C, 0x41, 0x04, 0x10, 0x46, 0x00, 0x00,  // 停
+    0x22, 0x04, 0x78, 0x49, 0x0C, 0xFC, 0x4A, 0x44, 0xFC, 0x43, 0x24, 0x54, 0x4B, 0x44, 0x52, 0x49, 0x00, 0x00,  // 像
+    0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x80, 0x27, 0xFC, 0x04, 0x00, 0x40, 0x3F, 0x80, 0x40, 0xFF, 0xE0, 0x00,  // 全
+    0x00, 0x00, 0xA0, 0x0A, 0x00, 0x90, 0x11, 0x01, 0x08, 0x20, 0x82, 0x04, 0x40, 0x48, 0x02, 0x00, 0x00, 0x00,  // 八
+    0x11, 0x01, 0x10, 0x20, 0x82, 0x08, 0x40, 0x48, 0x42, 0x08, 0x01, 0x10, 0x20, 0x8F, 0xF8, 0x00, 0x40, 0x00,  // 公
+    0x04, 0x00, 0x20, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x10, 0x10, 0x82, 0x08, 0x20, 0x44, 0x04, 0x80, 0x00, 0x00,  // 六
+    0x20, 0x81, 0x10, 0x7F, 0xC0, 0x40, 0x04, 0x0F, 0xFE, 0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x80, 0x20, 0x00,  // 关
+    0x44, 0x42, 0x48, 0x25, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x11, 0x02, 0x08, 0x40, 0x48, 0x02, 0x00, 0x00, 0x00,  // 兴
+    0x20, 0x8F, 0xFE, 0x20, 0x83, 0xF8, 0x20, 0x83, 0xF8, 0x20, 0x8F, 0xFE, 0x11, 0x02, 0x08, 0x40, 0x40, 0x00,  // 其
+    0x04, 0x00, 0x40, 0x7F, 0xC4, 0x44, 0x44, 0x44, 0xA4, 0x51, 0x46, 0x0C, 0x40, 0x44, 0x04, 0x41, 0x80, 0x00,  // 内
+    0xFF, 0xE0, 0x40, 0x7F, 0xC4, 0x44, 0x44, 0x47, 0xFC, 0x44, 0x4F, 0xFE, 0x40, 0x44, 0x04, 0x41, 0x80, 0x00,  // 再
+    0xFF, 0xE8, 0x02, 0x08, 0x07, 0xFC, 0x12, 0x02, 0x20, 0x7F, 0xC0, 0x20, 0xFF, 0xE0, 0x20, 0x02, 0x00, 0x00,  // 军
+    0x10, 0x03, 0xF8, 0x40, 0x8A, 0x10, 0x12, 0x00, 0xC0, 0x13, 0x06, 0x0E, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00,  // 冬
+    0x01, 0x08, 0x10, 0x4F, 0xE0, 0x92, 0x09, 0x20, 0x92, 0x2F, 0xE4, 0x10, 0x81, 0x00, 0x10, 0x01, 0x00, 0x00,  // 冲
+    0x01, 0x08, 0x28, 0x44, 0x40, 0x82, 0x01, 0x00, 0x08, 0x2F, 0xC4, 0x04, 0x81, 0x80, 0x10, 0x01, 0x00, 0x00,  // 冷
+    0x05, 0x08, 0x48, 0x4F, 0xE0, 0xD0, 0x07, 0xC0, 0x50, 0x27, 0xC4, 0x50, 0x85, 0x00, 0x7E, 0x00, 0x00, 0x00,  // 准
+    0x01, 0x08, 0xFE, 0x40, 0x00, 0x7C, 0x04, 0x40, 0x7C, 0x21, 0x04, 0x54, 0x89, 0x20, 0x10, 0x06, 0x00, 0x00,  // 凉
+    0x00, 0x03, 0xE0, 0x22, 0x02, 0x20, 0x22, 0x02, 0x20, 0x22, 0x04, 0x20, 0x42, 0x28, 0x22, 0x03, 0xC0, 0x00,  // 几
+    0x04, 0x04, 0x44, 0x44, 0x44, 0x44, 0x7F, 0xC0, 0x40, 0x84, 0x28, 0x42, 0x84, 0x28, 0x42, 0xFF, 0xE0, 0x00,  // 出
+    0x11, 0x01, 0x08, 0x20, 0x44, 0x02, 0xBF, 0x81, 0x08, 0x10, 0x82, 0x08, 0x20, 0x84, 0x08, 0x83, 0x00, 0x00,  // 分
+    0xFE, 0x22, 0x0A, 0x20, 0xA7, 0xCA, 0x44, 0xAA, 0x8A, 0x10, 0xA2, 0x0A, 0x40, 0x28, 0x02, 0x00, 0x60, 0x00,  // 列
+    0x40, 0x0E, 0xFC, 0x22, 0x44, 0x24, 0xC2, 0x4A, 0x24, 0x44, 0x44, 0x44, 0x48, 0x44, 0x18, 0x40, 0x00, 0x00,  // 初
+    0xFE, 0x22, 0x0A, 0x48, 0xAF, 0xEA, 0x10, 0xA1, 0x0A, 0x7C, 0xA1, 0x0A, 0x10, 0x2F, 0xE2, 0x00, 0x60, 0x00,  // 到
+    0x50, 0x27, 0xCA, 0x90, 0xAF, 0xEA, 0x10, 0xA7, 0xCA, 0x54, 0xA5, 0x4A, 0x56, 0x21, 0x02, 0x10, 0x60, 0x00,  // 制
+    0xFC, 0x28, 0x4A, 0xFC, 0xA9, 0x0A, 0xBE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x28, 0x82, 0x88, 0x60, 0x00,  // 刷
+    0x20, 0x81, 0x10, 0xFF, 0xE7, 0x8A, 0x4A, 0xA7, 0xAA, 0x4A, 0xA7, 0xAA, 0x4A, 0x24, 0xA2, 0x58, 0x60, 0x00,  // 前
+    0x08, 0x00, 0x80, 0xFF, 0xC0, 0x84, 0x08, 0x41, 0x04, 0x10, 0x42, 0x04, 0x40, 0x48, 0x04, 0x01, 0x80, 0x00,  // 力
+    0x00, 0x8F, 0x9E, 0x20, 0xA2, 0x0A, 0x20, 0xA2, 0x0A, 0x21, 0x22, 0x52, 0xF1, 0x20, 0x02, 0x00, 0x40, 0x00,  // 功
+    0x40, 0x04, 0x00, 0xFB, 0xE4, 0xA2, 0x4A, 0x24, 0xA2, 0x8A, 0x28, 0xA2, 0x8B, 0xE0, 0x80, 0x30, 0x00, 0x00,  // 加
+    0x00, 0x8F, 0x9E, 0x00, 0xAF, 0xCA, 0x20, 0xA4, 0x0A, 0x49, 0x28, 0x52, 0xFD, 0x20, 0x02, 0x00, 0x40, 0x00,  // 动
+    0x78, 0x84, 0x9E, 0x48, 0xA7, 0x8A, 0x48, 0xA4, 0x8A, 0x79, 0x24, 0x92, 0x49, 0x2F, 0xC2, 0x00, 0x40, 0x00,  // 助
+    0x24, 0x04, 0x42, 0x44, 0x4C, 0x48, 0x45, 0x04, 0x60, 0x4C, 0x04, 0x40, 0x44, 0x24, 0x42, 0x43, 0xC0, 0x00,  // 化
+    0x14, 0x01, 0x40, 0x14, 0x41, 0x48, 0xF7, 0x01, 0x40, 0x14, 0x01, 0x40, 0x34, 0x2D, 0x42, 0x13, 0xC0, 0x00,  // 北
+    0xFF, 0xE8, 0x00, 0xA0, 0x89, 0x10, 0x8A, 0x08, 0x40, 0x8A, 0x09, 0x10, 0xA0, 0x88, 0x00, 0xFF, 0xE0, 0x00,  // 区
+    0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 十
+    0x00, 0xC3, 0xF0, 0x04, 0x00, 0x40, 0x04, 0x0F, 0xFE, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 千
+    0x20, 0x02, 0x00, 0x7F, 0x88, 0x40, 0x04, 0x0F, 0xFE, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 午
+    0x44, 0x42, 0x48, 0x04, 0x07, 0xFC, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 半
+    0x04, 0x0F, 0xFE, 0x04, 0x07, 0xFC, 0x51, 0x44, 0xA4, 0x5F, 0x44, 0x44, 0x5F, 0x44, 0x44, 0x44, 0xC0, 0x00,  // 南
+    0x7F, 0xE4, 0x20, 0x5F, 0xC5, 0x04, 0x5F, 0xC5, 0x04, 0x5F, 0xC4, 0x10, 0x49, 0x49, 0x12, 0x83, 0x00, 0x00,  // 原
+    0x04, 0x00, 0x40, 0x7F, 0xC0, 0x40, 0x04, 0x0F, 0xFE, 0x08, 0x01, 0x10, 0x20, 0x8F, 0xF8, 0x00, 0x40, 0x00,  // 去
+    0x00, 0x07, 0xF8, 0x20, 0x82, 0x08, 0x11, 0x00, 0xA0, 0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x80, 0x20, 0x00,  // 又
+    0x10, 0x01, 0x00, 0xFF, 0xE1, 0x00, 0x3F, 0x83, 0x08, 0x49, 0x04, 0x60, 0x86, 0x01, 0x98, 0x60, 0x60, 0x00,  // 友
+    0x22, 0x04, 0x24, 0xFF, 0xE0, 0x40, 0x0F, 0xE0, 0xC4, 0x14, 0x81, 0x30, 0x23, 0x04, 0xCC, 0xB0, 0x60, 0x00,  // 发
+    0xFC, 0x04, 0x80, 0x7B, 0xE4, 0xA2, 0x79, 0x44, 0x94, 0x48, 0x87, 0x88, 0xC9, 0x40, 0xA2, 0x08, 0x00, 0x00,  // 取
+    0x04, 0x0F, 0xFE, 0x15, 0x02, 0x48, 0x44, 0x43, 0xF8, 0x11, 0x00, 0xA0, 0x04, 0x01, 0xB0, 0xE0, 0xE0, 0x00,  // 变
+    0x7F, 0xC4, 0x04, 0x40, 0x44, 0x04, 0x7F, 0xC0, 0x00, 0x11, 0x02, 0x08, 0x40, 0x48, 0x02, 0x00, 0x00, 0x00,  // 只
+    0xFF, 0xE0, 0x04, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x04, 0x00, 0x40, 0x04, 0x01, 0x80, 0x00,  // 可
+    0x08, 0x00, 0x80, 0xFF, 0xE1, 0x00, 0x3F, 0x86, 0x08, 0xA0, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x00, 0x00, 0x00,  // 右
+    0x3F, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x00, 0x0F, 0xFE, 0x10, 0x03, 0xF8, 0x00, 0x80, 0x08, 0x03, 0x00, 0x00,  // 号
+    0x04, 0x00, 0xFE, 0xE8, 0x0A, 0x7C, 0xA0, 0x0A, 0xFC, 0xE0, 0x80, 0x10, 0x02, 0x00, 0x42, 0x07, 0xE0, 0x00,  // 吃
+    0xFF, 0xE8, 0x02, 0xBF, 0xA8, 0x02, 0xBF, 0xAA, 0x0A, 0xA0, 0xAB, 0xFA, 0x80, 0x28, 0x02, 0x80, 0xE0, 0x00,  // 同
+    0x00, 0xC7, 0xF0, 0x40, 0x07, 0xFE, 0x40, 0x04, 0x00, 0x5F, 0xC5, 0x04, 0x90, 0x49, 0x04, 0x1F, 0xC0, 0x00,  // 后
+    0x08, 0x01, 0x00, 0xFF, 0xE8, 0x02, 0xBF, 0xAA, 0x0A, 0xA0, 0xAB, 0xFA, 0x80, 0x28, 0x02, 0x80, 0xE0, 0x00,  // 向
+    0x0F, 0xC0, 0x04, 0xE4, 0x4A, 0x44, 0xA7, 0xEA, 0x02, 0xE0, 0x20, 0xFC, 0x00, 0x20, 0x02, 0x00, 0xC0, 0x00,  // 吗
+    0xFF, 0xE0, 0x20, 0x05, 0x01, 0xA8, 0x62, 0x48, 0x22, 0x3F, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x00, 0x00, 0x00,  // 否
+    0x0F, 0xC0, 0x92, 0xE9, 0x2A, 0x92, 0xAF, 0xEA, 0x80, 0xE8, 0x00, 0x82, 0x08, 0x20, 0x7E, 0x00, 0x00, 0x00,  // 吧
+    0x00, 0x40, 0x38, 0xE4, 0x0A, 0x40, 0xA7, 0xEA, 0x48, 0xE4, 0x80, 0x88, 0x08, 0x80, 0x08, 0x00, 0x80, 0x00,  // 听
+    0x04, 0x07, 0xFC, 0x40, 0x44, 0x04, 0x7F, 0xC4, 0x00, 0x5F, 0xC5, 0x04, 0x90, 0x49, 0xFC, 0x00, 0x00, 0x00,  // 启
+    0x0F, 0xE0, 0x24, 0xE4, 0x4A, 0xFE, 0xA0, 0xCA, 0x14, 0xE2, 0x40, 0x44, 0x08, 0x40, 0x04, 0x01, 0x80, 0x00,  // 呀
+    0x14, 0x02, 0x40, 0x7F, 0x08, 0x40, 0xFF, 0xE0, 0x00, 0x3F, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x00, 0x00, 0x00,  // 告
+    0x0F, 0xE0, 0x82, 0xEF, 0xEA, 0x80, 0xAA, 0x2A, 0xA4, 0xEB, 0x00, 0xA0, 0x0A, 0x20, 0xA2, 0x09, 0xC0, 0x00,  // 呢
+    0x7F, 0xC4, 0x04, 0x44, 0x45, 0xF4, 0x44, 0x45, 0xF4, 0x40, 0x45, 0xF4, 0x51, 0x49, 0xF4, 0x80, 0xC0, 0x00,  // 周
+    0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x9F, 0x20, 0x00, 0x7B, 0xC4, 0xA4, 0x4A, 0x47, 0xAC, 0x02, 0x00, 0x00,  // 命
+    0x18, 0x0E, 0x00, 0x20, 0x0F, 0xBE, 0x22, 0x27, 0x22, 0xAA, 0x22, 0x3E, 0x20, 0x02, 0x00, 0x20, 0x00, 0x00,  // 和
+    0x01, 0x00, 0x28, 0xE4, 0x4A, 0xBA, 0xA0, 0x0A, 0xFE, 0xE8, 0x20, 0x82, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,  // 哈
+    0x02, 0x40, 0xC6, 0xE4, 0x4A, 0xFE, 0xA4, 0x4A, 0x6A, 0xEC, 0x40, 0x4A, 0x05, 0x20, 0xC0, 0x00, 0x00, 0x00,  // 哦
+    0x0E, 0xE0, 0x4A, 0xEE, 0xCA, 0x4A, 0xAE, 0xAA, 0x4C, 0xE4, 0x80, 0x88, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,  // 哪
+    0xF3, 0xC9, 0x24, 0x92, 0x4F, 0x3C, 0x00, 0x8F, 0xFE, 0x04, 0x00, 0xA0, 0x11, 0x06, 0x0C, 0x80, 0x20, 0x00,  // 哭
+    0x07, 0xC0, 0x44, 0xE7, 0xCA, 0x44, 0xA7, 0xCA, 0x00, 0xEF, 0xE0, 0x82, 0x0F, 0xE0, 0x82, 0x0F, 0xE0, 0x00,  // 唱
+    0x0E, 0x00, 0xBE, 0xEC, 0x2A, 0xBA, 0xAA, 0xAA, 0xEA, 0xEB, 0xA0, 0x82, 0x08, 0x20, 0x82, 0x08, 0xC0, 0x00,  // 啊
+    0x0F, 0xE0, 0x82, 0xEF, 0xEA, 0x80, 0xAF, 0xEA, 0x90, 0xEA, 0x40, 0xFE, 0x08, 0x80, 0xBE, 0x0F, 0xE0, 0x00,  // 喔
+    0x04, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x20, 0x83, 0xF8, 0x11, 0x0F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 喜
+    0x07, 0xC0, 0x44, 0xE7, 0xCA, 0x44, 0xA7, 0xCA, 0x40, 0xEF, 0xE0, 0xA2, 0x03, 0x20, 0x4A, 0x08, 0x60, 0x00,  // 喝
+    0x0F, 0xE0, 0x92, 0xEB, 0xAA, 0xAA, 0xA8, 0x2A, 0xFE, 0xE0, 0x00, 0x50, 0x09, 0x40, 0x92, 0x01, 0xC0, 0x00,  // 嗯
+    0x0F, 0xE0, 0xAA, 0xE9, 0x2A, 0xFE, 0xA1, 0x0A, 0xFE, 0xE1, 0x00, 0xFE, 0x00, 0x00, 0xAA, 0x0A, 0xA0, 0x00,  // 嘿
+    0xF7, 0x89, 0x48, 0xF7, 0x80, 0x10, 0xFF, 0xE0, 0xA0, 0x31, 0x8F, 0x1E, 0x91, 0x29, 0x12, 0xF1, 0xE0, 0x00,  // 器
+    0x00, 0x0F, 0xFE, 0x8A, 0x28, 0xA2, 0x8A, 0x29, 0x22, 0x92, 0x2A, 0x1E, 0xC0, 0x28, 0x02, 0xFF, 0xE0, 0x00,  // 四
+    0xFF, 0xE8, 0x02, 0x80, 0x29, 0xF2, 0x91, 0x29, 0x12, 0x9F, 0x28, 0x02, 0x80, 0x28, 0x02, 0xFF, 0xE0, 0x00,  // 回
+    0xFF, 0xE8, 0x42, 0x84, 0x2B, 0xFA, 0x84, 0x28, 0xA2, 0x91, 0x2A, 0x0A, 0x80, 0x28, 0x02, 0xFF, 0xE0, 0x00,  // 因
+    0xFF, 0xE8, 0x42, 0x84, 0x2B, 0xFA, 0x8E, 0x29, 0x52, 0xA4, 0xA8, 0x42, 0x84, 0x28, 0x02, 0xFF, 0xE0, 0x00,  // 困
+    0xFF, 0xE8, 0x02, 0xBF, 0xA8, 0x42, 0x84, 0x29, 0xF2, 0x85, 0x28, 0x4A, 0xBF, 0xA8, 0x02, 0xFF, 0xE0, 0x00,  // 国
+    0xFF, 0xE8, 0x82, 0x9F, 0x2B, 0x12, 0x8A, 0x28, 0x42, 0x9B, 0x2A, 0x0A, 0x8C, 0x28, 0x32, 0xFF, 0xE0, 0x00,  // 图
+    0x10, 0x0F, 0xFE, 0x20, 0x04, 0x20, 0x42, 0x0D, 0xFC, 0x42, 0x04, 0x20, 0x42, 0x04, 0x20, 0x5F, 0xC0, 0x00,  // 在
+    0x02, 0x04, 0x20, 0x4A, 0x04, 0xBC, 0xEE, 0x44, 0xA4, 0x4A, 0xC4, 0xA0, 0x68, 0x2C, 0x82, 0x07, 0xC0, 0x00,  // 地
+    0x01, 0x04, 0x10, 0x41, 0x04, 0x1E, 0xE5, 0x04, 0x50, 0x45, 0x04, 0x50, 0x65, 0x0C, 0xFE, 0x00, 0x00, 0x00,  // 址
+    0x0F, 0xE4, 0x08, 0x41, 0x04, 0x30, 0xE5, 0x44, 0x92, 0x41, 0x04, 0x10, 0x61, 0x0C, 0x10, 0x00, 0x00, 0x00,  // 坏
+    0x04, 0x0F, 0xFE, 0x04, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x40, 0x47, 0xFC, 0x40, 0x08, 0x00, 0x80, 0x00, 0x00,  // 声
+    0x10, 0x03, 0xF8, 0x51, 0x00, 0xA0, 0x31, 0x8C, 0x06, 0x7F, 0xC4, 0x44, 0x7F, 0xC4, 0x44, 0x7F, 0xC0, 0x00,  // 备
+    0x20, 0x07, 0xFC, 0xA0, 0x83, 0xF8, 0x20, 0x83, 0xF8, 0x10, 0x03, 0xF0, 0x51, 0x00, 0xE0, 0x71, 0xC0, 0x00,  // 复
+    0xFF, 0xE0, 0x40, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x81, 0x00, 0x3F, 0x04, 0xE0, 0x71, 0xC0, 0x00,  // 夏
+    0x21, 0x02, 0x10, 0x7D, 0x04, 0x58, 0xA9, 0x41, 0x12, 0x21, 0x04, 0x10, 0x81, 0x00, 0x10, 0x01, 0x00, 0x00,  // 外
+    0x08, 0x01, 0xF8, 0x20, 0x85, 0x10, 0x0A, 0x01, 0x40, 0x6F, 0xC1, 0x04, 0x28, 0x80, 0x30, 0x78, 0x00, 0x00,  // 多
+    0x04, 0x00, 0x40, 0x04, 0x0F, 0xFE, 0x04, 0x00, 0xA0, 0x0A, 0x01, 0x10, 0x20, 0x84, 0x04, 0x80, 0x20, 0x00,  // 大
+    0x7F, 0xC0, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x0A, 0x01, 0x10, 0x20, 0x84, 0x04, 0x80, 0x20, 0x00,  // 天
+    0x04, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x0A, 0x00, 0xA0, 0x11, 0x01, 0x10, 0x28, 0x84, 0x44, 0x80, 0x20, 0x00,  // 太
+    0x24, 0x02, 0x40, 0x7F, 0x84, 0x40, 0x84, 0x0F, 0xFE, 0x0A, 0x01, 0x10, 0x20, 0x84, 0x04, 0x80, 0x20, 0x00,  // 失
+    0x12, 0x00, 0xA0, 0x42, 0x02, 0x20, 0x02, 0x0F, 0xFE, 0x05, 0x00, 0x88, 0x10, 0x46, 0x02, 0x80, 0x00, 0x00,  // 头
+    0x41, 0x04, 0x10, 0xF5, 0xE9, 0x72, 0x95, 0x2A, 0x56, 0x45, 0x06, 0x42, 0x94, 0x20, 0x3C, 0x00, 0x00, 0x00,  // 她
+    0x47, 0xC4, 0x04, 0xF0, 0x89, 0x10, 0x97, 0xEA, 0x10, 0x41, 0x06, 0x10, 0x91, 0x00, 0x10, 0x03, 0x00, 0x00,  // 好
+    0x40, 0x04, 0x00, 0xF7, 0xE9, 0x42, 0x94, 0x2A, 0x42, 0x44, 0x26, 0x7E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,  // 如
+    0x41, 0x04, 0x20, 0xF4, 0x49, 0x7E, 0x90, 0x0A, 0x7E, 0x44, 0x26, 0x42, 0x97, 0xE0, 0x00, 0x00, 0x00, 0x00,  // 始
+    0x7F, 0x00, 0x10, 0x02, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x18, 0x00, 0x00,  // 子
+    0x08, 0x0F, 0xFE, 0x10, 0x02, 0xFC, 0x60, 0x8A, 0x10, 0x2F, 0xE2, 0x10, 0x21, 0x02, 0x10, 0x23, 0x00, 0x00,  // 存
+    0x48, 0x82, 0x50, 0xFF, 0xE8, 0x02, 0x3F, 0x80, 0x20, 0x04, 0x0F, 0xFE, 0x04, 0x00, 0x40, 0x1C, 0x00, 0x00,  // 学
+    0x04, 0x0F, 0xFE, 0x80, 0x22, 0x08, 0x23, 0x02, 0xC0, 0x30, 0x02, 0x00, 0x20, 0x42, 0x04, 0x1F, 0x80, 0x00,  // 它
+    0x04, 0x0F, 0xFE, 0x80, 0x20, 0x80, 0x10, 0x0F, 0xFE, 0x20, 0x84, 0x10, 0x3A, 0x00, 0x60, 0x79, 0xC0, 0x00,  // 安
+    0x04, 0x0F, 0xFE, 0x80, 0x23, 0xF8, 0x00, 0x0F, 0xFE, 0x11, 0x01, 0x10, 0x21, 0x24, 0x12, 0x80, 0xC0, 0x00,  // 完
+    0x04, 0x0F, 0xFE, 0x80, 0x23, 0xF8, 0x04, 0x02, 0x40, 0x27, 0xC2, 0x40, 0x54, 0x04, 0xC0, 0x87, 0xE0, 0x00,  // 定
+    0x04, 0x0F, 0xFE, 0x80, 0x27, 0xFC, 0x04, 0x00, 0x40, 0x3F, 0x80, 0x50, 0x04, 0x80, 0x40, 0xFF, 0xE0, 0x00,  // 宝
+    0x04, 0x0F, 0xFE, 0x80, 0x22, 0x40, 0x14, 0x04, 0x40, 0x24, 0x0F, 0xFE, 0x05, 0x01, 0x88, 0xE0, 0xC0, 0x00,  // 实
+    0x04, 0x0F, 0xFE, 0x80, 0x2F, 0xFE, 0x0C, 0x03, 0x24, 0xC9, 0x81, 0x60, 0x2B, 0x05, 0x28, 0x92, 0x60, 0x00,  // 家
+    0x04, 0x0F, 0xFE, 0x80, 0x22, 0x20, 0xFF, 0xE3, 0xF8, 0x24, 0x82, 0x48, 0x0A, 0x01, 0x22, 0x61, 0xE0, 0x00,  // 宽
+    0x00, 0x80, 0x08, 0xFB, 0xE0, 0x88, 0x92, 0x85, 0x18, 0x20, 0x85, 0x08, 0x88, 0x80, 0x18, 0x00, 0x00, 0x00,  // 对
+    0x21, 0x02, 0x3E, 0xA4, 0x46, 0xA8, 0x21, 0x06, 0x60, 0xAF, 0xE2, 0x08, 0x24, 0x82, 0x28, 0x21, 0x80, 0x00,  // 将
+    0x04, 0x00, 0x40, 0x04, 0x02, 0x48, 0x24, 0x44, 0x44, 0x44, 0x28, 0x42, 0x04, 0x00, 0x40, 0x18, 0x00, 0x00,  // 小
+    0x04, 0x00, 0x40, 0x24, 0x84, 0x44, 0x84, 0x20, 0x44, 0x00, 0x40, 0x08, 0x03, 0x01, 0xC0, 0xC0, 0x00, 0x00,  // 少
+    0x21, 0x4F, 0x92, 0x03, 0xE7, 0x18, 0x51, 0x87, 0x28, 0x22, 0x8A, 0xA8, 0xAC, 0xA6, 0x8A, 0x10, 0x60, 0x00,  // 就
+    0xFF, 0xC8, 0x04, 0xFF, 0xC9, 0x08, 0x89, 0x0B, 0xF8, 0x89, 0x0B, 0xFC, 0x89, 0x09, 0x10, 0xA1, 0x00, 0x00,  // 屏
+    0x00, 0x07, 0xFC, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x00,  // 工
+    0x10, 0x01, 0x00, 0xFF, 0xE2, 0x00, 0x20, 0x05, 0xFC, 0x42, 0x08, 0x20, 0x02, 0x00, 0x20, 0x3F, 0xE0, 0x00,  // 左
+    0x7F, 0x80, 0x08, 0x00, 0x84, 0x08, 0x7F, 0xC4, 0x00, 0x40, 0x04, 0x00, 0x40, 0x24, 0x02, 0x3F, 0xC0, 0x00,  // 已
+    0x42, 0x04, 0x20, 0x5F, 0xED, 0x22, 0x52, 0x25, 0x22, 0x52, 0x25, 0x26, 0x82, 0x08, 0x20, 0x02, 0x00, 0x00,  // 帅
+    0x41, 0x02, 0x20, 0x1C, 0x06, 0x30, 0x08, 0x0F, 0xFE, 0x20, 0x05, 0xFC, 0xD2, 0x45, 0x2C, 0x42, 0x00, 0x00,  // 希
+    0x23, 0xCF, 0xA4, 0x22, 0x8F, 0xA4, 0x4A, 0xC8, 0xA0, 0x3F, 0x82, 0x48, 0x24, 0x82, 0x58, 0x04, 0x00, 0x00,  // 帮
+    0x44, 0x42, 0x48, 0xFF, 0xE8, 0x02, 0x1F, 0x01, 0x10, 0x3F, 0x82, 0x48, 0x24, 0x82, 0x58, 0x04, 0x00, 0x00,  // 常
+    0x20, 0x8F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x8F, 0xFE, 0x11, 0x06, 0x4C, 0x3F, 0x82, 0x48, 0x25, 0x80, 0x00,  // 幕
+    0x20, 0x02, 0x00, 0x7F, 0xC8, 0x40, 0x7F, 0x04, 0x40, 0x44, 0x0F, 0xFE, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 年
+    0x21, 0x01, 0x20, 0x7F, 0xC1, 0x10, 0x11, 0x0F, 0xFE, 0x11, 0x01, 0x10, 0x21, 0x04, 0x10, 0x81, 0x00, 0x00,  // 并
+    0x04, 0x07, 0xFE, 0x40, 0x04, 0x44, 0x52, 0x45, 0x24, 0x48, 0x84, 0x88, 0x40, 0x8B, 0xFE, 0x80, 0x00, 0x00,  // 应
+    0x04, 0x07, 0xFE, 0x48, 0x87, 0xFC, 0x48, 0x84, 0xF8, 0x40, 0x05, 0xF8, 0x48, 0x88, 0x70, 0xB8, 0xE0, 0x00,  // 度
+    0x7F, 0xC1, 0x10, 0x11, 0x01, 0x10, 0xFF, 0xE1, 0x10, 0x11, 0x02, 0x10, 0x21, 0x04, 0x10, 0x81, 0x00, 0x00,  // 开
+    0x04, 0x0F, 0xFE, 0x08, 0x01, 0x10, 0x3F, 0x81, 0x10, 0xFF, 0xE1, 0x10, 0x11, 0x02, 0x10, 0xC1, 0x00, 0x00,  // 弃
+    0x44, 0x42, 0x48, 0x15, 0x03, 0xF8, 0x00, 0x80, 0x08, 0x3F, 0x80, 0x08, 0x00, 0x83, 0xF8, 0x00, 0x00, 0x00,  // 当
+    0x27, 0xC4, 0x44, 0x87, 0xC2, 0x44, 0x67, 0xCA, 0x48, 0x24, 0x62, 0x58, 0x26, 0x42, 0x82, 0x20, 0x00, 0x00,  // 很
+    0x27, 0xC4, 0x44, 0x87, 0xC2, 0x44, 0x67, 0xCA, 0xFE, 0x20, 0x82, 0xFE, 0x24, 0x82, 0x28, 0x21, 0x80, 0x00,  // 得
+    0x22, 0x44, 0xAE, 0x8E, 0xA2, 0x04, 0x6E, 0xAA, 0x0A, 0x26, 0x42, 0x54, 0x25, 0x42, 0x9A, 0x28, 0x00, 0x00,  // 微
+    0x00, 0x00, 0x80, 0x04, 0x00, 0x20, 0x40, 0x04, 0x44, 0x44, 0x48, 0x42, 0x84, 0x20, 0x42, 0x07, 0xC0, 0x00,  // 心
+    0x08, 0x00, 0x44, 0x00, 0x81, 0x10, 0x12, 0x05, 0x48, 0x58, 0x49, 0x04, 0x30, 0x25, 0x00, 0x1F, 0xC0, 0x00,  // 必
+    0x04, 0x0F, 0xFE, 0x20, 0x02, 0x00, 0x20, 0x03, 0xFC, 0x00, 0x00, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 忘
+    0x41, 0x06, 0x10, 0xCF, 0xE4, 0x40, 0x44, 0x04, 0x40, 0x44, 0x04, 0x40, 0x44, 0x04, 0x7E, 0x40, 0x00, 0x00,  // 忙
+    0x41, 0x06, 0x10, 0xCF, 0xC4, 0x14, 0x41, 0x44, 0xFE, 0x41, 0x04, 0x28, 0x44, 0x44, 0x82, 0x40, 0x00, 0x00,  // 快
+    0x04, 0x0F, 0xFE, 0x04, 0x00, 0xA0, 0x15, 0x06, 0x2C, 0x00, 0x00, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 态
+    0x20, 0x07, 0xFC, 0x88, 0x00, 0xFC, 0x08, 0x00, 0xFC, 0x08, 0x00, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 怎
+    0x27, 0xC2, 0x24, 0xFA, 0x45, 0x28, 0x21, 0x05, 0x28, 0x8C, 0x40, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 怒
+    0x3F, 0x82, 0x48, 0x24, 0x83, 0xF8, 0x24, 0x83, 0xF8, 0x00, 0x00, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 思
+    0x20, 0x81, 0x10, 0x3F, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x00, 0x00, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 总
+    0x4F, 0xE6, 0x80, 0xC8, 0x84, 0xAA, 0x4A, 0xA4, 0x88, 0x48, 0x84, 0x94, 0x49, 0x44, 0x42, 0x48, 0x00, 0x00,  // 恢
+    0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 息
+    0x24, 0x02, 0xFC, 0x68, 0x4A, 0x20, 0x2A, 0x82, 0x24, 0x26, 0x00, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 您
+    0x41, 0x06, 0xFE, 0xC1, 0x04, 0x7C, 0x41, 0x04, 0xFE, 0x47, 0xC4, 0x44, 0x47, 0xC4, 0x44, 0x44, 0xC0, 0x00,  // 情
+    0x41, 0x06, 0xFE, 0xC0, 0x04, 0x7C, 0x44, 0x44, 0x7C, 0x41, 0x04, 0x54, 0x49, 0x24, 0x10, 0x46, 0x00, 0x00,  // 惊
+    0x23, 0xEF, 0xA2, 0x23, 0xE7, 0x22, 0xAB, 0xE2, 0x22, 0x23, 0xE0, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 想
+    0x04, 0x07, 0xFC, 0x11, 0x0F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 意
+    0x02, 0x87, 0xFC, 0x42, 0x05, 0xD2, 0x54, 0xC5, 0xD8, 0x82, 0x60, 0x40, 0x22, 0x45, 0x04, 0x9F, 0xA0, 0x00,  // 感
+    0x41, 0x06, 0xFE, 0xC5, 0x44, 0xFE, 0x40, 0x04, 0x7C, 0x45, 0x44, 0x54, 0x45, 0x44, 0x28, 0x4C, 0x60, 0x00,  // 愤
+    0x44, 0x46, 0xFE, 0xC4, 0x44, 0xFE, 0x47, 0xC4, 0x54, 0x47, 0xC4, 0x54, 0x47, 0xC4, 0x10, 0x4F, 0xE0, 0x00,  // 懂
+    0x02, 0x80, 0x24, 0xF7, 0xE1, 0x20, 0x92, 0x45, 0x28, 0x21, 0x05, 0x28, 0x94, 0x40, 0x42, 0x00, 0x00, 0x00,  // 戏
+    0x02, 0x80, 0x24, 0x7F, 0xE4, 0x20, 0x42, 0x47, 0xA8, 0x49, 0x04, 0xAA, 0x94, 0x6B, 0x02, 0x00, 0x00, 0x00,  // 成
+    0x1A, 0x0E, 0x28, 0x22, 0x4F, 0xFE, 0x22, 0x42, 0x28, 0x31, 0x0E, 0x2A, 0x24, 0x62, 0x82, 0xC0, 0x00, 0x00,  // 我
+    0x10, 0x6E, 0x38, 0x02, 0x0F, 0x20, 0x93, 0xE9, 0x24, 0xF2, 0x48, 0x44, 0x84, 0x48, 0x84, 0x10, 0x40, 0x00,  // 所
+    0x01, 0xC7, 0xC0, 0x04, 0x07, 0xFC, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x1C, 0x00, 0x00,  // 手
+    0x4F, 0xE4, 0x10, 0xE1, 0x04, 0x10, 0x41, 0x06, 0x10, 0xC1, 0x04, 0x10, 0x41, 0x04, 0x10, 0xC6, 0x00, 0x00,  // 打
+    0x42, 0x04, 0x20, 0xEF, 0x84, 0x28, 0x42, 0x86, 0x58, 0xC4, 0x84, 0x88, 0x48, 0xA4, 0x0A, 0xC0, 0x40, 0x00,  // 执
+    0x4F, 0xC4, 0x92, 0xE9, 0x24, 0x92, 0x4F, 0xE6, 0x80, 0xC8, 0x04, 0x82, 0x48, 0x24, 0x7E, 0xC0, 0x00, 0x00,  // 把
+    0x4F, 0xE4, 0x80, 0xE8, 0x04, 0xF8, 0x48, 0x86, 0x88, 0xCF, 0x84, 0x80, 0x48, 0x04, 0xFE, 0xC0, 0x00, 0x00,  // 拒
+    0x41, 0x04, 0x7C, 0xE1, 0x44, 0xFE, 0x42, 0x06, 0x7E, 0xCA, 0x04, 0x3E, 0x40, 0x24, 0x04, 0xC1, 0x80, 0x00,  // 拷
+    0x48, 0x44, 0x98, 0xEE, 0x04, 0x82, 0x47, 0xC6, 0xFE, 0xC8, 0x24, 0xFE, 0x48, 0x24, 0x82, 0xCF, 0xE0, 0x00,  // 指
+    0x44, 0x04, 0x78, 0xE8, 0x84, 0xFC, 0x47, 0xC6, 0x54, 0xC5, 0x44, 0xFE, 0x41, 0x04, 0x28, 0xCC, 0x60, 0x00,  // 换
+    0x42, 0x84, 0xEE, 0xE2, 0x84, 0x28, 0x4E, 0xE6, 0x28, 0xC2, 0x84, 0xEE, 0x44, 0x84, 0x48, 0xC8, 0x80, 0x00,  // 排
+    0x41, 0x04, 0xFE, 0xE4, 0x44, 0x28, 0x4F, 0xE6, 0x20, 0xCF, 0xE4, 0x44, 0x42, 0x84, 0x10, 0xCC, 0x60, 0x00,  // 接
+    0x47, 0xC4, 0x44, 0xE7, 0xC4, 0x44, 0x47, 0xC6, 0xFE, 0xC1, 0x04, 0x5E, 0x45, 0x04, 0xB0, 0xC9, 0xE0, 0x00,  // 提
+    0x43, 0x84, 0x28, 0xE3, 0x84, 0xEE, 0x4A, 0xA6, 0xEE, 0xC1, 0x04, 0xFE, 0x43, 0x84, 0x54, 0xC9, 0x20, 0x00,  // 操
+    0x22, 0x02, 0x20, 0xA7, 0xEA, 0x44, 0xA8, 0x4A, 0x28, 0xA2, 0x8F, 0x10, 0x22, 0x82, 0x44, 0x28, 0x20, 0x00,  // 收
+    0x22, 0x0F, 0xA0, 0x57, 0xE8, 0xC4, 0x54, 0x42, 0xA8, 0x22, 0x85, 0x10, 0x8A, 0x80, 0x24, 0x04, 0x20, 0x00,  // 效
+    0xAA, 0x07, 0x20, 0xFB, 0xE7, 0x64, 0xAD, 0x42, 0x14, 0xF9, 0x44, 0x88, 0x31, 0x44, 0xA2, 0x80, 0x00, 0x00,  // 数
+    0x04, 0x00, 0x40, 0xFF, 0xE2, 0x08, 0x20, 0x81, 0x10, 0x0A, 0x00, 0x40, 0x0A, 0x03, 0x18, 0xC0, 0x60, 0x00,  // 文
+    0xA8, 0x6A, 0x98, 0x91, 0x0F, 0x90, 0xB9, 0xEA, 0x94, 0x91, 0x48, 0x14, 0xFD, 0x40, 0x24, 0x04, 0x40, 0x00,  // 断
+    0x20, 0x6F, 0xB8, 0x52, 0x0F, 0xA0, 0x23, 0xEF, 0xA4, 0x22, 0x47, 0x24, 0xAA, 0x42, 0x44, 0x28, 0x40, 0x00,  // 新
+    0x04, 0x00, 0x40, 0xFF, 0xE1, 0x00, 0x1F, 0xC1, 0x04, 0x20, 0x42, 0x04, 0x40, 0x48, 0x04, 0x03, 0x80, 0x00,  // 方
+    0x04, 0x0F, 0xFE, 0x20, 0x81, 0x10, 0xFF, 0xE8, 0x02, 0x04, 0x0F, 0xFE, 0x1F, 0x82, 0x08, 0xC1, 0x80, 0x00,  // 旁
+    0x7F, 0xC0, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0xC0, 0x0A, 0x01, 0x20, 0x22, 0x24, 0x22, 0x81, 0xC0, 0x00,  // 无
+    0x3F, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 日
+    0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x40, 0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 早
+    0x00, 0x8E, 0x08, 0xAF, 0xEA, 0x08, 0xE4, 0x8A, 0x28, 0xA0, 0x8E, 0x08, 0x00, 0x80, 0x08, 0x03, 0x00, 0x00,  // 时
+    0x07, 0xCE, 0x44, 0xA4, 0x4A, 0x7C, 0xE4, 0x4A, 0x44, 0xA7, 0xCE, 0x44, 0x04, 0x40, 0x84, 0x09, 0x80, 0x00,  // 明
+    0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x40, 0x7F, 0xC8, 0x40, 0x3F, 0x80, 0x40, 0xFF, 0xE0, 0x00,  // 星
+    0x04, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x04, 0x0F, 0xFE, 0x0A, 0x03, 0x18, 0xDF, 0x61, 0x10, 0x1F, 0x00, 0x00,  // 春
+    0x04, 0x0E, 0x40, 0xAF, 0xEA, 0xA0, 0xE2, 0x0A, 0x3E, 0xA2, 0x0E, 0x20, 0x03, 0xE0, 0x20, 0x02, 0x00, 0x00,  // 昨
+    0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x8F, 0xFE, 0x04, 0x02, 0x7C, 0x24, 0x05, 0x40, 0x8F, 0xC0, 0x00,  // 是
+    0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00, 0x11, 0x09, 0x12, 0x51, 0x41, 0x10, 0xFF, 0xE0, 0x00,  // 显
+    0x04, 0x0E, 0x78, 0xA8, 0x8A, 0x7C, 0xE5, 0x4A, 0x54, 0xA7, 0xCE, 0x28, 0x04, 0xA0, 0x8A, 0x00, 0xC0, 0x00,  // 晚
+    0x01, 0x0E, 0xFE, 0xA1, 0x0A, 0x7C, 0xE1, 0x0A, 0xFE, 0xA7, 0xCE, 0x44, 0x07, 0xC0, 0x44, 0x04, 0xC0, 0x00,  // 晴
+    0x00, 0xCE, 0xF0, 0xA5, 0x4A, 0xFE, 0xE2, 0x0A, 0xFE, 0xA4, 0x0E, 0x7C, 0x0A, 0x80, 0x90, 0x02, 0xC0, 0x00,  // 暖
+    0x21, 0x07, 0xBC, 0x21, 0x0F, 0xBE, 0x51, 0x48, 0xA2, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 替
+    0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x8F, 0xFE, 0x57, 0x87, 0x28, 0x52, 0x87, 0x10, 0xD6, 0xC0, 0x00,  // 最
+    0x3F, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x40, 0x84, 0x08, 0x83, 0x80, 0x00,  // 月
+    0x10, 0x0F, 0xFE, 0x20, 0x07, 0xF0, 0x61, 0x0B, 0xF8, 0x21, 0x03, 0xF8, 0x21, 0x02, 0x10, 0x23, 0x00, 0x00,  // 有
+    0x7B, 0xC4, 0xA4, 0x7B, 0xC4, 0xA4, 0x7B, 0xC4, 0xA4, 0x4A, 0x44, 0xA4, 0x8A, 0x48, 0xC4, 0x11, 0x80, 0x00,  // 朋
+    0x47, 0x8F, 0x48, 0x47, 0x84, 0x48, 0x78, 0xC0, 0x40, 0x7F, 0xC0, 0x40, 0x3F, 0x80, 0x40, 0xFF, 0xE0, 0x00,  // 望
+    0x4B, 0xCF, 0xA4, 0x4B, 0xC7, 0xA4, 0x4B, 0xC7, 0xA4, 0x4A, 0x4F, 0xA4, 0x52, 0x48, 0xC4, 0x01, 0x80, 0x00,  // 期
+    0x04, 0x00, 0x40, 0x7F, 0xC0, 0x40, 0xFF, 0xE0, 0xE0, 0x15, 0x02, 0x48, 0x44, 0x48, 0x42, 0x04, 0x00, 0x00,  // 未
+    0x04, 0x0F, 0xFE, 0x04, 0x03, 0xF8, 0x0E, 0x01, 0x50, 0x24, 0x84, 0x44, 0x84, 0x20, 0x40, 0x04, 0x00, 0x00,  // 末
+    0x04, 0x00, 0x40, 0xFF, 0xE0, 0xE0, 0x0E, 0x01, 0x50, 0x24, 0x85, 0xF4, 0x84, 0x20, 0x40, 0x04, 0x00, 0x00,  // 本
+    0x40, 0x04, 0x38, 0xF2, 0x84, 0x28, 0xE2, 0x84, 0x28, 0x42, 0x84, 0x28, 0x44, 0xA4, 0x4A, 0x40, 0x40, 0x00,  // 机
+    0x04, 0x07, 0xFC, 0x04, 0x02, 0x48, 0x15, 0x0F, 0xFE, 0x0E, 0x01, 0x50, 0x24, 0x8C, 0x46, 0x04, 0x00, 0x00,  // 来
+    0x04, 0x0F, 0xFE, 0x0E, 0x03, 0x58, 0xC0, 0x63, 0xF8, 0x20, 0x83, 0xF8, 0x20, 0x83, 0xF8, 0xFF, 0xE0, 0x00,  // 查
+    0x40, 0x04, 0x7C, 0xF0, 0x04, 0x7E, 0xE1, 0x04, 0x10, 0x45, 0x44, 0x52, 0x41, 0x24, 0x10, 0x43, 0x00, 0x00,  // 标
+    0x41, 0x04, 0x7E, 0xF2, 0x44, 0x42, 0xE2, 0x44, 0x24, 0x41, 0x84, 0x18, 0x42, 0x44, 0x42, 0x40, 0x00, 0x00,  // 校
+    0x42, 0x24, 0x14, 0xF7, 0xE4, 0x08, 0xE0, 0x84, 0x3C, 0x40, 0x84, 0x7E, 0x40, 0x84, 0x08, 0x40, 0x80, 0x00,  // 样
+    0x04, 0x0F, 0xFE, 0x88, 0x2F, 0xFE, 0x11, 0x02, 0x60, 0x7C, 0xC0, 0x40, 0xFF, 0xE1, 0x50, 0x64, 0xC0, 0x00,  // 案
+    0x41, 0x84, 0x24, 0xF4, 0x24, 0x3C, 0xE0, 0x04, 0x48, 0x42, 0x44, 0x24, 0x40, 0x44, 0x7E, 0x40, 0x00, 0x00,  // 检
+    0x47, 0x24, 0x14, 0xF2, 0xA4, 0x42, 0xE7, 0xE4, 0x3C, 0x42, 0x44, 0x3C, 0x42, 0x44, 0x00, 0x47, 0xE0, 0x00,  // 橙
+    0x02, 0x00, 0x20, 0xFB, 0xE0, 0xA2, 0x94, 0xC5, 0x10, 0x21, 0x05, 0x10, 0x8A, 0x88, 0x24, 0x04, 0x20, 0x00,  // 欢
+    0xF9, 0x02, 0x10, 0xEB, 0xEA, 0xC4, 0xE9, 0x8F, 0x90, 0x21, 0x0E, 0x90, 0xAA, 0x8E, 0xC4, 0x18, 0x20, 0x00,  // 歌
+    0x04, 0x00, 0x40, 0x04, 0x00, 0x7C, 0x24, 0x02, 0x40, 0x24, 0x02, 0x40, 0x24, 0x02, 0x40, 0xFF, 0xE0, 0x00,  // 止
+    0xFF, 0xE0, 0x40, 0x04, 0x00, 0x40, 0x27, 0xC2, 0x40, 0x24, 0x02, 0x40, 0x24, 0x02, 0x40, 0xFF, 0xE0, 0x00,  // 正
+    0x22, 0x02, 0x20, 0x22, 0x43, 0xA8, 0x23, 0x0A, 0x20, 0xA2, 0x0A, 0x20, 0xA2, 0x2A, 0x22, 0xF9, 0xE0, 0x00,  // 此
+    0x04, 0x02, 0x78, 0x24, 0x02, 0x40, 0xFF, 0xE0, 0x40, 0x24, 0x84, 0x50, 0x8A, 0x01, 0x40, 0x60, 0x00, 0x00,  // 步
+    0x04, 0x0F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x8F, 0xFE, 0x80, 0x23, 0xF8, 0x01, 0x03, 0xF8, 0x03, 0xE0, 0x00,  // 毫
+    0x20, 0x07, 0xFC, 0x80, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x01, 0x00, 0x10, 0x01, 0x20, 0x0A, 0x00, 0x60, 0x00,  // 气
+    0x04, 0x00, 0x40, 0x04, 0x4F, 0x68, 0x15, 0x01, 0x50, 0x24, 0x82, 0x44, 0x44, 0x28, 0x40, 0x18, 0x00, 0x00,  // 水
+    0x87, 0x84, 0x48, 0x04, 0x80, 0x8E, 0x80, 0x04, 0xFC, 0x04, 0x42, 0x28, 0x21, 0x04, 0x6C, 0x88, 0x20, 0x00,  // 没
+    0x81, 0x04, 0x10, 0x07, 0xC0, 0x10, 0x8F, 0xE4, 0x20, 0x04, 0x82, 0x84, 0x2F, 0xC4, 0x02, 0x80, 0x00, 0x00,  // 法
+    0x89, 0x24, 0x54, 0x01, 0x00, 0x7C, 0x84, 0x44, 0x7C, 0x04, 0x42, 0x7C, 0x24, 0x44, 0x44, 0x84, 0xC0, 0x00,  // 消
+    0x81, 0x04, 0xFE, 0x01, 0x00, 0x7C, 0x81, 0x04, 0xFE, 0x07, 0xC2, 0x44, 0x27, 0xC4, 0x44, 0x84, 0xC0, 0x00,  // 清
+    0x87, 0xC4, 0x44, 0x07, 0xC0, 0x44, 0x87, 0xC4, 0x00, 0x0F, 0xE2, 0xAA, 0x2A, 0xA4, 0xAA, 0x8F, 0xE0, 0x00,  // 温
+    0x87, 0xC4, 0x44, 0x07, 0xC0, 0x44, 0x87, 0xC4, 0x40, 0x0F, 0xE2, 0xA2, 0x23, 0x24, 0x4A, 0x88, 0x60, 0x00,  // 渴
+    0x84, 0x84, 0x4E, 0x0E, 0x80, 0x90, 0x8E, 0xE4, 0xA2, 0x0A, 0x42, 0xBE, 0x2A, 0x44, 0x24, 0x8C, 0xC0, 0x00,  // 游
+    0x87, 0xC4, 0x44, 0x07, 0xC0, 0x44, 0x87, 0xC4, 0x28, 0x0A, 0xA2, 0x6C, 0x22, 0x84, 0xFE, 0x80, 0x00, 0x00,  // 湿
+    0x81, 0x04, 0xFE, 0x04, 0x40, 0x92, 0x82, 0x44, 0x7C, 0x02, 0x02, 0xFE, 0x22, 0x84, 0x44, 0x88, 0x20, 0x00,  // 滚
+    0x84, 0x44, 0xFE, 0x04, 0x40, 0xFE, 0x81, 0x04, 0xFE, 0x0A, 0xA2, 0xAA, 0x2D, 0x64, 0x82, 0x88, 0x60, 0x00,  // 满
+    0x8F, 0xE4, 0x28, 0x0F, 0xE0, 0xAA, 0x8F, 0xE4, 0x7C, 0x00, 0x02, 0xFE, 0x21, 0x04, 0x54, 0x8B, 0x20, 0x00,  // 漂
+    0xFF, 0xE0, 0x40, 0x04, 0x02, 0x48, 0x25, 0x00, 0x40, 0x04, 0x00, 0xA0, 0x11, 0x02, 0x08, 0xC0, 0x60, 0x00,  // 灭
+    0x27, 0xEA, 0x08, 0xB0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x50, 0x85, 0x08, 0x80, 0x80, 0x08, 0x03, 0x00, 0x00,  // 灯
+    0xFF, 0xE8, 0x00, 0x84, 0x0A, 0x48, 0xA5, 0x08, 0x40, 0x84, 0x08, 0xA0, 0x91, 0x06, 0x08, 0x80, 0x60, 0x00,  // 灰
+    0x04, 0x00, 0x7C, 0x04, 0x03, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x80, 0x00, 0x49, 0x28, 0x8A, 0x00, 0x00, 0x00,  // 点
+    0x22, 0x0F, 0x78, 0x22, 0x83, 0x48, 0xEB, 0x82, 0x0A, 0xC0, 0x60, 0x00, 0x49, 0x28, 0x8A, 0x00, 0x00, 0x00,  // 热
+    0x21, 0x47, 0x92, 0x8F, 0xE5, 0x10, 0x22, 0x84, 0x44, 0x98, 0x20, 0x00, 0x49, 0x28, 0x8A, 0x00, 0x00, 0x00,  // 然
+    0x21, 0x0A, 0x3C, 0xB2, 0x42, 0x3C, 0x22, 0x42, 0x3C, 0x51, 0x05, 0x48, 0x85, 0x20, 0x52, 0x01, 0xC0, 0x00,  // 熄
+    0x00, 0xC7, 0xF0, 0x24, 0x8F, 0xFE, 0x80, 0x22, 0x00, 0x7F, 0xC6, 0x08, 0x91, 0x00, 0xE0, 0x71, 0xC0, 0x00,  // 爱
+    0x81, 0x0A, 0x7C, 0xF1, 0x02, 0x7E, 0x30, 0x4E, 0x7E, 0x22, 0x42, 0x14, 0x20, 0x42, 0x04, 0x01, 0x80, 0x00,  // 特
+    0x22, 0x82, 0x24, 0xBF, 0xE6, 0x20, 0x22, 0x06, 0x50, 0xA5, 0x02, 0x88, 0x28, 0x83, 0x04, 0x20, 0x00, 0x00,  // 状
+    0x04, 0x0F, 0xFE, 0x08, 0x05, 0x28, 0x2D, 0x05, 0xE8, 0x80, 0xAF, 0xFE, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00,  // 率
+    0xE0, 0x04, 0x7C, 0x40, 0x04, 0xFE, 0xE2, 0x84, 0x28, 0x42, 0x84, 0x48, 0x64, 0xAC, 0x8A, 0x00, 0xC0, 0x00,  // 玩
+    0xEF, 0xC4, 0x84, 0x4A, 0x44, 0xA4, 0xEA, 0x44, 0xA4, 0x43, 0x04, 0x28, 0x64, 0xAC, 0x8A, 0x00, 0xC0, 0x00,  // 现
+    0xEF, 0xE4, 0x92, 0x4F, 0xE4, 0x92, 0xEF, 0xE4, 0x10, 0x47, 0xC4, 0x10, 0x61, 0x0C, 0xFE, 0x00, 0x00, 0x00,  // 理
+    0x24, 0x02, 0x40, 0x7F, 0xC8, 0x40, 0x04, 0x07, 0xFC, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x00,  // 生
+    0x7F, 0xC4, 0x44, 0x44, 0x47, 0xFC, 0x44, 0x44, 0x44, 0x7F, 0xC4, 0x44, 0x44, 0x48, 0x44, 0x85, 0xC0, 0x00,  // 用
+    0x04, 0x07, 0xFC, 0x44, 0x44, 0x44, 0x7F, 0xC4, 0x44, 0x44, 0x47, 0xFC, 0x04, 0x20, 0x42, 0x03, 0xC0, 0x00,  // 电
+    0x04, 0x00, 0x80, 0x7F, 0xC4, 0x04, 0x40, 0x44, 0x04, 0x7F, 0xC4, 0x04, 0x40, 0x44, 0x04, 0x7F, 0xC0, 0x00,  // 白
+    0xFF, 0xE0, 0x40, 0x08, 0x07, 0xFC, 0x40, 0x44, 0x04, 0x7F, 0xC4, 0x04, 0x40, 0x44, 0x04, 0x7F, 0xC0, 0x00,  // 百
+    0x22, 0x04, 0x40, 0xF7, 0xE9, 0x42, 0x96, 0x2F, 0x22, 0x92, 0x29, 0x02, 0x90, 0x2F, 0x04, 0x00, 0xC0, 0x00,  // 的
+    0x3F, 0x82, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 目
+    0x04, 0x0F, 0xFE, 0x04, 0x05, 0xF0, 0x51, 0x05, 0xF0, 0x51, 0x05, 0xF0, 0x51, 0x05, 0xF0, 0x7F, 0xC0, 0x00,  // 直
+    0x47, 0xE4, 0x42, 0xF4, 0x24, 0x7E, 0xE4, 0x24, 0x42, 0x47, 0xE4, 0x42, 0x44, 0x24, 0x7E, 0x40, 0x00, 0x00,  // 相
+    0x00, 0xC7, 0xE0, 0x08, 0x0F, 0xFC, 0x10, 0x03, 0xF8, 0x60, 0x8B, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 看
+    0x04, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x20, 0x83, 0xF8, 0x20, 0x83, 0xF8, 0xFF, 0xE1, 0x10, 0x60, 0xC0, 0x00,  // 真
+    0x22, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x04, 0x0F, 0xFE, 0x1F, 0xC3, 0x04, 0x5F, 0xC9, 0x04, 0x1F, 0xC0, 0x00,  // 着
+    0xE0, 0xCA, 0xF0, 0xA1, 0x0E, 0xFE, 0xA5, 0x4A, 0x7C, 0xE5, 0x4A, 0x10, 0xA7, 0xCE, 0x10, 0x0F, 0xE0, 0x00,  // 睡
+    0x40, 0x07, 0x80, 0xA3, 0xEF, 0xA2, 0x22, 0x22, 0x22, 0x52, 0x24, 0xA2, 0x87, 0xE0, 0x22, 0x00, 0x00, 0x00,  // 知
+    0xF7, 0xC4, 0x04, 0x42, 0x48, 0x24, 0xE3, 0xEA, 0x02, 0xA0, 0x2A, 0x7E, 0xE0, 0x20, 0x02, 0x00, 0xC0, 0x00,  // 码
+    0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x04, 0x02, 0x48, 0x24, 0x84, 0x44, 0x44, 0x48, 0x42, 0x1C, 0x00, 0x00,  // 示
+    0x31, 0x0C, 0x52, 0x45, 0x4F, 0x10, 0x41, 0x0E, 0x10, 0xE2, 0x85, 0x28, 0x44, 0x44, 0x42, 0x40, 0x00, 0x00,  // 秋
+    0x31, 0x0C, 0x10, 0x47, 0xEF, 0x52, 0x45, 0x2E, 0x52, 0xE7, 0xE5, 0x10, 0x41, 0x04, 0x10, 0x41, 0x00, 0x00,  // 种
+    0x31, 0x0C, 0x10, 0x45, 0x4F, 0x52, 0x41, 0x2E, 0x02, 0xE0, 0x45, 0x08, 0x41, 0x04, 0x60, 0x40, 0x00, 0x00,  // 秒
+    0x31, 0x0C, 0x3C, 0x44, 0x4F, 0x28, 0x41, 0x0E, 0x28, 0xE5, 0xE5, 0x22, 0x41, 0x44, 0x08, 0x47, 0x00, 0x00,  // 移
+    0x35, 0x2C, 0x34, 0x41, 0x0F, 0x7E, 0x44, 0x2E, 0x7E, 0xE4, 0x25, 0x7E, 0x44, 0x24, 0x42, 0x44, 0x60, 0x00,  // 稍
+    0x04, 0x00, 0x40, 0xFF, 0xE0, 0x00, 0x20, 0x82, 0x08, 0x11, 0x01, 0x10, 0x0A, 0x00, 0x00, 0xFF, 0xE0, 0x00,  // 立
+    0x41, 0x0F, 0x1E, 0x01, 0x0A, 0x10, 0xA7, 0xE4, 0x42, 0xF4, 0x20, 0x42, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,  // 站
+    0x42, 0x07, 0xBE, 0x94, 0x80, 0x18, 0x3F, 0x00, 0x40, 0xFF, 0xE0, 0xA0, 0x11, 0x06, 0x0C, 0x80, 0x20, 0x00,  // 笑
+    0x42, 0x07, 0xBE, 0x94, 0x87, 0xF8, 0x00, 0x87, 0xF8, 0x44, 0x07, 0xFC, 0x0C, 0x43, 0x44, 0xC5, 0x80, 0x00,  // 第
+    0x42, 0x07, 0xBE, 0x94, 0x80, 0x40, 0x7F, 0xC0, 0x40, 0xFF, 0xE0, 0x08, 0xFF, 0xE2, 0x08, 0x13, 0x00, 0x00,  // 等
+    0x42, 0x07, 0xBE, 0x94, 0x80, 0x40, 0x1B, 0x06, 0x0C, 0xBF, 0xA0, 0x00, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 答
+    0x04, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x04, 0x0F, 0xFE, 0x09, 0x03, 0xF8, 0x04, 0x02, 0x48, 0x4C, 0x40, 0x00,  // 素
+    0x24, 0x42, 0x58, 0x3A, 0x22, 0x22, 0xFD, 0xC0, 0x80, 0x12, 0x07, 0xF0, 0x04, 0x82, 0x44, 0x4C, 0x20, 0x00,  // 紫
+    0x3F, 0x82, 0x48, 0x3F, 0x82, 0x48, 0x3F, 0x80, 0x80, 0x12, 0x03, 0xF8, 0x04, 0x82, 0x44, 0x4C, 0x20, 0x00,  // 累
+    0x40, 0x08, 0x00, 0xAF, 0xC4, 0x10, 0x81, 0x0E, 0x10, 0x01, 0x00, 0x10, 0x21, 0x0C, 0xFE, 0x00, 0x00, 0x00,  // 红
+    0x4F, 0xC8, 0x08, 0xA6, 0x04, 0x18, 0x86, 0x6E, 0x00, 0x0F, 0xC0, 0x10, 0x21, 0x0C, 0x10, 0x0F, 0xE0, 0x00,  // 经
+    0x41, 0x08, 0x28, 0xA4, 0x44, 0xBA, 0x80, 0x0E, 0xFE, 0x02, 0x00, 0x48, 0x28, 0x4C, 0xFC, 0x00, 0x40, 0x00,  // 绘
+    0x41, 0x08, 0x28, 0xA4, 0x44, 0xBA, 0x80, 0x0E, 0xFE, 0x08, 0x20, 0x82, 0x2F, 0xEC, 0x00, 0x00, 0x00, 0x00,  // 给
+    0x44, 0x08, 0x78, 0xA8, 0x84, 0x50, 0x82, 0x0E, 0x50, 0x08, 0xE0, 0x78, 0x24, 0x8C, 0x48, 0x07, 0x80, 0x00,  // 络
+    0x44, 0x08, 0x78, 0xA8, 0x84, 0xFC, 0x89, 0x4E, 0xFC, 0x09, 0x40, 0xFC, 0x28, 0x0C, 0x82, 0x07, 0xC0, 0x00,  // 绝
+    0x41, 0x08, 0xFE, 0xA1, 0x04, 0xFE, 0x85, 0x0E, 0x92, 0x05, 0x40, 0xFE, 0x22, 0x8C, 0x44, 0x08, 0x20, 0x00,  // 续
+    0x4F, 0x88, 0x08, 0xAF, 0x84, 0x08, 0x8F, 0xEE, 0x10, 0x09, 0x20, 0x54, 0x23, 0x8C, 0x54, 0x0B, 0x20, 0x00,  // 绿
+    0x40, 0xC8, 0xF0, 0xA5, 0x44, 0xFE, 0x82, 0x0E, 0xFE, 0x04, 0x00, 0x7C, 0x2A, 0x8C, 0x90, 0x02, 0xC0, 0x00,  // 缓
+    0xFF, 0xE8, 0x02, 0xA2, 0x29, 0x12, 0x8A, 0xA8, 0xAA, 0x95, 0x2A, 0x62, 0x80, 0x28, 0x02, 0x80, 0xE0, 0x00,  // 网
+    0xFF, 0xE9, 0x12, 0xFF, 0xE0, 0x40, 0x7F, 0xC5, 0xF0, 0x51, 0x05, 0xF0, 0x51, 0x05, 0xF0, 0xFF, 0xE0, 0x00,  // 置
+    0x20, 0x81, 0x10, 0x7F, 0xC0, 0x40, 0x3F, 0x80, 0x40, 0xFF, 0xE0, 0x40, 0xFF, 0xE1, 0xB0, 0xE0, 0xE0, 0x00,  // 美
+    0x3B, 0x6A, 0x92, 0x73, 0x6F, 0x92, 0x73, 0x6A, 0x92, 0xF9, 0x2A, 0x92, 0xF9, 0x2A, 0x92, 0xFA, 0x40, 0x00,  // 翻
+    0x08, 0x07, 0xF4, 0x08, 0x8F, 0xFE, 0x02, 0x00, 0x40, 0x1A, 0x06, 0x24, 0x02, 0x80, 0x22, 0x03, 0xE0, 0x00,  // 老
+    0x08, 0x07, 0xF4, 0x08, 0x8F, 0xFE, 0x02, 0x00, 0xC0, 0x3F, 0xC1, 0x00, 0x1F, 0x80, 0x08, 0x03, 0x00, 0x00,  // 考
+    0x08, 0x07, 0xF4, 0x08, 0x8F, 0xFE, 0x02, 0x00, 0xC0, 0x3F, 0x86, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 者
+    0xFF, 0xE0, 0x80, 0x10, 0x07, 0xFC, 0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x51, 0x45, 0x14, 0x40, 0xC0, 0x00,  // 而
+    0x21, 0x05, 0x14, 0xF9, 0x80, 0x10, 0x79, 0xE4, 0x80, 0x79, 0x04, 0x94, 0x79, 0x84, 0x90, 0x59, 0xE0, 0x00,  // 能
+    0x71, 0x05, 0x08, 0x77, 0xA5, 0x1C, 0x72, 0x85, 0x4C, 0x50, 0xA5, 0x08, 0x90, 0x89, 0x08, 0xB3, 0x00, 0x00,  // 脉
+    0x72, 0x65, 0x76, 0x72, 0x65, 0x76, 0x74, 0x65, 0x54, 0x57, 0x45, 0x04, 0x90, 0x49, 0x04, 0xB0, 0x40, 0x00,  // 脚
+    0x71, 0xE5, 0x52, 0x73, 0xE5, 0x12, 0x75, 0xC5, 0x14, 0x51, 0x25, 0x1A, 0x92, 0x09, 0x5E, 0xB0, 0x00, 0x00,  // 腿
+    0x08, 0x01, 0x00, 0x7F, 0xC4, 0x04, 0x40, 0x47, 0xFC, 0x40, 0x47, 0xFC, 0x40, 0x44, 0x04, 0x7F, 0xC0, 0x00,  // 自
+    0xF9, 0x04, 0x20, 0x97, 0xEF, 0xA4, 0x22, 0x42, 0x14, 0xF1, 0x42, 0x08, 0x21, 0x4F, 0xA2, 0x00, 0x00, 0x00,  // 致
+    0x20, 0x07, 0xFC, 0xAA, 0x8F, 0xFE, 0x2A, 0x87, 0xFC, 0x10, 0x03, 0xD0, 0x4B, 0xC3, 0x10, 0xC1, 0x00, 0x00,  // 舞
+    0x21, 0x06, 0x7E, 0x54, 0x27, 0x24, 0x52, 0x8D, 0x30, 0x72, 0x05, 0x22, 0x92, 0x2B, 0x1C, 0x00, 0x00, 0x00,  // 舵
+    0x20, 0x07, 0xC0, 0x88, 0x07, 0xF0, 0x49, 0x04, 0x90, 0x7F, 0x04, 0x02, 0x40, 0x23, 0xFC, 0x00, 0x00, 0x00,  // 色
+    0x20, 0x8F, 0xFE, 0x20, 0x80, 0x00, 0x7F, 0x80, 0x48, 0x04, 0x80, 0x48, 0x05, 0x80, 0x40, 0x04, 0x00, 0x00,  // 节
+    0x20, 0x8F, 0xFE, 0x20, 0x82, 0xA0, 0x2B, 0xC2, 0xA4, 0x28, 0x07, 0xFC, 0x4A, 0x44, 0xA4, 0xFF, 0xE0, 0x00,  // 蓝
+    0x10, 0x02, 0x7E, 0x40, 0x09, 0x00, 0x2F, 0xE6, 0x08, 0xA0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x23, 0x00, 0x00,  // 行
+    0x04, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x04, 0x0F, 0xFE, 0x14, 0x82, 0x50, 0x62, 0x0A, 0x10, 0x3C, 0xE0, 0x00,  // 表
+    0x41, 0x0E, 0xFE, 0x29, 0x24, 0x90, 0xCF, 0xCA, 0xC4, 0x4A, 0x84, 0x90, 0x4A, 0x84, 0x44, 0x48, 0x20, 0x00,  // 被
+    0xFF, 0xE1, 0x10, 0x7F, 0xC5, 0x14, 0x51, 0x45, 0x14, 0x60, 0xC4, 0x04, 0x40, 0x47, 0xFC, 0x40, 0x40, 0x00,  // 西
+    0xFF, 0xE1, 0x10, 0x7F, 0xC5, 0x14, 0x7F, 0xC0, 0x80, 0xFF, 0xE1, 0x08, 0x29, 0x00, 0x60, 0x39, 0x80, 0x00,  // 要
+    0x7F, 0x04, 0x10, 0x49, 0x04, 0x90, 0x49, 0x04, 0x90, 0x55, 0x01, 0x40, 0x24, 0x24, 0x42, 0x87, 0xC0, 0x00,  // 见
+    0x44, 0x42, 0x48, 0xFF, 0xE8, 0x02, 0x3F, 0x82, 0x48, 0x24, 0x82, 0xA8, 0x0A, 0x03, 0x22, 0xC1, 0xC0, 0x00,  // 觉
+    0x10, 0x03, 0xE0, 0x42, 0x07, 0xF8, 0x44, 0x87, 0xF8, 0x44, 0x87, 0xF8, 0x40, 0x88, 0x08, 0x83, 0x00, 0x00,  // 角
+    0x47, 0xCF, 0x24, 0x92, 0x4F, 0x4C, 0x92, 0x8F, 0x7E, 0x90, 0x89, 0x7E, 0x90, 0x8B, 0x08, 0x00, 0x80, 0x00,  // 解
+    0x81, 0x04, 0x10, 0x01, 0x0C, 0x10, 0x41, 0x04, 0x28, 0x42, 0x84, 0x44, 0x64, 0x44, 0x82, 0x00, 0x00, 0x00,  // 认
+    0x8F, 0xC4, 0x04, 0x00, 0x4C, 0x04, 0x4F, 0xC4, 0x80, 0x48, 0x04, 0x80, 0x68, 0x24, 0x82, 0x07, 0xC0, 0x00,  // 记
+    0x8F, 0xE4, 0x24, 0x04, 0x4C, 0xFE, 0x40, 0xC4, 0x14, 0x42, 0x44, 0x44, 0x68, 0x44, 0x04, 0x01, 0x80, 0x00,  // 讶
+    0x87, 0x84, 0x48, 0x04, 0x8C, 0x8E, 0x40, 0x04, 0xFC, 0x44, 0x44, 0x28, 0x61, 0x04, 0x6C, 0x08, 0x20, 0x00,  // 设
+    0x80, 0x44, 0x38, 0x04, 0x0C, 0x40, 0x47, 0xE4, 0x48, 0x44, 0x84, 0xA8, 0x68, 0x84, 0x08, 0x00, 0x80, 0x00,  // 诉
+    0x80, 0xC4, 0xF0, 0x01, 0x0C, 0xFE, 0x41, 0x04, 0x10, 0x47, 0xC4, 0x44, 0x64, 0x44, 0x7C, 0x00, 0x00, 0x00,  // 话
+    0x84, 0x04, 0x7E, 0x08, 0x2C, 0x7A, 0x44, 0xA4, 0x7A, 0x44, 0xA4, 0x7A, 0x60, 0x24, 0x02, 0x00, 0xC0, 0x00,  // 询
+    0x81, 0x04, 0xFE, 0x02, 0x0C, 0x48, 0x4F, 0x04, 0x14, 0x42, 0x84, 0x78, 0x61, 0x44, 0x62, 0x08, 0x00, 0x00,  // 该
+    0x87, 0xC4, 0x44, 0x07, 0xCC, 0x00, 0x4F, 0xC4, 0x00, 0x4F, 0xE4, 0x10, 0x62, 0x84, 0x44, 0x08, 0x20, 0x00,  // 误
+    0x84, 0x44, 0x28, 0x07, 0xCC, 0x44, 0x44, 0x44, 0x7C, 0x42, 0x84, 0x28, 0x64, 0x84, 0x4A, 0x08, 0xE0, 0x00,  // 说
+    0x81, 0x04, 0xFE, 0x01, 0x0C, 0x7C, 0x41, 0x04, 0xFE, 0x47, 0xC4, 0x44, 0x67, 0xC4, 0x44, 0x04, 0xC0, 0x00,  // 请
+    0x85, 0x04, 0x48, 0x0F, 0xEC, 0xD0, 0x47, 0xC4, 0x50, 0x47, 0xC4, 0x50, 0x65, 0x04, 0x7E, 0x00, 0x00, 0x00,  // 谁
+    0x84, 0x24, 0xE2, 0x0A, 0xEC, 0xE2, 0x4A, 0xA4, 0xE6, 0x4A, 0x24, 0xE2, 0x66, 0x24, 0xC2, 0x08, 0x60, 0x00,  // 谢
+    0x7F, 0x04, 0x10, 0x49, 0x04, 0x90, 0x49, 0x04, 0x90, 0x49, 0x01, 0x40, 0x22, 0x04, 0x10, 0x80, 0x80, 0x00,  // 贝
+    0xE2, 0x0A, 0x20, 0xA7, 0xEA, 0x44, 0xAA, 0x4A, 0x28, 0x01, 0x04, 0x28, 0xA4, 0x40, 0x82, 0x00, 0x00, 0x00,  // 败
+    0x04, 0x07, 0xFC, 0x04, 0x0F, 0xFE, 0x04, 0x02, 0x40, 0x27, 0xC2, 0x40, 0x54, 0x04, 0xC0, 0x87, 0xE0, 0x00,  // 走
+    0x20, 0x0F, 0xBC, 0x20, 0x42, 0x04, 0xFB, 0xC2, 0x20, 0xBA, 0x0A, 0x22, 0xA2, 0x26, 0x1C, 0x9F, 0xC0, 0x00,  // 起
+    0xF2, 0x09, 0x3E, 0x94, 0x2F, 0x7A, 0x44, 0xA7, 0x7A, 0x44, 0x64, 0x40, 0x54, 0x2E, 0x3C, 0x00, 0x00, 0x00,  // 跑
+    0xF2, 0x09, 0x3C, 0x94, 0x8F, 0x30, 0x43, 0x07, 0x4E, 0x43, 0xC4, 0x24, 0x52, 0x4E, 0x3C, 0x00, 0x00, 0x00,  // 路
+    0xF1, 0x49, 0x54, 0x93, 0x4F, 0x16, 0x43, 0x47, 0x54, 0x41, 0x44, 0x24, 0x52, 0x4E, 0x44, 0x00, 0x60, 0x00,  // 跳
+    0x08, 0x03, 0xF8, 0x20, 0x83, 0xF8, 0x20, 0x83, 0xF8, 0x20, 0xCF, 0xF0, 0x05, 0x01, 0x90, 0x63, 0x00, 0x00,  // 身
+    0x41, 0x0F, 0x7E, 0x42, 0x08, 0x7E, 0xF2, 0x02, 0x7C, 0x20, 0x4F, 0x18, 0x20, 0x42, 0x02, 0x00, 0x00, 0x00,  // 转
+    0x82, 0x04, 0x20, 0x1F, 0xCC, 0x24, 0x42, 0x44, 0x44, 0x48, 0x45, 0x04, 0x41, 0x8B, 0x00, 0x1F, 0xE0, 0x00,  // 边
+    0x80, 0x84, 0x08, 0x1F, 0xEC, 0x08, 0x44, 0x84, 0x28, 0x40, 0x84, 0x08, 0x43, 0x0B, 0x00, 0x1F, 0xE0, 0x00,  // 过
+    0x84, 0x04, 0x9E, 0x11, 0x2D, 0x12, 0x55, 0x25, 0x92, 0x51, 0x64, 0x10, 0x41, 0x0B, 0x00, 0x1F, 0xE0, 0x00,  // 迎
+    0x80, 0x04, 0xFC, 0x00, 0x0D, 0xFE, 0x42, 0x04, 0x40, 0x48, 0x85, 0xFC, 0x40, 0x4B, 0x00, 0x1F, 0xE0, 0x00,  // 运
+    0x9F, 0xE4, 0x08, 0x01, 0x0C, 0x30, 0x45, 0x44, 0x92, 0x51, 0x04, 0x10, 0x41, 0x0B, 0x00, 0x1F, 0xE0, 0x00,  // 还
+    0x81, 0x04, 0x10, 0x1F, 0xEC, 0x84, 0x44, 0x84, 0x30, 0x43, 0x04, 0xCC, 0x50, 0x2B, 0x00, 0x1F, 0xE0, 0x00,  // 这
+    0x84, 0x84, 0x48, 0x1F, 0xEC, 0x48, 0x44, 0x85, 0xFE, 0x44, 0x84, 0x88, 0x50, 0x8B, 0x00, 0x1F, 0xE0, 0x00,  // 进
+    0x82, 0x05, 0xFE, 0x04, 0x0C, 0x90, 0x5F, 0xE4, 0x10, 0x5F, 0xE4, 0x10, 0x41, 0x0B, 0x00, 0x1F, 0xE0, 0x00,  // 连
+    0x8F, 0xC4, 0x84, 0x0F, 0xCC, 0x84, 0x4F, 0xC4, 0xA4, 0x49, 0x84, 0xA4, 0x4C, 0x2B, 0x00, 0x1F, 0xE0, 0x00,  // 退
+    0x88, 0x84, 0x50, 0x1F, 0xCC, 0x20, 0x5F, 0xE4, 0x20, 0x45, 0x04, 0x88, 0x50, 0x4B, 0x00, 0x1F, 0xE0, 0x00,  // 送
+    0x9F, 0x84, 0x30, 0x0F, 0xCC, 0x94, 0x4F, 0xC4, 0x94, 0x4F, 0xC4, 0x94, 0x49, 0xCB, 0x00, 0x1F, 0xE0, 0x00,  // 通
+    0x82, 0x05, 0xFE, 0x02, 0x0C, 0xFC, 0x4A, 0x44, 0xFC, 0x47, 0x04, 0xA8, 0x52, 0x4B, 0x00, 0x1F, 0xE0, 0x00,  // 速
+    0x88, 0x84, 0x50, 0x1F, 0xEC, 0x20, 0x4F, 0xC4, 0x84, 0x4F, 0xC4, 0x84, 0x4F, 0xCB, 0x00, 0x1F, 0xE0, 0x00,  // 道
+    0xFE, 0xE2, 0x8A, 0x28, 0xCF, 0xEA, 0x28, 0xA2, 0x8C, 0xFE, 0x82, 0x88, 0x48, 0x88, 0x88, 0x18, 0x80, 0x00,  // 那
+    0x10, 0xEF, 0xEA, 0x44, 0xC2, 0x8A, 0xFE, 0xA0, 0x0C, 0x7C, 0x84, 0x48, 0x44, 0x87, 0xC8, 0x00, 0x80, 0x00,  // 部
+    0x20, 0xEF, 0xAA, 0x2C, 0xCF, 0xEA, 0x30, 0xA7, 0xCC, 0xC4, 0x87, 0xC8, 0x44, 0x87, 0xC8, 0x00, 0x80, 0x00,  // 都
+    0xF0, 0x06, 0x7C, 0xF0, 0x4F, 0x04, 0x97, 0xCF, 0x40, 0x94, 0x09, 0x42, 0xF4, 0x20, 0x3C, 0x00, 0x00, 0x00,  // 配
+    0xF2, 0x86, 0x7C, 0xF4, 0x8F, 0x7E, 0x90, 0x0F, 0x3C, 0x92, 0x49, 0x24, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00,  // 酷
+    0x7F, 0xC4, 0x44, 0x7F, 0xC4, 0x44, 0x7F, 0xC0, 0x40, 0x3F, 0x80, 0x40, 0x04, 0x00, 0x40, 0xFF, 0xE0, 0x00,  // 里
+    0x01, 0x87, 0xE0, 0x04, 0x0F, 0xFE, 0x44, 0x47, 0xFC, 0x44, 0x47, 0xFC, 0x04, 0x03, 0xF8, 0xFF, 0xE0, 0x00,  // 重
+    0x41, 0x0E, 0x10, 0x8F, 0xEE, 0x92, 0x49, 0x2E, 0x92, 0x4F, 0xE4, 0x10, 0x61, 0x04, 0x10, 0x01, 0x00, 0x00,  // 钟
+    0x44, 0x4E, 0xFE, 0x84, 0x4E, 0x44, 0x4F, 0xEE, 0x00, 0x47, 0xC4, 0x44, 0x67, 0xC4, 0x44, 0x07, 0xC0, 0x00,  // 错
+    0x20, 0x82, 0x10, 0x22, 0x02, 0x40, 0xFF, 0xE2, 0x80, 0x24, 0x02, 0x20, 0x21, 0x02, 0x88, 0x30, 0x60, 0x00,  // 长
+    0x40, 0x02, 0xFC, 0x80, 0x48, 0x24, 0xBF, 0x48, 0x64, 0x8A, 0x49, 0x24, 0xA2, 0x48, 0x64, 0x80, 0xC0, 0x00,  // 闭
+    0x40, 0x02, 0xFC, 0x80, 0x48, 0x04, 0x9E, 0x49, 0x24, 0x92, 0x49, 0xE4, 0x80, 0x48, 0x04, 0x80, 0xC0, 0x00,  // 问
+    0x40, 0x02, 0xFC, 0x80, 0x48, 0x04, 0x9E, 0x49, 0x24, 0x9E, 0x49, 0x24, 0x9E, 0x48, 0x04, 0x80, 0xC0, 0x00,  // 间
+    0xE1, 0x0A, 0x10, 0xC1, 0x0A, 0x10, 0xA1, 0x0C, 0x28, 0x82, 0x88, 0x44, 0x84, 0x48, 0x82, 0x80, 0x00, 0x00,  // 队
+    0xE0, 0x0A, 0xFC, 0xC8, 0x4A, 0x84, 0xA8, 0x4C, 0xFC, 0x88, 0x48, 0x84, 0x88, 0x48, 0xFC, 0x80, 0x00, 0x00,  // 阳
+    0xE7, 0xCA, 0x44, 0xC4, 0x4A, 0x7C, 0xA4, 0x4C, 0x44, 0x87, 0xC8, 0x44, 0x88, 0x48, 0x84, 0x89, 0x80, 0x00,  // 阴
+    0xE1, 0x0A, 0x28, 0xC4, 0x4A, 0xBA, 0xA1, 0x0C, 0xFE, 0x81, 0x08, 0x54, 0x89, 0x28, 0x10, 0x83, 0x00, 0x00,  // 除
+    0x02, 0x80, 0x24, 0xF7, 0xE1, 0x68, 0x95, 0xE5, 0x48, 0x25, 0xE5, 0x48, 0x85, 0xE0, 0x48, 0x05, 0xE0, 0x00,  // 难
+    0xFF, 0xE0, 0x40, 0xFF, 0xE8, 0x42, 0xA5, 0x29, 0x4A, 0x84, 0x2A, 0x52, 0x94, 0xA8, 0x42, 0x80, 0xE0, 0x00,  // 雨
+    0x7F, 0xC0, 0x40, 0xFF, 0xEA, 0x52, 0x94, 0xA3, 0xF8, 0x00, 0x83, 0xF8, 0x00, 0x83, 0xF8, 0x00, 0x00, 0x00,  // 雪
+    0x7F, 0xC0, 0x40, 0xFF, 0xEA, 0x52, 0x94, 0xA0, 0x40, 0x1B, 0x06, 0x0C, 0x3F, 0x00, 0x10, 0x06, 0x00, 0x00,  // 零
+    0x7F, 0xC0, 0x40, 0xFF, 0xEA, 0x52, 0x94, 0xA3, 0xF0, 0x4C, 0x03, 0x38, 0xFF, 0x80, 0x88, 0x31, 0x80, 0x00,  // 雾
+    0x7F, 0xC0, 0x40, 0xFF, 0xEA, 0x52, 0x94, 0xAF, 0xFE, 0x08, 0x07, 0xFC, 0x51, 0x45, 0x14, 0x51, 0x40, 0x00,  // 需
+    0x04, 0x07, 0xFC, 0x04, 0x03, 0xF8, 0x04, 0x0F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x21, 0x80, 0x00,  // 青
+    0xFF, 0xE0, 0x40, 0x08, 0x07, 0xFC, 0x4A, 0x44, 0xE4, 0x4A, 0x44, 0xE4, 0x4A, 0x44, 0xE4, 0x7F, 0xC0, 0x00,  // 面
+    0x04, 0x07, 0xFC, 0x11, 0x00, 0xA0, 0xFF, 0xE0, 0x00, 0x3F, 0x82, 0x08, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00,  // 音
+    0xFF, 0xE0, 0x40, 0x3F, 0x82, 0x08, 0x24, 0x82, 0x48, 0x24, 0x82, 0x48, 0x05, 0x01, 0x88, 0xC0, 0x60, 0x00,  // 页
+    0x2F, 0xE4, 0x10, 0x87, 0xC1, 0x44, 0x25, 0x44, 0x54, 0x85, 0x41, 0x54, 0x22, 0x84, 0x44, 0x88, 0x20, 0x00,  // 须
+    0x7F, 0x84, 0x08, 0x52, 0x84, 0xA8, 0x44, 0x84, 0x48, 0x4A, 0x85, 0x18, 0x40, 0x88, 0x0A, 0x80, 0x60, 0x00,  // 风
+    0x40, 0x6E, 0x78, 0xA4, 0x08, 0x7C, 0x86, 0x48, 0x54, 0x84, 0x8A, 0x54, 0xCA, 0x28, 0x80, 0x00, 0x00, 0x00,  // 饭
+    0x42, 0x4E, 0xC6, 0xA4, 0x48, 0xFE, 0x84, 0x48, 0x6A, 0x8C, 0x4A, 0x4A, 0xC5, 0x28, 0xC0, 0x00, 0x00, 0x00,  // 饿
+    0x04, 0x0F, 0xFE, 0x3F, 0x82, 0x08, 0x3F, 0x80, 0x00, 0x7F, 0xC5, 0xF4, 0x51, 0x45, 0xF4, 0x40, 0xC0, 0x00,  // 高
+    0x20, 0x8F, 0xFE, 0x20, 0x83, 0xF8, 0xFF, 0xE0, 0x40, 0x3F, 0x82, 0x48, 0x3F, 0x81, 0x10, 0x60, 0xC0, 0x00,  // 黄
+    0x7F, 0xC5, 0x54, 0x4E, 0x47, 0xFC, 0x04, 0x07, 0xFC, 0x04, 0x0F, 0xFE, 0x00, 0x04, 0x92, 0x88, 0xA0, 0x00,  // 黑
+    0xF8, 0xAD, 0x88, 0xAB, 0xEF, 0x88, 0x20, 0x8F, 0x88, 0x21, 0x4F, 0x94, 0x02, 0x2A, 0xA2, 0xA8, 0x00, 0x00,  // 默
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  // ！
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02, 0x00, 0x10, 0x00, 0x80, 0x00,  // （
+    0x20, 0x01, 0x00, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00,  // ）
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x60, 0x02, 0x00, 0x40, 0x00, 0x00,  // ，
+    0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  // ：
+    0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00,  // ；
+    0x00, 0x01, 0xC0, 0x22, 0x00, 0x20, 0x04, 0x00, 0x80, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,  // ？
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x04, 0x84, 0x84, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ～
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef COMMAND_H
+#define COMMAND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "spsc_queue.h"
+
+// 网络核与执行核之间传递的命令和状态定义
+
+const size_t COMMAND_TEXT_SIZE = 256;  // OLED文本等附带内容的最大字节数
+const size_t STATUS_TEXT_SIZE = 160;   // 状态文本最大字节数
+const uint32_t COMMAND_QUEUE_SIZE = 8;
+// 一条命令最多产生三条状态：状态或started/queued回执、延迟结果、动作结束时的completed回执；
+// 一整队命令在一次执行循环中处理完、动作又被随后的停止打断时，三者可能同时等待网络核发送（容量须为2的幂）
+const uint32_t STATUS_QUEUE_SIZE = COMMAND_QUEUE_SIZE * 4;
+
+// 数值同时是二进制协议的操作码（见binary_protocol.h），只能在末尾追加，不能调整顺序
+enum class CommandAction : uint8_t {
+    // LED
+    LedOn = 0,
+    LedOff = 1,
+    LedToggle = 2,
+    LedStatus = 3,
+    // 舵机
+    WalkForward = 4,
+    WalkBackward = 5,
+    StandUp = 6,
+    Stop = 7,
+    LeftForward = 8,
+    LeftBackward = 9,
+    RightForward = 10,
+    RightBackward = 11,
+    MoveLegs = 12,
+    MoveLeft = 13,
+    MoveRight = 14,
+    ServoStatus = 15,
+    // OLED
+    OledEmotion = 16,
+    OledText = 17,
+    OledClear = 18,
+    // 设备
+    DeviceStatus = 19,
+    Restart = 20,
+    // OLED长文本
+    OledPage = 21,
+    OledScroll = 22,
+    // 连续步行
+    Walk = 23,
+    // 舵机校准，只通过JSON下发；二进制帧不携带脉宽，解码后只查询校准表
+    ServoCalibrate = 24
+};
+
+const uint8_t COMMAND_ACTION_COUNT = static_cast<uint8_t>(CommandAction::ServoCalibrate) + 1;
+
+// 连续步行的选项
+const uint8_t WALK_FLAG_BACKWARD = 0x01;    // 后退，否则前进
+const uint8_t WALK_FLAG_UNTIL_STOP = 0x02;  // 一直走到收到停止命令（或有其他动作排队）
+
+// 舵机校准的pulseUs特殊值
+const uint16_t SERVO_CALIBRATION_QUERY = 0;       // 只查询校准表
+const uint16_t SERVO_CALIBRATION_RESET = 0xFFFF;  // 恢复默认校准表
+
+// LED亮度特殊值：只开灯，保持当前亮度（文本命令和自定义命令led_on）
+// JSON路径由submitAction()设置；bin1帧中亮度字节为BINARY_BRIGHTNESS_KEEP时由解码器设置
+const uint8_t LED_BRIGHTNESS_KEEP = 0xFF;
+
+// 已解析的命令，定长结构体，可直接在无锁队列中按值传递
+struct Command {
+    CommandAction action;
+    uint8_t profile;          // 插值曲线：0表示不修改，否则为MotionProfile + 1
+    uint8_t brightness;       // LED亮度百分比，LED_BRIGHTNESS_KEEP表示保持当前亮度
+    int16_t leftAngle;
+    int16_t rightAngle;
+    uint32_t durationMs;      // 舵机移动时长，0表示直接跳转；连续步行时为步行总时长，0表示不按时长结束
+    uint16_t walkSteps;       // 连续步行的步态周期数，0表示不按周期数结束
+    uint8_t walkTempo;        // 连续步行的步速百分比，100为步态表的标准速度
+    uint8_t walkFlags;        // WALK_FLAG_*
+    uint16_t pulseUs;         // 舵机校准：leftAngle处校准点的脉宽（微秒），或SERVO_CALIBRATION_*
+    uint32_t t0;              // 服务器发送时刻（服务器时钟，微秒），原样回传用于延迟测量，0表示不测量
+    uint32_t receivedAt;      // 网络核收到消息的时刻（micros()）
+    uint32_t seq;             // 服务器分配的命令序号，执行完成后以ack回传，0表示不回传
+    char text[COMMAND_TEXT_SIZE];  // OLED翻页时为"next"/"prev"，自动滚动时为速度（像素/秒），舵机校准时为通道"left"/"right"
+};
+
+// 状态更新所属的子系统；同一子系统尚未发出的旧状态会被新状态替换
+enum class StatusTopic : uint8_t {
+    None,      // 不合并
+    Led,
+    Servo,
+    Oled,
+    Device,
+    Latency    // 延迟测量结果，不合并，以latency消息发送
+};
+
+// 一条带t0命令的延迟测量结果，时间均为设备时钟（微秒）
+struct LatencySample {
+    CommandAction action;
+    uint32_t t0;
+    uint32_t receivedAt;
+    uint32_t queueUs;     // 收到消息到开始执行
+    uint32_t executeUs;   // execute()本身的耗时
+    int32_t outputUs;     // 收到消息到第一次硬件输出，-1表示超时仍没有输出
+};
+
+// 命令回执状态：accepted表示已进入命令队列，completed表示执行完毕，rejected表示不会执行
+// 舵机动作执行时间较长，进入控制器时先回执started或queued，动作结束（或被打断）时再回执completed
+enum class AckState : uint8_t {
+    Accepted,
+    Completed,
+    Rejected,
+    Started,   // 舵机动作已开始执行
+    Queued     // 舵机动作已进入动作队列，等当前动作结束后执行
+};
+
+// 执行核回传给网络核的状态更新
+struct StatusEvent {
+    StatusTopic topic;
+    char text[STATUS_TEXT_SIZE];
+    uint32_t seq;           // 非0时本条状态作为该序号命令的回执发送
+    AckState ack;           // 回执状态，仅seq非0时有效
+    const char* reason;     // 回执附带的原因，指向字符串常量：rejected的拒绝原因，或completed时动作没有正常完成的原因
+    LatencySample latency;  // 仅topic为Latency时有效
+};
+
+typedef SpscQueue<Command, COMMAND_QUEUE_SIZE> CommandQueue;
+typedef SpscQueue<StatusEvent, STATUS_QUEUE_SIZE> StatusQueue;
+
+#endif
@@ -0,0 +1,355 @@
+#include "command_executor.h"
+#include <stdarg.h>
+#include "json_writer.h"
+#include "config.h"
+#include "metrics.h"
+#include "binary_log.h"
+
+CommandExecutor::CommandExecutor(LedController* led, ServoController* servo, OledDisplay* oled, StatusQueue* status)
+    : ledController(led), servoController(servo), oledDisplay(oled), statusQueue(status),
+      pendingLatencyCount(0), motionRejected(false), currentSeq(0) {
+}
+
+// 由舵机控制任务产生输出的动作；其他动作的输出在execute()返回前已经完成
+// 动作事件带着命令的seq和t0，延迟测量只由本命令自己的动作结算
+static bool isServoMotion(CommandAction action) {
+    return (action >= CommandAction::WalkForward && action <= CommandAction::MoveRight) || action == CommandAction::Walk;
+}
+
+void CommandExecutor::formatStatus(StatusEvent& event, const char* format, va_list args) {
+    vsnprintf(event.text, sizeof(event.text), format, args);
+    utf8TrimPartial(event.text);
+    event.ack = AckState::Completed;
+    event.reason = nullptr;
+}
+
+void CommandExecutor::reportStatus(StatusTopic topic, const char* format, ...) {
+    StatusEvent event;
+    event.topic = topic;
+    
+    va_list args;
+    va_start(args, format);
+    formatStatus(event, format, args);
+    va_end(args);
+    
+    pushStatus(event);
+}
+
+void CommandExecutor::reportMotion(MotionAdmission admission, const char* format, ...) {
+    StatusEvent event;
+    event.topic = StatusTopic::Servo;
+    
+    motionRejected = admission == MotionAdmission::Rejected;
+    if (motionRejected) {
+        event.topic = StatusTopic::None;
+        strcpy(event.text, "动作队列已满，命令已丢弃");
+        event.ack = AckState::Rejected;
+        event.reason = "motion_queue_full";
+    } else {
+        va_list args;
+        va_start(args, format);
+        formatStatus(event, format, args);
+        va_end(args);
+        
+        // 动作还没有结束，先回执started/queued，completed由pollMotionEvents()在动作结束后发出
+        event.ack = admission == MotionAdmission::Queued ? AckState::Queued : AckState::Started;
+        
+        // 排队的动作在当前动作结束后才开始，状态里注明，免得误以为已经在动
+        if (admission == MotionAdmission::Queued) {
+            size_t length = strlen(event.text);
+            snprintf(event.text + length, sizeof(event.text) - length, "（已排队）");
+            utf8TrimPartial(event.text);
+        }
+    }
+    
+    pushStatus(event);
+}
+
+void CommandExecutor::pushStatus(StatusEvent& event) {
+    event.seq = currentSeq;
+    currentSeq = 0;
+    if (!statusQueue->push(event)) {
+        LOG(STATUS_QUEUE_FULL, event.text);
+    }
+}
+
+void CommandExecutor::execute(const Command& command) {
+    MetricProbe probe(MetricStage::Actuator);
+    uint32_t startedAt = micros();
+    MotionTag tag(command.seq, command.t0);
+    motionRejected = false;
+    
+    currentSeq = command.seq;
+    if (command.profile != 0) {
+        servoController->setMotionProfile(static_cast<MotionProfile>(command.profile - 1));
+    }
+    
+    switch (command.action) {
+        // LED
+        case CommandAction::LedOn:
+            ledController->setState(true);
+            if (command.brightness != LED_BRIGHTNESS_KEEP) {
+                ledController->setBrightness(command.brightness);
+            }
+            reportStatus(StatusTopic::Led, "LED已开启，亮度%d%%", ledController->getBrightness());
+            break;
+        case CommandAction::LedOff:
+            ledController->setState(false);
+            reportStatus(StatusTopic::Led, "LED已关闭");
+            break;
+        case CommandAction::LedToggle:
+            ledController->toggle();
+            if (ledController->getState()) {
+                if (command.brightness != LED_BRIGHTNESS_KEEP) {
+                    ledController->setBrightness(command.brightness);
+                }
+                reportStatus(StatusTopic::Led, "LED已开启，亮度%d%%", ledController->getBrightness());
+            } else {
+                reportStatus(StatusTopic::Led, "LED已关闭");
+            }
+            break;
+        case CommandAction::LedStatus:
+            reportStatus(StatusTopic::Led, "%s", ledController->getStatusString().c_str());
+            break;
+        
+        // 舵机
+        case CommandAction::WalkForward:
+            reportMotion(servoController->walkForward(tag), "机器人开始前进步态");
+            break;
+        case CommandAction::WalkBackward:
+            reportMotion(servoController->walkBackward(tag), "机器人开始后退步态");
+            break;
+        case CommandAction::StandUp:
+            servoController->standUp(command.receivedAt, tag);
+            reportMotion(MotionAdmission::Started, "机器人开始站立");
+            break;
+        case CommandAction::Stop:
+            servoController->stopWalk(command.receivedAt, tag);
+            reportMotion(MotionAdmission::Started, "机器人停止步行，正在回到站立位置");
+            break;
+        case CommandAction::LeftForward:
+            reportMotion(servoController->leftLegForward(tag), "左腿开始前进");
+            break;
+        case CommandAction::LeftBackward:
+            reportMotion(servoController->leftLegBackward(tag), "左腿开始后退");
+            break;
+        case CommandAction::RightForward:
+            reportMotion(servoController->rightLegForward(tag), "右腿开始前进");
+            break;
+        case CommandAction::RightBackward:
+            reportMotion(servoController->rightLegBackward(tag), "右腿开始后退");
+            break;
+        case CommandAction::MoveLegs:
+            reportMotion(servoController->moveLegs(command.leftAngle, command.rightAngle, command.durationMs, tag),
+                         "腿部移动到指定角度：左腿%d度，右腿%d度", command.leftAngle, command.rightAngle);
+            break;
+        case CommandAction::MoveLeft:
+            reportMotion(servoController->moveLeftLeg(command.leftAngle, command.durationMs, tag),
+                         "左腿移动到%d度", command.leftAngle);
+            break;
+        case CommandAction::MoveRight:
+            reportMotion(servoController->moveRightLeg(command.rightAngle, command.durationMs, tag),
+                         "右腿移动到%d度", command.rightAngle);
+            break;
+        case CommandAction::Walk: {
+            bool backward = command.walkFlags & WALK_FLAG_BACKWARD;
+            bool untilStop = command.walkFlags & WALK_FLAG_UNTIL_STOP;
+            MotionAdmission admission = servoController->walk(
+                backward ? GAIT_WALK_BACKWARD_CYCLE : GAIT_WALK_FORWARD_CYCLE,
+                command.walkSteps, command.durationMs, untilStop, command.walkTempo, tag);
+            const char* direction = backward ? "后退" : "前进";
+            if (untilStop) {
+                reportMotion(admission, "机器人开始连续%s，直到收到停止命令，步速%d%%", direction, command.walkTempo);
+            } else if (command.walkSteps != 0 || command.durationMs == 0) {
+                reportMotion(admission, "机器人开始连续%s%d个周期，步速%d%%", direction,
+                             command.walkSteps != 0 ? command.walkSteps : 1, command.walkTempo);
+            } else {
+                reportMotion(admission, "机器人开始连续%s%u毫秒，步速%d%%", direction,
+                             (unsigned)command.durationMs, command.walkTempo);
+            }
+            break;
+        }
+        case CommandAction::ServoStatus:
+            reportStatus(StatusTopic::Servo, "%s", servoController->getStatusString().c_str());
+            break;
+        case CommandAction::ServoCalibrate: {
+            ServoChannel channel = strcmp(command.text, "right") == 0 ? ServoChannel::Right : ServoChannel::Left;
+            const char* note = "";
+            if (command.pulseUs == SERVO_CALIBRATION_RESET) {
+                servoController->resetCalibration(channel);
+                note = "已恢复默认，";
+            } else if (command.pulseUs != SERVO_CALIBRATION_QUERY &&
+                       !servoController->calibrate(channel, command.leftAngle, command.pulseUs)) {
+                // 新表仍在本次运行中生效，只是重启后会丢失
+                note = "保存失败，重启后失效，";
+            }
+            reportStatus(StatusTopic::None, "%s%s", note, servoController->getCalibrationString(channel).c_str());
+            break;
+        }
+        
+        // OLED
+        case CommandAction::OledEmotion:
+            oledDisplay->displayEmotion(String(command.text));
+            reportStatus(StatusTopic::Oled, "OLED显示表情: %s", command.text);
+            break;
+        case CommandAction::OledText:
+            oledDisplay->displayText(command.text);
+            reportStatus(StatusTopic::Oled, "OLED显示文本: %s", command.text);
+            break;
+        case CommandAction::OledClear:
+            oledDisplay->clear();
+            reportStatus(StatusTopic::Oled, "OLED屏幕已清除");
+            break;
+        case CommandAction::OledPage: {
+            int page = oledDisplay->pageText(strcmp(command.text, "prev") == 0 ? -1 : 1);
+            if (page == 0) {
+                reportStatus(StatusTopic::None, "OLED当前没有显示文本，无法翻页");
+            } else {
+                reportStatus(StatusTopic::Oled, "OLED文本第%d/%d页", page, oledDisplay->getTextPageCount());
+            }
+            break;
+        }
+        case CommandAction::OledScroll: {
+            int speed = constrain(atoi(command.text), 0, 1000);
+            oledDisplay->setScrollSpeed(speed);
+            if (speed == 0) {
+                reportStatus(StatusTopic::Oled, "OLED文本自动滚动已关闭");
+            } else {
+                reportStatus(StatusTopic::Oled, "OLED文本自动滚动速度: %d像素/秒", speed);
+            }
+            break;
+        }
+        
+        // 设备
+        case CommandAction::DeviceStatus:
+            reportStatus(StatusTopic::Device, "设备运行正常");
+            break;
+        case CommandAction::Restart:
+            Serial.println("执行重启命令");
+            ESP.restart();
+            break;
+    }
+    
+    if (currentSeq != 0) {
+        StatusEvent event;
+        event.topic = StatusTopic::None;
+        event.text[0] = '\0';
+        event.ack = AckState::Completed;
+        event.reason = nullptr;
+        pushStatus(event);
+    }
+    
+    if (command.t0 != 0) {
+        // 被拒绝的动作不会产生舵机输出，直接按无输出回传
+        recordLatency(command, startedAt, isServoMotion(command.action), motionRejected);
+    }
+}
+
+void CommandExecutor::recordLatency(const Command& command, uint32_t startedAt, bool waitForServo, bool noOutput) {
+    uint32_t now = micros();
+    LatencySample sample;
+    sample.action = command.action;
+    sample.t0 = command.t0;
+    sample.receivedAt = command.receivedAt;
+    sample.queueUs = startedAt - command.receivedAt;
+    sample.executeUs = now - startedAt;
+    sample.outputUs = now - command.receivedAt;
+    
+    if (!waitForServo) {
+        reportLatency(sample);
+        return;
+    }
+    if (noOutput || pendingLatencyCount == MAX_PENDING_LATENCY) {
+        if (!noOutput) {
+            LOG(LATENCY_PENDING_FULL);
+        }
+        sample.outputUs = -1;
+        reportLatency(sample);
+        return;
+    }
+    pendingLatency[pendingLatencyCount].sample = sample;
+    pendingLatency[pendingLatencyCount].tag = MotionTag(command.seq, command.t0);
+    pendingLatencyCount++;
+}
+
+// 结算与事件的动作标记对应的那一条测量；动作结束事件表示它直到结束都没有输出过
+void CommandExecutor::settleLatency(const MotionEvent& event) {
+    for (uint8_t i = 0; i < pendingLatencyCount; i++) {
+        PendingLatency& pending = pendingLatency[i];
+        if (!(pending.tag == event.tag)) continue;
+        
+        pending.sample.outputUs = event.type == MotionEventType::Output
+            ? (int32_t)(event.at - pending.sample.receivedAt) : -1;
+        reportLatency(pending.sample);
+        pendingLatency[i] = pendingLatency[--pendingLatencyCount];
+        return;
+    }
+}
+
+void CommandExecutor::pollLatency() {
+    // 每个动作开始输出或结束时都会结算自己的测量；超时只在动作事件丢失时起作用
+    uint32_t now = micros();
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < pendingLatencyCount; i++) {
+        if (now - pendingLatency[i].sample.receivedAt > LATENCY_OUTPUT_TIMEOUT_MS * 1000UL) {
+            pendingLatency[i].sample.outputUs = -1;
+            reportLatency(pendingLatency[i].sample);
+        } else {
+            pendingLatency[kept++] = pendingLatency[i];
+        }
+    }
+    pendingLatencyCount = kept;
+}
+
+void CommandExecutor::pollMotionEvents() {
+    MotionEvent event;
+    while (servoController->takeMotionEvent(event)) {
+        // 开始输出时已结算的测量不会再被结束事件匹配到
+        if (event.tag.t0 != 0) {
+            settleLatency(event);
+        }
+        // 只带t0的动作（延迟基准）不需要完成回执
+        if (event.type == MotionEventType::Output || event.tag.seq == 0) continue;
+        
+        currentSeq = event.tag.seq;
+        switch (event.type) {
+            case MotionEventType::Completed:
+                reportStatus(StatusTopic::None, "动作完成：左腿%d度，右腿%d度",
+                             servoController->getCurrentLeftAngle(), servoController->getCurrentRightAngle());
+                break;
+            case MotionEventType::Superseded:
+                reportInterrupted("superseded", "动作被新的目标角度替换");
+                break;
+            case MotionEventType::Preempted:
+                reportInterrupted("preempted", "动作被停止/站立命令打断");
+                break;
+            case MotionEventType::Cancelled:
+                reportInterrupted("cancelled", "排队中的动作被停止/站立命令取消，没有执行");
+                break;
+            case MotionEventType::Output:
+                break;
+        }
+    }
+}
+
+void CommandExecutor::reportInterrupted(const char* reason, const char* text) {
+    StatusEvent event;
+    event.topic = StatusTopic::None;
+    strcpy(event.text, text);
+    event.ack = AckState::Completed;
+    event.reason = reason;
+    pushStatus(event);
+}
+
+void CommandExecutor::reportLatency(const LatencySample& sample) {
+    StatusEvent event;
+    event.topic = StatusTopic::Latency;
+    event.text[0] = '\0';
+    event.seq = 0;
+    event.ack = AckState::Completed;
+    event.reason = nullptr;
+    event.latency = sample;
+    if (!statusQueue->push(event)) {
+        LOG(LATENCY_DROPPED);
+    }
+}
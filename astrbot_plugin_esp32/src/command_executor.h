@@ -0,0 +1,49 @@
+#ifndef COMMAND_EXECUTOR_H
+#define COMMAND_EXECUTOR_H
+
+#include <Arduino.h>
+#include "command.h"
+#include "led_controller.h"
+#include "servo_controller.h"
+#include "oled_display.h"
+
+// 在执行核上运行：执行已解析的命令，并把状态更新放入状态队列交给网络核发送
+class CommandExecutor {
+private:
+    LedController* ledController;
+    ServoController* servoController;
+    OledDisplay* oledDisplay;
+    StatusQueue* statusQueue;
+    
+    // 带t0的舵机命令要等它自己的动作第一次写入舵机才算完成，期间在此等待；
+    // 排队的动作要等前面的动作结束，容量覆盖正在执行的和排队的全部动作
+    struct PendingLatency {
+        LatencySample sample;
+        MotionTag tag;
+    };
+    static const uint8_t MAX_PENDING_LATENCY = MOTION_QUEUE_SIZE + 1;
+    PendingLatency pendingLatency[MAX_PENDING_LATENCY];
+    uint8_t pendingLatencyCount;
+    bool motionRejected;  // 本条命令的动作被动作队列拒绝
+    
+    // 正在执行的命令序号：它产生的第一条状态作为回执，没有状态时在execute()末尾补发completed
+    // 舵机动作的第一条状态回执started/queued，completed在动作结束后由pollMotionEvents()发出
+    uint32_t currentSeq;
+    
+    void reportStatus(StatusTopic topic, const char* format, ...) __attribute__((format(printf, 3, 4)));
+    void reportMotion(MotionAdmission admission, const char* format, ...) __attribute__((format(printf, 3, 4)));
+    void formatStatus(StatusEvent& event, const char* format, va_list args);
+    void recordLatency(const Command& command, uint32_t startedAt, bool waitForServo, bool noOutput);
+    void settleLatency(const MotionEvent& event);
+    void reportLatency(const LatencySample& sample);
+    void reportInterrupted(const char* reason, const char* text);
+    void pushStatus(StatusEvent& event);
+
+public:
+    CommandExecutor(LedController* led, ServoController* servo, OledDisplay* oled, StatusQueue* status);
+    void execute(const Command& command);
+    void pollMotionEvents();  // 在loop()中调用：舵机动作开始输出时回传延迟，动作结束时回执completed
+    void pollLatency();       // 在loop()中调用：等待超时的测量按无输出回传
+};
+
+#endif
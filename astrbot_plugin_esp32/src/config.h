@@ -2,11 +2,11 @@
 #define CONFIG_H
 
 // WiFi配置
-const char* WIFI_SSID = "jamyoung";
-const char* WIFI_PASSWORD = "259259259";
+const char* const WIFI_SSID = "jamyoung";
+const char* const WIFI_PASSWORD = "259259259";
 
 // WebSocket服务器配置
-const char* WEBSOCKET_SERVER = "192.168.137.1";  // 替换为运行AstrBot的电脑IP地址
+const char* const WEBSOCKET_SERVER = "192.168.137.1";  // 替换为运行AstrBot的电脑IP地址
 const int WEBSOCKET_PORT = 8765;
 
 // OLED显示屏配置
@@ -17,6 +17,14 @@ const int WEBSOCKET_PORT = 8765;
 
 #define I2C_SDA 18  // SDA引脚
 #define I2C_SCL 17  // SCL引脚
+#define OLED_I2C_CLOCK 400000  // OLED刷新时的I2C时钟频率（Hz）
+#define OLED_ANIMATION_MAX_FPS 20  // 表情动画最高帧率，为网络和I2C留出余量
+#define OLED_TEXT_BUDGET_US 20000   // 文本绘制耗时超过该值时输出警告（微秒）
+#define OLED_SCROLL_SPEED 16        // 长文本自动滚动速度（像素/秒），0表示不自动滚动
+#define OLED_SCROLL_PAUSE_MS 2000   // 滚动到顶部和底部时的停留时间（毫秒）
+#ifndef OLED_VERIFY_BITMAPS
+#define OLED_VERIFY_BITMAPS 0  // 设为1时启动阶段比对预生成的表情位图与原始绘制结果，并输出两者耗时；主机校验工具以-D方式打开
+#endif
 
 // 引脚配置
 #define LED_PIN 42
@@ -28,9 +36,44 @@ const int WEBSOCKET_PORT = 8765;
 #define SERVO_MAX_ANGLE 180
 #define SERVO_CENTER_ANGLE 90
 
+// 舵机脉宽与校准配置：每个通道一张角度到脉宽的校准表，保存在NVS中，可用servo_calibrate命令在线修改
+#define SERVO_PULSE_MIN_US 500          // 允许输出的最小脉宽（微秒）
+#define SERVO_PULSE_MAX_US 2500         // 允许输出的最大脉宽（微秒）
+#define SERVO_DEFAULT_MIN_US 544        // 默认校准表0度的脉宽，与ESP32Servo的默认映射一致
+#define SERVO_DEFAULT_MAX_US 2400       // 默认校准表180度的脉宽
+#define SERVO_CALIBRATION_STEP 15       // 校准点的角度间隔（度），0-180度共13个点，点之间线性插值
+#define SERVO_CALIBRATION_NVS "servo_cal"  // 校准表所在的NVS命名空间
+
+// 舵机轨迹插值配置
+#define SERVO_CONTROL_HZ 100          // 舵机控制环频率（硬件定时器驱动）
+#define LEG_SWEEP_MS_PER_DEGREE 6     // 单腿前进/后退的平均速度（毫秒/度）
+#define SERVO_LEFT_SLEW_DPS 400       // 左腿通道最大转速（度/秒），目标突变时逐周期逼近，0表示不限速
+#define SERVO_RIGHT_SLEW_DPS 400      // 右腿通道最大转速（度/秒）
+#define MOTION_QUEUE_SIZE 4           // 排队等待执行的步态和腿部动作上限，停止和站立不排队
+
 // 步行参数配置
-#define WALK_STEP_DELAY 500    // 步行动作间隔时间（毫秒）
-#define LEG_MOVE_DELAY 50      // 腿部移动平滑延迟（毫秒）
+#define WALK_STEP_DELAY 500      // 连续步行结束时回到中心一帧的标准时长（毫秒），随步速缩放
+#define WALK_MIN_STEP_DELAY 150  // 步速再快，每个关键帧也不短于该时长（毫秒），受舵机转速限制
+
+// 双核任务配置：网络与消息解析在核心0，命令执行在loop()所在的核心1
+#define NETWORK_TASK_CORE 0
+#define NETWORK_TASK_PRIORITY 2
+#define NETWORK_TASK_STACK 8192
+#define NETWORK_POLL_INTERVAL 5    // 网络任务轮询间隔（毫秒）
+#define MESSAGE_ARENA_SIZE 4096    // 单条JSON消息的解析内存池（字节），解析结果超出时拒绝该消息
+#define ACTUATOR_IDLE_WAIT 50      // 执行循环无命令时的最长等待（毫秒）
+#define LATENCY_OUTPUT_TIMEOUT_MS 5000  // 带t0的舵机命令等待自己第一次舵机输出的上限（毫秒），含在动作队列中等待的时间
+
+// 运行指标配置
+#define METRICS_HEAP_SAMPLE_MS 1000  // 网络任务采样最大可分配块的间隔（毫秒）
+#define METRICS_IN_HEARTBEAT 0       // 设为1时每次心跳后附带发送一份完整的指标报告
+
+// 日志配置：记录先写入环形缓冲区，由低优先级任务输出到串口
+#define LOG_LEVEL LOG_LEVEL_INFO  // 低于该级别的日志在编译期去掉，发布版可设为LOG_LEVEL_WARN
+#define LOG_BUFFER_SIZE 2048      // 日志环形缓冲区字节数
+#define LOG_TASK_PRIORITY 1       // 低于网络任务和loop()
+#define LOG_TASK_STACK 2048
+#define LOG_DRAIN_INTERVAL 20     // 缓冲区为空时输出任务的检查间隔（毫秒）
 
 // 设备配置
 #define DEVICE_ID "esp32s3_001"
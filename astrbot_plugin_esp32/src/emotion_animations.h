@@ -0,0 +1,51 @@
+#ifndef EMOTION_ANIMATIONS_H
+#define EMOTION_ANIMATIONS_H
+
+#include <stdint.h>
+
+// 表情动画效果：在预生成的表情位图上按帧叠加变化
+enum class AnimationEffect : uint8_t {
+    None,
+    Blink,     // 眨眼：level 0睁眼，1半闭，2闭眼
+    Breathe,   // 呼吸：level为整张脸向下平移的像素数
+    Typing     // 思考气泡中的输入点：level 0显示问号，1-3为点的个数
+};
+
+// 动画帧：效果参数及该帧保持时间
+struct AnimationFrame {
+    uint8_t level;
+    uint16_t durationMs;
+};
+
+// 动画：一组循环播放的帧，整体存放在flash中
+struct EmotionAnimation {
+    AnimationEffect effect;
+    const AnimationFrame* frames;
+    uint8_t frameCount;
+};
+
+constexpr AnimationFrame ANIMATION_BLINK_FRAMES[] = {
+    {0, 2800},  // 睁眼
+    {1,   60},
+    {2,  100},  // 闭眼
+    {1,   60},
+};
+
+constexpr AnimationFrame ANIMATION_BREATHE_FRAMES[] = {
+    {0, 1200},
+    {1, 1200},
+};
+
+constexpr AnimationFrame ANIMATION_TYPING_FRAMES[] = {
+    {1, 350},
+    {2, 350},
+    {3, 350},
+    {0, 900},
+};
+
+constexpr EmotionAnimation ANIMATION_NONE = {AnimationEffect::None, nullptr, 0};
+constexpr EmotionAnimation ANIMATION_BLINK = {AnimationEffect::Blink, ANIMATION_BLINK_FRAMES, sizeof(ANIMATION_BLINK_FRAMES) / sizeof(AnimationFrame)};
+constexpr EmotionAnimation ANIMATION_BREATHE = {AnimationEffect::Breathe, ANIMATION_BREATHE_FRAMES, sizeof(ANIMATION_BREATHE_FRAMES) / sizeof(AnimationFrame)};
+constexpr EmotionAnimation ANIMATION_TYPING = {AnimationEffect::Typing, ANIMATION_TYPING_FRAMES, sizeof(ANIMATION_TYPING_FRAMES) / sizeof(AnimationFrame)};
+
+#endif
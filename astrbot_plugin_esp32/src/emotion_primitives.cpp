@@ -0,0 +1,211 @@
+#include "emotion_primitives.h"
+
+#if OLED_VERIFY_BITMAPS
+
+#include <Adafruit_SSD1306.h>
+
+// 画开心表情 ^_^
+static void drawHappyFace(Adafruit_GFX& display) {
+    // 眉毛（弯曲的开心眉毛）
+    for(int i = 0; i < 2; i++) {
+        display.drawCircle(45, 25, 8 + i, SSD1306_WHITE);
+        display.drawCircle(83, 25, 8 + i, SSD1306_WHITE);
+    }
+    // 遮盖下半部分形成弯眉，同时消除中间连接
+    display.fillRect(37, 25, 16, 10, SSD1306_BLACK);
+    display.fillRect(75, 25, 16, 10, SSD1306_BLACK);
+    // 消除两眼中间的弧
+    display.fillRect(37, 25, 42, 10, SSD1306_BLACK);
+    
+    // 眼睛（大的圆角正方形）
+    display.fillRoundRect(35, 35, 16, 16, 4, SSD1306_WHITE);
+    display.fillRoundRect(77, 35, 16, 16, 4, SSD1306_WHITE);
+    
+    // 嘴巴（开心的微笑弧形）
+    for(int i = 0; i < 3; i++) {
+        display.drawCircle(64, 45, 15 + i, SSD1306_WHITE);
+    }
+    // 遮盖上半部分形成微笑弧
+    display.fillRect(49, 45, 30, 15, SSD1306_BLACK);
+}
+
+// 画伤心表情 T_T
+static void drawSadFace(Adafruit_GFX& display) {
+    // 眉毛（下垂的伤心眉毛）
+    display.drawLine(35, 18, 50, 25, SSD1306_WHITE);
+    display.drawLine(36, 19, 51, 26, SSD1306_WHITE);
+    display.drawLine(78, 25, 93, 18, SSD1306_WHITE);
+    display.drawLine(77, 26, 92, 19, SSD1306_WHITE);
+    
+    // 眼睛（大的圆角正方形）
+    display.fillRoundRect(35, 35, 16, 16, 4, SSD1306_WHITE);
+    display.fillRoundRect(77, 35, 16, 16, 4, SSD1306_WHITE);
+    
+    // 眼泪
+    display.drawLine(43, 51, 43, 58, SSD1306_WHITE);
+    display.drawLine(85, 51, 85, 58, SSD1306_WHITE);
+    display.fillCircle(43, 59, 2, SSD1306_WHITE);
+    display.fillCircle(85, 59, 2, SSD1306_WHITE);
+    
+    // 嘴巴（倒弧，伤心）
+    for(int i = 0; i < 3; i++) {
+        display.drawCircle(64, 75, 15 + i, SSD1306_WHITE);
+    }
+    // 遮盖下半部分形成倒弧
+    display.fillRect(49, 60, 30, 15, SSD1306_BLACK);
+}
+
+// 画生气表情 >:(
+static void drawAngryFace(Adafruit_GFX& display) {
+    // 眉毛（愤怒的倾斜眉毛）
+    display.fillTriangle(30, 20, 50, 30, 30, 25, SSD1306_WHITE);
+    display.fillTriangle(98, 20, 78, 30, 98, 25, SSD1306_WHITE);
+    
+    // 眼睛（大的圆角正方形，稍微倾斜）
+    display.fillRoundRect(35, 38, 16, 12, 3, SSD1306_WHITE);
+    display.fillRoundRect(77, 38, 16, 12, 3, SSD1306_WHITE);
+    
+    // 鼻孔（愤怒时的鼻孔）
+    display.fillCircle(62, 50, 1, SSD1306_WHITE);
+    display.fillCircle(66, 50, 1, SSD1306_WHITE);
+    
+    // 嘴巴（愤怒的波浪线）
+    display.drawLine(45, 58, 55, 55, SSD1306_WHITE);
+    display.drawLine(55, 55, 65, 58, SSD1306_WHITE);
+    display.drawLine(65, 58, 75, 55, SSD1306_WHITE);
+    display.drawLine(75, 55, 85, 58, SSD1306_WHITE);
+}
+
+// 画惊讶表情 O_O
+static void drawSurprisedFace(Adafruit_GFX& display) {
+    // 眉毛（高高扬起的惊讶眉毛）
+    for(int i = 0; i < 2; i++) {
+        display.drawCircle(45, 15, 12 + i, SSD1306_WHITE);
+        display.drawCircle(83, 15, 12 + i, SSD1306_WHITE);
+    }
+    // 遮盖下半部分形成高眉
+    display.fillRect(33, 15, 24, 12, SSD1306_BLACK);
+    display.fillRect(71, 15, 24, 12, SSD1306_BLACK);
+    
+    // 眼睛（非常大的圆角正方形）
+    display.fillRoundRect(30, 30, 20, 20, 5, SSD1306_WHITE);
+    display.fillRoundRect(78, 30, 20, 20, 5, SSD1306_WHITE);
+    // 瞳孔
+    display.fillCircle(40, 40, 3, SSD1306_BLACK);
+    display.fillCircle(88, 40, 3, SSD1306_BLACK);
+    
+    // 嘴巴（大的惊讶圆圈）
+    display.drawCircle(64, 58, 8, SSD1306_WHITE);
+    display.drawCircle(64, 58, 7, SSD1306_WHITE);
+}
+
+// 画困倦表情 -_-
+static void drawSleepyFace(Adafruit_GFX& display) {
+    // 眉毛（下垂的困倦眉毛）
+    display.drawLine(35, 22, 50, 18, SSD1306_WHITE);
+    display.drawLine(36, 23, 51, 19, SSD1306_WHITE);
+    display.drawLine(78, 18, 93, 22, SSD1306_WHITE);
+    display.drawLine(77, 19, 92, 23, SSD1306_WHITE);
+    
+    // 眼睛（扁平的圆角矩形，表示闭眼）
+    display.fillRoundRect(35, 40, 16, 4, 2, SSD1306_WHITE);
+    display.fillRoundRect(77, 40, 16, 4, 2, SSD1306_WHITE);
+    
+    // 嘴巴（小的困倦弧）
+    for(int i = 0; i < 2; i++) {
+        display.drawCircle(64, 52, 6 + i, SSD1306_WHITE);
+    }
+    display.fillRect(58, 52, 12, 6, SSD1306_BLACK);
+}
+
+// 画爱心眼表情
+static void drawHeartEyes(Adafruit_GFX& display) {
+    // 眉毛（开心的弯眉）
+    for(int i = 0; i < 2; i++) {
+        display.drawCircle(45, 22, 10 + i, SSD1306_WHITE);
+        display.drawCircle(83, 22, 10 + i, SSD1306_WHITE);
+    }
+    display.fillRect(35, 22, 20, 10, SSD1306_BLACK);
+    display.fillRect(73, 22, 20, 10, SSD1306_BLACK);
+    
+    // 爱心眼睛（在圆角正方形框架内）
+    display.drawRoundRect(32, 32, 20, 20, 5, SSD1306_WHITE);
+    display.drawRoundRect(76, 32, 20, 20, 5, SSD1306_WHITE);
+    
+    // 左爱心
+    display.fillCircle(38, 38, 3, SSD1306_WHITE);
+    display.fillCircle(46, 38, 3, SSD1306_WHITE);
+    display.fillTriangle(35, 41, 49, 41, 42, 48, SSD1306_WHITE);
+    
+    // 右爱心
+    display.fillCircle(82, 38, 3, SSD1306_WHITE);
+    display.fillCircle(90, 38, 3, SSD1306_WHITE);
+    display.fillTriangle(79, 41, 93, 41, 86, 48, SSD1306_WHITE);
+    
+    // 微笑
+    for(int i = 0; i < 3; i++) {
+        display.drawCircle(64, 45, 15 + i, SSD1306_WHITE);
+    }
+    display.fillRect(49, 45, 30, 15, SSD1306_BLACK);
+}
+
+// 画酷表情（戴墨镜）
+static void drawCoolFace(Adafruit_GFX& display) {
+    // 眉毛（平直的酷眉）
+    display.fillRect(35, 18, 18, 3, SSD1306_WHITE);
+    display.fillRect(75, 18, 18, 3, SSD1306_WHITE);
+    
+    // 墨镜（连体的大墨镜）
+    display.fillRoundRect(25, 30, 78, 20, 8, SSD1306_WHITE);
+    display.fillRoundRect(30, 34, 25, 12, 6, SSD1306_BLACK);
+    display.fillRoundRect(73, 34, 25, 12, 6, SSD1306_BLACK);
+    display.fillRect(55, 38, 18, 4, SSD1306_WHITE); // 鼻梁
+    
+    // 嘴巴（酷酷的直线，稍微上扬）
+    display.drawLine(50, 58, 78, 56, SSD1306_WHITE);
+    display.drawLine(50, 59, 78, 57, SSD1306_WHITE);
+}
+
+// 画思考表情
+static void drawThinkingFace(Adafruit_GFX& display) {
+    // 眉毛（一高一低，表示疑惑）
+    for(int i = 0; i < 2; i++) {
+        display.drawCircle(45, 20, 8 + i, SSD1306_WHITE);
+    }
+    display.fillRect(37, 20, 16, 8, SSD1306_BLACK);
+    display.drawLine(78, 18, 93, 25, SSD1306_WHITE);
+    display.drawLine(77, 19, 92, 26, SSD1306_WHITE);
+    
+    // 眼睛（一个正常，一个眯眼）
+    display.fillRoundRect(35, 35, 16, 16, 4, SSD1306_WHITE);
+    display.fillRoundRect(77, 40, 16, 6, 3, SSD1306_WHITE);
+    
+    // 瞳孔（向上看）
+    display.fillCircle(43, 38, 2, SSD1306_BLACK);
+    
+    // 嘴巴（歪嘴，表示思考）
+    display.drawLine(55, 58, 70, 56, SSD1306_WHITE);
+    display.drawLine(55, 59, 70, 57, SSD1306_WHITE);
+    
+    // 思考气泡
+    display.drawCircle(100, 15, 10, SSD1306_WHITE);
+    display.fillCircle(90, 25, 3, SSD1306_WHITE);
+    display.fillCircle(85, 30, 2, SSD1306_WHITE);
+    display.fillCircle(82, 33, 1, SSD1306_WHITE);
+}
+
+void drawEmotionPrimitives(Adafruit_GFX& display, Emotion emotion) {
+    switch (emotion) {
+        case Emotion::Happy: drawHappyFace(display); break;
+        case Emotion::Sad: drawSadFace(display); break;
+        case Emotion::Angry: drawAngryFace(display); break;
+        case Emotion::Surprised: drawSurprisedFace(display); break;
+        case Emotion::Sleepy: drawSleepyFace(display); break;
+        case Emotion::Love: drawHeartEyes(display); break;
+        case Emotion::Cool: drawCoolFace(display); break;
+        case Emotion::Thinking: drawThinkingFace(display); break;
+        default: break;
+    }
+}
+
+#endif
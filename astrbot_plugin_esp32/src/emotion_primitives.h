@@ -0,0 +1,14 @@
+#ifndef EMOTION_PRIMITIVES_H
+#define EMOTION_PRIMITIVES_H
+
+#include <Adafruit_GFX.h>
+#include "config.h"
+#include "oled_display.h"
+
+#if OLED_VERIFY_BITMAPS
+// 表情的原始绘制方法：逐个叠加圆、矩形和三角形。运行时已改为拷贝预生成的位图（tools/gen_emotion_bitmaps.py），
+// 这里保留下来只用于校验位图，调用方为设备启动时的OledDisplay::verifyEmotionBitmaps()和主机上的tools/check_emotion_bitmaps.cpp
+void drawEmotionPrimitives(Adafruit_GFX& display, Emotion emotion);
+#endif
+
+#endif
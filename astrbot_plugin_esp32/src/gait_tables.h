@@ -0,0 +1,75 @@
+#ifndef GAIT_TABLES_H
+#define GAIT_TABLES_H
+
+#include <stdint.h>
+
+// 步态关键帧：左右腿目标角度及该帧保持时间
+struct GaitKeyframe {
+    uint8_t leftAngle;
+    uint8_t rightAngle;
+    uint16_t durationMs;
+};
+
+// 步态：一组按顺序播放的关键帧，整体存放在flash中
+struct Gait {
+    const char* name;
+    const GaitKeyframe* frames;
+    uint8_t frameCount;
+};
+
+template <typename T, unsigned N>
+constexpr uint8_t gaitFrameCount(const T (&)[N]) {
+    return N;
+}
+
+// 编译期检查关键帧角度都在0-180度之间
+constexpr bool gaitFramesValid(const GaitKeyframe* frames, uint8_t count) {
+    return count == 0 ||
+           (frames->leftAngle <= 180 && frames->rightAngle <= 180 &&
+            gaitFramesValid(frames + 1, count - 1));
+}
+
+// 站立：左腿180度、右腿0度，再回到中心位置
+constexpr GaitKeyframe GAIT_STAND_UP_FRAMES[] = {
+    {180,   0, 1000},
+    { 90,  90, 1000},
+};
+
+// 前进：右腿前进/左腿后退，然后切换方向，最后回到中间位置
+constexpr GaitKeyframe GAIT_WALK_FORWARD_FRAMES[] = {
+    { 45,  45, 500},  // 右腿前进，左腿后退
+    { 30,  30, 500},  // 右腿继续前进，左腿继续后退
+    {120, 120, 500},  // 切换方向 - 右腿后退，左腿前进
+    {150, 150, 500},  // 右腿继续后退，左腿继续前进
+    { 90,  90, 500},  // 回到中间位置
+};
+
+// 后退：与前进相反
+constexpr GaitKeyframe GAIT_WALK_BACKWARD_FRAMES[] = {
+    {120, 120, 500},  // 左腿前进，右腿后退
+    {150, 150, 500},
+    { 45,  45, 500},  // 切换方向 - 左腿后退，右腿前进
+    { 30,  30, 500},
+    { 90,  90, 500},  // 回到中间位置
+};
+
+// 停止：回到中心站立位置
+constexpr GaitKeyframe GAIT_STOP_FRAMES[] = {
+    { 90,  90, 1000},
+};
+
+constexpr Gait GAIT_STAND_UP      = {"stand_up",      GAIT_STAND_UP_FRAMES,      gaitFrameCount(GAIT_STAND_UP_FRAMES)};
+constexpr Gait GAIT_WALK_FORWARD  = {"walk_forward",  GAIT_WALK_FORWARD_FRAMES,  gaitFrameCount(GAIT_WALK_FORWARD_FRAMES)};
+constexpr Gait GAIT_WALK_BACKWARD = {"walk_backward", GAIT_WALK_BACKWARD_FRAMES, gaitFrameCount(GAIT_WALK_BACKWARD_FRAMES)};
+constexpr Gait GAIT_STOP          = {"stop",          GAIT_STOP_FRAMES,          gaitFrameCount(GAIT_STOP_FRAMES)};
+
+// 连续步行循环播放的周期：去掉前进/后退表中最后回到中心的一帧，周期之间直接衔接
+constexpr Gait GAIT_WALK_FORWARD_CYCLE  = {"walk_forward_cycle",  GAIT_WALK_FORWARD_FRAMES,  gaitFrameCount(GAIT_WALK_FORWARD_FRAMES) - 1};
+constexpr Gait GAIT_WALK_BACKWARD_CYCLE = {"walk_backward_cycle", GAIT_WALK_BACKWARD_FRAMES, gaitFrameCount(GAIT_WALK_BACKWARD_FRAMES) - 1};
+
+static_assert(gaitFramesValid(GAIT_STAND_UP_FRAMES, gaitFrameCount(GAIT_STAND_UP_FRAMES)), "stand_up angle out of range");
+static_assert(gaitFramesValid(GAIT_WALK_FORWARD_FRAMES, gaitFrameCount(GAIT_WALK_FORWARD_FRAMES)), "walk_forward angle out of range");
+static_assert(gaitFramesValid(GAIT_WALK_BACKWARD_FRAMES, gaitFrameCount(GAIT_WALK_BACKWARD_FRAMES)), "walk_backward angle out of range");
+static_assert(gaitFramesValid(GAIT_STOP_FRAMES, gaitFrameCount(GAIT_STOP_FRAMES)), "stop angle out of range");
+
+#endif
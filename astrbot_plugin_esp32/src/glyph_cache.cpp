@@ -0,0 +1,112 @@
+#include "glyph_cache.h"
+
+GlyphCache::GlyphCache() : used(0), useClock(0), hits(0), misses(0) {
+}
+
+const uint16_t* GlyphCache::lookup(uint32_t codepoint) {
+    if (codepoint > 0xFFFF) return nullptr;  // 字库只收录BMP字符
+    
+    useClock++;
+    for (uint8_t i = 0; i < used; i++) {
+        if (entries[i].codepoint == codepoint) {
+            entries[i].lastUsed = useClock;
+            hits++;
+            return entries[i].rows;
+        }
+    }
+    
+    int index = findGlyph((uint16_t)codepoint);
+    if (index < 0) return nullptr;
+    misses++;
+    
+    // 缓存未满时直接追加，否则替换最久未使用的字形
+    uint8_t slot = used;
+    if (used < CACHE_SIZE) {
+        used++;
+    } else {
+        slot = 0;
+        for (uint8_t i = 1; i < CACHE_SIZE; i++) {
+            if (entries[i].lastUsed < entries[slot].lastUsed) {
+                slot = i;
+            }
+        }
+    }
+    
+    Entry& entry = entries[slot];
+    entry.codepoint = (uint16_t)codepoint;
+    entry.lastUsed = useClock;
+    decodeGlyph(index, entry.rows);
+    return entry.rows;
+}
+
+int GlyphCache::findGlyph(uint16_t codepoint) {
+    int low = 0;
+    int high = (int)CJK_GLYPH_COUNT - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        uint16_t value = pgm_read_word(&CJK_CODEPOINTS[mid]);
+        if (value == codepoint) return mid;
+        if (value < codepoint) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+void GlyphCache::decodeGlyph(int index, uint16_t* rows) {
+    // 字形逐行连续打包，行与行之间没有填充位
+    const uint8_t* data = CJK_GLYPHS + index * CJK_GLYPH_BYTES;
+    unsigned bit = 0;
+    for (int y = 0; y < CJK_GLYPH_HEIGHT; y++) {
+        uint16_t row = 0;
+        for (int x = 0; x < CJK_GLYPH_WIDTH; x++, bit++) {
+            if (pgm_read_byte(&data[bit >> 3]) & (0x80 >> (bit & 7))) {
+                row |= 0x8000 >> x;
+            }
+        }
+        rows[y] = row;
+    }
+}
+
+uint32_t GlyphCache::getHits() const {
+    return hits;
+}
+
+uint32_t GlyphCache::getMisses() const {
+    return misses;
+}
+
+uint32_t utf8Next(const char*& text) {
+    const uint8_t* p = (const uint8_t*)text;
+    uint32_t codepoint;
+    int extra;
+    
+    if (p[0] < 0x80) {
+        text++;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        codepoint = p[0] & 0x1F;
+        extra = 1;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        codepoint = p[0] & 0x0F;
+        extra = 2;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        codepoint = p[0] & 0x07;
+        extra = 3;
+    } else {
+        text++;
+        return 0xFFFD;
+    }
+    
+    for (int i = 1; i <= extra; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            text++;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (p[i] & 0x3F);
+    }
+    text += extra + 1;
+    return codepoint;
+}
@@ -0,0 +1,42 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cjk_font.h"
+
+// 中文字形LRU缓存：字库以打包位流存放在flash中（cjk_font.h），解码后的字形按行缓存在RAM里
+// 缓存大小固定，RAM占用为 CACHE_SIZE * sizeof(Entry)，不随文本长度增长
+// 128x64屏幕每行10个字，滚动时最多露出6行；缓存小于一屏的字数时，重绘整屏会按LRU顺序把下一个要用的字形挤掉，每个字都要重新解码
+class GlyphCache {
+public:
+    static const uint8_t CACHE_SIZE = 64;
+    
+private:
+    struct Entry {
+        uint16_t codepoint;
+        uint32_t lastUsed;
+        uint16_t rows[CJK_GLYPH_HEIGHT];  // 每行一个uint16_t，最高位为最左侧像素
+    };
+    
+    Entry entries[CACHE_SIZE];
+    uint8_t used;
+    uint32_t useClock;
+    uint32_t hits;
+    uint32_t misses;
+    
+    static int findGlyph(uint16_t codepoint);  // 二分查找字形序号，不存在时返回-1
+    static void decodeGlyph(int index, uint16_t* rows);
+    
+public:
+    GlyphCache();
+    // 返回解码后的字形，字库中没有该字符时返回nullptr
+    const uint16_t* lookup(uint32_t codepoint);
+    uint32_t getHits() const;
+    uint32_t getMisses() const;
+};
+
+// 解码一个UTF-8字符并前移指针；非法序列返回U+FFFD，只前移一个字节
+uint32_t utf8Next(const char*& text);
+
+#endif
@@ -0,0 +1,137 @@
+#include "json_writer.h"
+#include <stdio.h>
+#include <string.h>
+
+JsonFrameWriter::JsonFrameWriter(char* buf, size_t size)
+    : buffer(buf), capacity(size), length(0), needComma(false), overflow(false) {
+    if (capacity > 0) buffer[0] = '\0';
+}
+
+void JsonFrameWriter::append(char c) {
+    // 始终为结尾的'\0'保留一个字节
+    if (length + 1 >= capacity) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = c;
+    buffer[length] = '\0';
+}
+
+void JsonFrameWriter::append(const char* text) {
+    while (*text) append(*text++);
+}
+
+void JsonFrameWriter::appendEscaped(const char* text) {
+    append('"');
+    for (const unsigned char* p = (const unsigned char*)text; *p; p++) {
+        switch (*p) {
+            case '"':  append("\\\""); break;
+            case '\\': append("\\\\"); break;
+            case '\n': append("\\n"); break;
+            case '\r': append("\\r"); break;
+            case '\t': append("\\t"); break;
+            default:
+                if (*p < 0x20) {
+                    char escaped[7];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", *p);
+                    append(escaped);
+                } else {
+                    // UTF-8多字节字符原样写入
+                    append((char)*p);
+                }
+        }
+    }
+    append('"');
+}
+
+void JsonFrameWriter::appendKey(const char* key) {
+    if (needComma) append(',');
+    appendEscaped(key);
+    append(':');
+    needComma = true;
+}
+
+void JsonFrameWriter::beginObject() {
+    append('{');
+    needComma = false;
+}
+
+void JsonFrameWriter::endObject() {
+    append('}');
+    needComma = true;
+}
+
+void JsonFrameWriter::field(const char* key, const char* value) {
+    appendKey(key);
+    appendEscaped(value);
+}
+
+void JsonFrameWriter::field(const char* key, uint32_t value) {
+    char digits[11];
+    snprintf(digits, sizeof(digits), "%lu", (unsigned long)value);
+    appendKey(key);
+    append(digits);
+}
+
+void JsonFrameWriter::field(const char* key, int32_t value) {
+    char digits[12];
+    snprintf(digits, sizeof(digits), "%ld", (long)value);
+    appendKey(key);
+    append(digits);
+}
+
+void JsonFrameWriter::field(const char* key, bool value) {
+    appendKey(key);
+    append(value ? "true" : "false");
+}
+
+void JsonFrameWriter::rawField(const char* key, const char* json) {
+    appendKey(key);
+    append(json);
+}
+
+void JsonFrameWriter::beginArray(const char* key) {
+    appendKey(key);
+    append('[');
+    needComma = false;
+}
+
+void JsonFrameWriter::element(uint32_t value) {
+    char digits[11];
+    snprintf(digits, sizeof(digits), "%lu", (unsigned long)value);
+    if (needComma) append(',');
+    append(digits);
+    needComma = true;
+}
+
+void JsonFrameWriter::endArray() {
+    append(']');
+    needComma = true;
+}
+
+const char* JsonFrameWriter::c_str() const {
+    return buffer;
+}
+
+size_t JsonFrameWriter::size() const {
+    return length;
+}
+
+bool JsonFrameWriter::overflowed() const {
+    return overflow;
+}
+
+void utf8TrimPartial(char* text) {
+    size_t len = strlen(text);
+    if (len == 0) return;
+    
+    // 从末尾向前找到最后一个字符的首字节
+    size_t lead = len - 1;
+    while (lead > 0 && ((unsigned char)text[lead] & 0xC0) == 0x80) lead--;
+    
+    unsigned char c = (unsigned char)text[lead];
+    size_t expected = c < 0x80 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : 4;
+    if (len - lead < expected) {
+        text[lead] = '\0';
+    }
+}
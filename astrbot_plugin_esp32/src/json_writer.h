@@ -0,0 +1,42 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 固定形状的出站JSON帧写入器：直接写入调用方提供的缓冲区，不使用堆内存
+// 缓冲区不足时截断并标记overflowed()，调用方可据此丢弃该帧
+class JsonFrameWriter {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool needComma;
+    bool overflow;
+    
+    void append(char c);
+    void append(const char* text);
+    void appendEscaped(const char* text);
+    void appendKey(const char* key);
+    
+public:
+    JsonFrameWriter(char* buf, size_t size);
+    void beginObject();
+    void endObject();
+    void field(const char* key, const char* value);
+    void field(const char* key, uint32_t value);
+    void field(const char* key, int32_t value);
+    void field(const char* key, bool value);
+    void rawField(const char* key, const char* json);  // 写入已序列化的JSON值
+    void beginArray(const char* key);
+    void element(uint32_t value);
+    void endArray();
+    const char* c_str() const;
+    size_t size() const;
+    bool overflowed() const;
+};
+
+// 截断后去掉结尾不完整的UTF-8字符，保证帧内文本始终是合法UTF-8
+void utf8TrimPartial(char* text);
+
+#endif
@@ -1,7 +1,8 @@
 #include "led_controller.h"
+#include "binary_log.h"
 
 LedController::LedController(int ledPin, int channel) 
-    : pin(ledPin), pwmChannel(channel), state(false), brightness(100) {
+    : pin(ledPin), state(false), brightness(100), pwmChannel(channel) {
 }
 
 void LedController::init() {
@@ -36,7 +37,7 @@ void LedController::setBrightness(int newBrightness) {
         // 设置PWM输出
         ledcWrite(pwmChannel, pwmValue);
         
-        Serial.println("LED亮度设置为: " + String(newBrightness) + "% (PWM: " + String(pwmValue) + ")");
+        LOG(LED_BRIGHTNESS, newBrightness, pwmValue);
     }
     
     if (newBrightness > 0) {
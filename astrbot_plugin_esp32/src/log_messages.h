@@ -0,0 +1,70 @@
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+// 二进制日志的消息目录：X(名称, 级别, 格式)
+// 固件只记录消息编号和参数，格式字符串不进入固件；tools/log_decode.py读取本文件把记录还原为文本
+// 格式只支持%d、%u、%s和%%：整数参数对应%d/%u，字符串参数对应%s（超过LOG_MAX_STRING字节时截断）
+// 消息编号即条目顺序，新条目只能追加在末尾，否则旧固件的日志无法解码
+#define LOG_MESSAGES(X) \
+    X(LOG_DROPPED,            WARN,  "日志缓冲区已满，丢弃%u条记录") \
+    X(JSON_PARSE_FAILED,      WARN,  "JSON解析失败: %s") \
+    X(BINARY_DECODE_FAILED,   WARN,  "二进制命令解码失败: %s") \
+    X(WELCOME,                INFO,  "收到欢迎消息: %s") \
+    X(SERVER_BINARY,          INFO,  "服务器支持二进制命令编码") \
+    X(ASTRBOT_MESSAGE,        INFO,  "AstrBot消息 平台:%s 发送者:%s 私聊:%d 内容:%s") \
+    X(CUSTOM_COMMAND,         INFO,  "收到自定义命令: %s (来自: %s)") \
+    X(UNKNOWN_CUSTOM_COMMAND, WARN,  "未知命令: %s") \
+    X(TEXT_COMMAND,           INFO,  "文本命令: %s") \
+    X(LED_CONTROL,            DEBUG, "LED控制指令 操作:%s 亮度:%d%% 来自:%s") \
+    X(UNKNOWN_LED_ACTION,     WARN,  "未知的LED操作: %s") \
+    X(SERVO_CONTROL,          DEBUG, "舵机控制指令 操作:%s 左腿:%d度 右腿:%d度 时长:%d毫秒 来自:%s") \
+    X(UNKNOWN_SERVO_ACTION,   WARN,  "未知的舵机操作: %s") \
+    X(OLED_CONTROL,           DEBUG, "OLED控制指令 操作:%s 内容:%s 来自:%s") \
+    X(UNKNOWN_OLED_ACTION,    WARN,  "未知的OLED操作: %s") \
+    X(COMMAND_QUEUE_FULL,     WARN,  "命令队列已满，丢弃命令") \
+    X(STATUS_QUEUE_FULL,      WARN,  "状态队列已满，丢弃状态: %s") \
+    X(LATENCY_PENDING_FULL,   WARN,  "等待舵机输出的延迟测量过多，不再等待") \
+    X(LATENCY_DROPPED,        WARN,  "状态队列已满，丢弃延迟测量结果") \
+    X(LEFT_LEG_TARGET,        DEBUG, "左腿目标角度: %d度，时长%u毫秒") \
+    X(RIGHT_LEG_TARGET,       DEBUG, "右腿目标角度: %d度，时长%u毫秒") \
+    X(GAIT_STAND_UP,          INFO,  "设置舵机初始站立角度") \
+    X(GAIT_WALK_FORWARD,      INFO,  "开始前进步态") \
+    X(GAIT_WALK_BACKWARD,     INFO,  "开始后退步态") \
+    X(GAIT_STOP,              INFO,  "停止步行，回到站立位置") \
+    X(WS_TEXT_RECEIVED,       DEBUG, "收到消息(%u字节): %s") \
+    X(WS_BINARY_RECEIVED,     DEBUG, "收到二进制消息(%u字节)") \
+    X(STATUS_QUEUED,          DEBUG, "状态更新已排队: %s") \
+    X(FRAME_TOO_LARGE,        WARN,  "消息超出出站帧大小，已丢弃") \
+    X(FRAME_OVERFLOW,         WARN,  "出站帧超出缓冲区，已丢弃") \
+    X(LED_BRIGHTNESS,         DEBUG, "LED亮度设置为: %d%% (PWM: %d)") \
+    X(OLED_TEXT_RENDERED,     DEBUG, "文本共%u行，绘制耗时%uus，字形缓存命中%u次，未命中%u次") \
+    X(OLED_TEXT_OVER_BUDGET,  WARN,  "文本绘制耗时%uus，超出时间预算") \
+    X(OLED_FLUSH,             DEBUG, "OLED刷新: %u字节") \
+    X(MESSAGE_TOO_LARGE,      WARN,  "消息(%u字节)解析后超出内存池容量(%u字节)，已拒绝") \
+    X(MOTION_QUEUE_FULL,      WARN,  "动作队列已满(%u个)，丢弃动作") \
+    X(MOTION_SUPERSEDED,      DEBUG, "新目标替换了排队中的同类动作(类型%u)") \
+    X(MOTION_QUEUE_CLEARED,   INFO,  "打断当前动作，丢弃%u个排队动作") \
+    X(WALK_START,             INFO,  "连续步行 %s 周期数:%u 时长:%u毫秒 直到停止:%d 步速:%u%%") \
+    X(WALK_FINISHED,          INFO,  "连续步行结束，共走了%u个周期") \
+    X(SERVO_CALIBRATED,       INFO,  "舵机校准 通道:%s %d度 -> %u微秒") \
+    X(SERVO_CAL_RESET,        INFO,  "舵机通道%s恢复默认校准表") \
+    X(SERVO_CAL_LOADED,       INFO,  "舵机通道%s已读取NVS中的校准表") \
+    X(SERVO_CAL_SAVE_FAILED,  WARN,  "舵机通道%s的校准表保存到NVS失败") \
+    X(STATUS_DROPPED,         WARN,  "状态未能排队，已丢弃: %s") \
+    X(ACK_DROPPED,            WARN,  "命令%u的%s回执未能排队，已丢弃") \
+    X(FRAME_DROPPED,          WARN,  "%s帧未能排队，已丢弃") \
+    X(WIFI_CONNECTING,        INFO,  "连接WiFi...") \
+    X(WIFI_CONNECTED,         INFO,  "WiFi连接成功! IP地址: %s") \
+    X(WIFI_TIMEOUT,           WARN,  "WiFi连接超时，%u毫秒后重试") \
+    X(WIFI_LOST,              WARN,  "WiFi连接丢失，尝试重连...") \
+    X(WS_CONNECTING,          INFO,  "正在连接到AstrBot WebSocket服务器: %s") \
+    X(WS_CONNECTED,           INFO,  "WebSocket连接成功!") \
+    X(WS_CONNECT_FAILED,      WARN,  "WebSocket连接失败，%u毫秒后重试") \
+    X(WS_DISCONNECTED,        WARN,  "WebSocket连接断开，准备重连...") \
+    X(WS_REPLAY,              INFO,  "重连后补发%u帧（%u字节）") \
+    X(WS_EVENT_OPENED,        DEBUG, "WebSocket连接已建立") \
+    X(WS_EVENT_CLOSED,        DEBUG, "WebSocket连接已关闭") \
+    X(WS_GOT_PING,            DEBUG, "收到Ping") \
+    X(WS_GOT_PONG,            DEBUG, "收到Pong")
+
+#endif
@@ -5,19 +5,38 @@
 #include "oled_display.h"
 #include "websocket_client.h"
 #include "message_handler.h"
+#include "command.h"
+#include "command_executor.h"
+#include "metrics.h"
+#include "binary_log.h"
 
 // 创建模块对象
 LedController ledController(LED_PIN);
 ServoController servoController;  // 不再需要构造函数参数
 OledDisplay oledDisplay(SCREEN_WIDTH, SCREEN_HEIGHT, I2C_SDA, I2C_SCL, SCREEN_ADDRESS);
 WebSocketClientManager wsClient(WEBSOCKET_SERVER, WEBSOCKET_PORT, DEVICE_ID, HEARTBEAT_INTERVAL);
-MessageHandler messageHandler(&ledController, &servoController, &oledDisplay, &wsClient);
 
-// 回调函数
-void onWebSocketMessage(String message) {
-    messageHandler.handleMessage(message);
+// 跨核队列：命令从网络核流向执行核，状态更新反向流回
+CommandQueue commandQueue;
+StatusQueue statusQueue;
+MessageHandler messageHandler(&commandQueue, &wsClient);
+CommandExecutor commandExecutor(&ledController, &servoController, &oledDisplay, &statusQueue);
+
+TaskHandle_t actuatorTaskHandle = nullptr;
+
+// 回调函数（在网络任务中调用）
+void onWebSocketMessage(const char* data, size_t length, bool binary) {
+    if (binary) {
+        messageHandler.handleBinaryMessage(reinterpret_cast<const uint8_t*>(data), length);
+    } else {
+        messageHandler.handleMessage(data, length);
+    }
+    // 唤醒执行循环，不必等到下一次超时
+    xTaskNotifyGive(actuatorTaskHandle);
 }
 
+void networkTask(void* param);
+
 void onWebSocketConnection(bool connected) {
     if (connected) {
         Serial.println("WebSocket连接成功!");
@@ -29,6 +48,8 @@ void onWebSocketConnection(bool connected) {
 void setup() {
     Serial.begin(9600);
     Serial.println("ESP32S3 启动中...");
+    binaryLogBegin();
+    metricsBegin();
     
     // 初始化各个模块
     Serial.println("初始化LED控制器...");
@@ -41,42 +62,60 @@ void setup() {
         Serial.println("OLED初始化失败，继续运行但没有显示功能");
     }
     
-    // 连接WiFi
-    Serial.println("连接WiFi...");
-    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(1000);
-        Serial.println("正在连接WiFi...");
-    }
-    Serial.println("WiFi连接成功!");
-    Serial.print("IP地址: ");
-    Serial.println(WiFi.localIP());
-    
     // 设置WebSocket回调函数
     wsClient.setMessageCallback(onWebSocketMessage);
     wsClient.setConnectionCallback(onWebSocketConnection);
     
-    // 初始化WebSocket客户端
+    // 初始化WebSocket客户端，WiFi与WebSocket连接都由其非阻塞状态机完成
     Serial.println("初始化WebSocket客户端...");
-    wsClient.begin();
+    wsClient.begin(WIFI_SSID, WIFI_PASSWORD);
+    
+    // loop()所在任务负责执行命令，网络通信与消息解析放到另一个核心
+    actuatorTaskHandle = xTaskGetCurrentTaskHandle();
+    xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK, nullptr, NETWORK_TASK_PRIORITY, nullptr, NETWORK_TASK_CORE);
     
     Serial.println("系统初始化完成!");
 }
 
-void loop() {
-    // 处理WebSocket通信
-    wsClient.loop();
-    
-    // 检查WiFi连接状态
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("WiFi连接丢失，尝试重连...");
-        WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-        while (WiFi.status() != WL_CONNECTED) {
-            delay(1000);
-            Serial.println("重连WiFi中...");
+// 网络任务：处理WiFi/WebSocket连接与通信，解析消息并把命令放入命令队列，
+// 同时把执行核产生的状态更新发送给服务器
+void networkTask(void* param) {
+    StatusEvent event;
+    unsigned long lastHeapSample = 0;
+    for (;;) {
+        wsClient.loop();
+        while (statusQueue.pop(event)) {
+            if (event.topic == StatusTopic::Latency) {
+                wsClient.sendLatencyReport(event.latency);
+            } else if (event.seq != 0) {
+                wsClient.sendCommandAck(event.seq, event.ack, event.reason, event.text);
+            } else {
+                wsClient.sendStatusUpdate(event.text, event.topic);
+            }
         }
-        Serial.println("WiFi重连成功!");
+        if (millis() - lastHeapSample >= METRICS_HEAP_SAMPLE_MS) {
+            metricsSampleHeap();
+            lastHeapSample = millis();
+        }
+        vTaskDelay(pdMS_TO_TICKS(NETWORK_POLL_INTERVAL));
+    }
+}
+
+void loop() {
+    // 执行循环：依次执行队列中的命令，I2C刷新和舵机命令不会阻塞网络通信
+    Command command;
+    while (commandQueue.pop(command)) {
+        commandExecutor.execute(command);
     }
+    commandExecutor.pollMotionEvents();
+    commandExecutor.pollLatency();
+    
+    // 推进OLED表情动画
+    unsigned long now = millis();
+    oledDisplay.tick(now);
     
-    delay(100);
+    // 等待网络任务通知新命令，最长等到下一帧动画；舵机动作由独立的控制任务按固定频率推进
+    unsigned long wait = oledDisplay.timeUntilNextFrame(now);
+    if (wait > ACTUATOR_IDLE_WAIT) wait = ACTUATOR_IDLE_WAIT;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
 }
@@ -0,0 +1,89 @@
+#include "message_arena.h"
+
+MessageArena::MessageArena()
+    : offset(0), lastBlock(SIZE_MAX), highWater(0), exhausted(false) {
+}
+
+size_t MessageArena::alignUp(size_t size) {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+size_t MessageArena::blockSize(size_t header) const {
+    size_t size;
+    memcpy(&size, storage + header, sizeof(size));
+    return size;
+}
+
+void* MessageArena::allocate(size_t size) {
+    size_t needed = ALIGNMENT + alignUp(size);
+    if (needed > MESSAGE_ARENA_SIZE - offset) {
+        exhausted = true;
+        return nullptr;
+    }
+    
+    size_t header = offset;
+    memcpy(storage + header, &size, sizeof(size));
+    offset += needed;
+    lastBlock = header;
+    if (offset > highWater) highWater = offset;
+    return storage + header + ALIGNMENT;
+}
+
+void MessageArena::deallocate(void* ptr) {
+    // 只回收最后一块（ArduinoJson构建字符串时常见的"分配-释放"）；其余块等到reset()统一释放
+    if (ptr && (uint8_t*)ptr == storage + lastBlock + ALIGNMENT) {
+        offset = lastBlock;
+        lastBlock = SIZE_MAX;
+    }
+}
+
+void* MessageArena::reallocate(void* ptr, size_t newSize) {
+    if (!ptr) return allocate(newSize);
+    
+    size_t header = (uint8_t*)ptr - storage - ALIGNMENT;
+    size_t oldSize = blockSize(header);
+    
+    // 最后一块原地伸缩，解析字符串时逐步扩展的缓冲区不会留下空洞
+    if (header == lastBlock) {
+        size_t end = header + ALIGNMENT + alignUp(newSize);
+        if (end > MESSAGE_ARENA_SIZE) {
+            exhausted = true;
+            return nullptr;
+        }
+        memcpy(storage + header, &newSize, sizeof(newSize));
+        offset = end;
+        if (offset > highWater) highWater = offset;
+        return ptr;
+    }
+    
+    if (newSize <= oldSize) {
+        memcpy(storage + header, &newSize, sizeof(newSize));
+        return ptr;
+    }
+    void* moved = allocate(newSize);
+    if (moved) memcpy(moved, ptr, oldSize);
+    return moved;
+}
+
+void MessageArena::reset() {
+    offset = 0;
+    lastBlock = SIZE_MAX;
+    highWater = 0;
+    exhausted = false;
+}
+
+size_t MessageArena::used() const {
+    return offset;
+}
+
+size_t MessageArena::capacity() const {
+    return MESSAGE_ARENA_SIZE;
+}
+
+size_t MessageArena::peak() const {
+    return highWater;
+}
+
+bool MessageArena::overflowed() const {
+    return exhausted;
+}
@@ -0,0 +1,38 @@
+#ifndef MESSAGE_ARENA_H
+#define MESSAGE_ARENA_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// 单条消息的定长内存池：作为ArduinoJson的分配器，解析出的文档连同其中的字符串都放在这里，
+// 消息处理完后reset()一次性释放，整个过程不调用malloc，也不会让堆产生碎片
+// 只在网络任务中使用；容量不足时分配返回nullptr，ArduinoJson据此报告NoMemory
+class MessageArena : public ArduinoJson::Allocator {
+public:
+    static const size_t ALIGNMENT = 8;  // 每块的对齐，同时也是块头（记录块大小）的长度
+
+private:
+    alignas(ALIGNMENT) uint8_t storage[MESSAGE_ARENA_SIZE];
+    size_t offset;       // 下一个空闲字节
+    size_t lastBlock;    // 最后一块的块头位置，只有它可以原地扩展或回收
+    size_t highWater;    // reset()之前达到过的最大用量
+    bool exhausted;      // 本条消息是否出现过分配失败
+    
+    static size_t alignUp(size_t size);
+    size_t blockSize(size_t header) const;
+
+public:
+    MessageArena();
+    void* allocate(size_t size) override;
+    void deallocate(void* ptr) override;
+    void* reallocate(void* ptr, size_t newSize) override;
+    
+    void reset();  // O(1)：只复位偏移量，之前分配的内存全部失效
+    size_t used() const;
+    size_t capacity() const;
+    size_t peak() const;      // 本条消息的最大用量
+    bool overflowed() const;  // 本条消息是否因容量不足而分配失败
+};
+
+#endif
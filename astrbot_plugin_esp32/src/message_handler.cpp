@@ -1,248 +1,385 @@
 #include "message_handler.h"
+#include "binary_protocol.h"
+#include "text_command_matcher.h"
+#include "metrics.h"
+#include "binary_log.h"
+#include "servo_calibration.h"
 
-MessageHandler::MessageHandler(LedController* led, ServoController* servo, OledDisplay* oled, WebSocketClientManager* ws)
-    : ledController(led), servoController(servo), oledDisplay(oled), wsClient(ws) {
+// 动作名称到命令的映射
+struct ActionName {
+    const char* name;
+    CommandAction action;
+};
+
+static const ActionName SERVO_ACTIONS[] = {
+    {"walk_forward", CommandAction::WalkForward},
+    {"walk_backward", CommandAction::WalkBackward},
+    {"stand_up", CommandAction::StandUp},
+    {"stop", CommandAction::Stop},
+    {"left_forward", CommandAction::LeftForward},
+    {"left_backward", CommandAction::LeftBackward},
+    {"right_forward", CommandAction::RightForward},
+    {"right_backward", CommandAction::RightBackward},
+    {"move_legs", CommandAction::MoveLegs},
+    {"move_left", CommandAction::MoveLeft},
+    {"move_right", CommandAction::MoveRight},
+    {"status", CommandAction::ServoStatus},
+    {"walk", CommandAction::Walk}
+};
+
+static const ActionName OLED_ACTIONS[] = {
+    {"emotion", CommandAction::OledEmotion},
+    {"text", CommandAction::OledText},
+    {"clear", CommandAction::OledClear},
+    {"page", CommandAction::OledPage},
+    {"scroll", CommandAction::OledScroll}
+};
+
+static const ActionName LED_ACTIONS[] = {
+    {"on", CommandAction::LedOn},
+    {"off", CommandAction::LedOff},
+    {"toggle", CommandAction::LedToggle},
+    {"status", CommandAction::LedStatus}
+};
+
+template <size_t N>
+static bool findAction(const ActionName (&table)[N], const char* name, CommandAction& action) {
+    for (size_t i = 0; i < N; i++) {
+        if (strcmp(table[i].name, name) == 0) {
+            action = table[i].action;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 插值曲线名称，返回值为MotionProfile + 1，0表示不修改
+static uint8_t parseProfile(const char* profile) {
+    if (strcmp(profile, "linear") == 0) return 1;
+    if (strcmp(profile, "cubic") == 0) return 2;
+    if (strcmp(profile, "min_jerk") == 0) return 3;
+    return 0;
 }
 
-void MessageHandler::handleMessage(String message) {
-    // 解析JSON消息
-    JsonDocument doc;
-    deserializeJson(doc, message);
+static int clampAngle(int angle) {
+    if (angle < 0) return 0;
+    if (angle > 180) return 180;
+    return angle;
+}
+
+MessageHandler::MessageHandler(CommandQueue* commands, WebSocketClientManager* ws)
+    : commandQueue(commands), wsClient(ws), messageT0(0), messageReceivedAt(0), messageSeq(0), messageAcked(false) {
+    // 各处理函数实际读取的字段；components、sender_id、group_id等字段在解析时直接跳过
+    filter["type"] = true;
+    filter["message"] = true;
+    filter["encodings"] = true;
+    filter["platform"] = true;
+    filter["sender_name"] = true;
+    filter["message_text"] = true;
+    filter["is_private"] = true;
+    filter["command"] = true;
+    filter["action"] = true;
+    filter["brightness"] = true;
+    filter["left_angle"] = true;
+    filter["right_angle"] = true;
+    filter["angle"] = true;
+    filter["duration_ms"] = true;
+    filter["profile"] = true;
+    filter["content"] = true;
+    filter["from_user"] = true;
+    filter["t0"] = true;
+    filter["reset"] = true;
+    filter["seq"] = true;
+    filter["direction"] = true;
+    filter["steps"] = true;
+    filter["until_stop"] = true;
+    filter["tempo"] = true;
+    filter["channel"] = true;
+    filter["pulse_us"] = true;
+}
+
+void MessageHandler::handleMessage(const char* data, size_t length) {
+    messageReceivedAt = micros();
+    messageSeq = 0;
+    messageAcked = false;
+    parseAndDispatch(data, length);
     
-    String messageType = doc["type"];
+    // 文档已随parseAndDispatch返回而析构，内存池整体复位
+    metricsRecordArena(arena.peak(), arena.overflowed());
+    arena.reset();
     
-    if (messageType == "welcome") {
+    // 没有产生命令的消息（如没有匹配到关键字的聊天消息）直接回执完成，服务器不必等到超时
+    if (messageSeq != 0 && !messageAcked) {
+        wsClient->sendCommandAck(messageSeq, AckState::Completed);
+    }
+}
+
+void MessageHandler::parseAndDispatch(const char* data, size_t length) {
+    // 直接从接收缓冲区解析JSON，并用过滤器跳过不需要的字段；文档和其中的字符串都分配在内存池中
+    JsonDocument doc(&arena);
+    DeserializationError error;
+    {
+        MetricProbe probe(MetricStage::Parse);
+        error = deserializeJson(doc, data, length, DeserializationOption::Filter(filter));
+    }
+    if (error == DeserializationError::NoMemory) {
+        LOG(MESSAGE_TOO_LARGE, length, arena.capacity());
+        wsClient->sendStatusUpdate("消息过大，已拒绝", StatusTopic::None);
+        return;
+    }
+    if (error) {
+        LOG(JSON_PARSE_FAILED, error.c_str());
+        return;
+    }
+    messageT0 = doc["t0"] | (uint32_t)0;
+    messageSeq = doc["seq"] | (uint32_t)0;
+    
+    MetricProbe probe(MetricStage::Dispatch);
+    const char* messageType = doc["type"] | "";
+    
+    if (strcmp(messageType, "welcome") == 0) {
         handleWelcomeMessage(doc);
-    } else if (messageType == "led_control") {
+    } else if (strcmp(messageType, "led_control") == 0) {
         handleLedControl(doc);
-    } else if (messageType == "oled_control") {
+    } else if (strcmp(messageType, "oled_control") == 0) {
         handleOledControl(doc);
-    } else if (messageType == "servo_control") {
+    } else if (strcmp(messageType, "servo_control") == 0) {
         handleServoControl(doc);
-    } else if (messageType == "astrbot_message") {
+    } else if (strcmp(messageType, "servo_calibrate") == 0) {
+        handleServoCalibrate(doc);
+    } else if (strcmp(messageType, "astrbot_message") == 0) {
         handleAstrBotMessage(doc);
-    } else if (messageType == "custom_command") {
+    } else if (strcmp(messageType, "custom_command") == 0) {
         handleCustomCommand(doc);
-    } else if (messageType == "heartbeat_ack") {
+    } else if (strcmp(messageType, "heartbeat_ack") == 0) {
         handleHeartbeatAck(doc);
+    } else if (strcmp(messageType, "metrics") == 0) {
+        handleMetricsRequest(doc);
+    }
+}
+
+void MessageHandler::handleBinaryMessage(const uint8_t* data, size_t length) {
+    messageReceivedAt = micros();
+    messageSeq = 0;
+    messageAcked = false;
+    
+    // 二进制帧直接解码为命令，跳过JSON解析
+    Command command = {};
+    BinaryDecodeResult result;
+    {
+        MetricProbe probe(MetricStage::Parse);
+        result = decodeBinaryCommand(data, length, command);
+    }
+    if (result != BinaryDecodeResult::Ok) {
+        LOG(BINARY_DECODE_FAILED, binaryDecodeResultName(result));
+        wsClient->sendStatusUpdatef(StatusTopic::None, "二进制命令解码失败: %s", binaryDecodeResultName(result));
+        return;
     }
+    messageT0 = command.t0;
+    messageSeq = command.seq;
+    
+    MetricProbe probe(MetricStage::Dispatch);
+    submitCommand(command);
 }
 
 void MessageHandler::handleWelcomeMessage(JsonDocument& doc) {
-    Serial.println("收到欢迎消息: " + doc["message"].as<String>());
+    LOG(WELCOME, doc["message"] | "");
+    
+    // 服务器声明支持二进制编码时，会在收到connected状态后改用二进制帧下发命令
+    for (JsonVariant encoding : doc["encodings"].as<JsonArray>()) {
+        if (strcmp(encoding | "", BINARY_ENCODING_NAME) == 0) {
+            LOG(SERVER_BINARY);
+        }
+    }
 }
 
 void MessageHandler::handleAstrBotMessage(JsonDocument& doc) {
-    String platform = doc["platform"];
-    String senderName = doc["sender_name"];
-    String messageText = doc["message_text"];
+    // 字段直接引用文档内的字符串，不复制
+    const char* platform = doc["platform"] | "";
+    const char* senderName = doc["sender_name"] | "";
+    const char* messageText = doc["message_text"] | "";
     bool isPrivate = doc["is_private"];
     
-    Serial.println("=== AstrBot消息 ===");
-    Serial.println("平台: " + platform);
-    Serial.println("发送者: " + senderName);
-    Serial.println("消息: " + messageText);
-    Serial.println("私聊: " + String(isPrivate ? "是" : "否"));
-    Serial.println("==================");
+    LOG(ASTRBOT_MESSAGE, platform, senderName, isPrivate, messageText);
     
     // 处理文本命令
     processTextCommands(messageText);
 }
 
 void MessageHandler::handleCustomCommand(JsonDocument& doc) {
-    String command = doc["command"];
-    String fromUser = doc["from_user"];
+    const char* command = doc["command"] | "";
+    const char* fromUser = doc["from_user"] | "";
     
-    Serial.println("收到自定义命令: " + command + " (来自: " + fromUser + ")");
+    LOG(CUSTOM_COMMAND, command, fromUser);
     processCustomCommand(command);
 }
 
 void MessageHandler::handleLedControl(JsonDocument& doc) {
-    String action = doc["action"];
+    const char* action = doc["action"] | "";
     int brightness = doc["brightness"] | 100;  // 默认100%亮度
-    String fromUser = doc["from_user"];
-    
-    Serial.println("=== LED控制指令 ===");
-    Serial.println("操作: " + action);
-    Serial.println("亮度: " + String(brightness) + "%");
-    Serial.println("来自用户: " + fromUser);
-    Serial.println("==================");
-    
-    if (action == "on") {
-        ledController->setState(true);
-        ledController->setBrightness(brightness);
-        wsClient->sendStatusUpdate("LED已开启，亮度" + String(brightness) + "%");
-    } else if (action == "off") {
-        ledController->setState(false);
-        wsClient->sendStatusUpdate("LED已关闭");
-    } else if (action == "toggle") {
-        ledController->toggle();
-        if (ledController->getState()) {
-            ledController->setBrightness(brightness);
-            wsClient->sendStatusUpdate("LED已开启，亮度" + String(brightness) + "%");
-        } else {
-            wsClient->sendStatusUpdate("LED已关闭");
-        }
-    } else {
-        Serial.println("未知的LED操作: " + action);
-        wsClient->sendStatusUpdate("未知的LED操作: " + action);
+    const char* fromUser = doc["from_user"] | "";
+    
+    LOG(LED_CONTROL, action, brightness, fromUser);
+    
+    Command command = {};
+    if (!findAction(LED_ACTIONS, action, command.action)) {
+        LOG(UNKNOWN_LED_ACTION, action);
+        rejectMessage("unknown_action", "未知的LED操作: %s", action);
+        return;
     }
+    command.brightness = constrain(brightness, 0, 100);
+    submitCommand(command);
 }
 
 void MessageHandler::handleServoControl(JsonDocument& doc) {
-    String action = doc["action"];
+    const char* action = doc["action"] | "";
     int leftAngle = doc["left_angle"] | 90;   // 左腿角度，默认90度
     int rightAngle = doc["right_angle"] | 90; // 右腿角度，默认90度
-    int angle = doc["angle"] | 90;            // 通用角度，用于向后兼容
-    String fromUser = doc["from_user"];
-    
-    Serial.println("=== 舵机腿部控制指令 ===");
-    Serial.println("操作: " + action);
-    Serial.println("左腿角度: " + String(leftAngle) + "度");
-    Serial.println("右腿角度: " + String(rightAngle) + "度");
-    Serial.println("来自用户: " + fromUser);
-    Serial.println("========================");
-    
-    if (action == "walk_forward") {
-        servoController->walkForward();
-        wsClient->sendStatusUpdate("机器人开始前进步态");
-    } else if (action == "walk_backward") {
-        servoController->walkBackward();
-        wsClient->sendStatusUpdate("机器人开始后退步态");  
-    } else if (action == "stand_up") {
-        servoController->standUp();
-        wsClient->sendStatusUpdate("机器人站立完成");
-    } else if (action == "stop") {
-        servoController->stopWalk();
-        wsClient->sendStatusUpdate("机器人停止步行，回到站立位置");
-    } else if (action == "left_forward") {
-        servoController->leftLegForward();
-        wsClient->sendStatusUpdate("左腿前进动作完成");
-    } else if (action == "left_backward") {
-        servoController->leftLegBackward();
-        wsClient->sendStatusUpdate("左腿后退动作完成");
-    } else if (action == "right_forward") {
-        servoController->rightLegForward();
-        wsClient->sendStatusUpdate("右腿前进动作完成");
-    } else if (action == "right_backward") {
-        servoController->rightLegBackward();
-        wsClient->sendStatusUpdate("右腿后退动作完成");
-    } else if (action == "move_legs") {
-        servoController->moveLegs(leftAngle, rightAngle);
-        wsClient->sendStatusUpdate("腿部移动到指定角度：左腿" + String(leftAngle) + "度，右腿" + String(rightAngle) + "度");
-    } else if (action == "move_left") {
-        servoController->moveLeftLeg(leftAngle);
-        wsClient->sendStatusUpdate("左腿移动到" + String(leftAngle) + "度");
-    } else if (action == "move_right") {
-        servoController->moveRightLeg(rightAngle);
-        wsClient->sendStatusUpdate("右腿移动到" + String(rightAngle) + "度");
-    } else {
-        Serial.println("未知的舵机操作: " + action);
-        wsClient->sendStatusUpdate("未知的舵机腿部操作: " + action);
+    int duration = doc["duration_ms"] | 0;    // 移动时长，0表示直接跳转
+    const char* profile = doc["profile"] | "";  // 插值曲线：linear/cubic/min_jerk
+    const char* fromUser = doc["from_user"] | "";
+    
+    LOG(SERVO_CONTROL, action, leftAngle, rightAngle, duration, fromUser);
+    
+    Command command = {};
+    if (!findAction(SERVO_ACTIONS, action, command.action)) {
+        LOG(UNKNOWN_SERVO_ACTION, action);
+        rejectMessage("unknown_action", "未知的舵机腿部操作: %s", action);
+        return;
+    }
+    command.profile = parseProfile(profile);
+    command.leftAngle = clampAngle(leftAngle);
+    command.rightAngle = clampAngle(rightAngle);
+    command.durationMs = duration > 0 ? duration : 0;
+    
+    // 连续步行：steps、duration_ms、until_stop任选其一作为结束条件，都没有时走一个周期
+    int steps = doc["steps"] | 0;
+    int tempo = doc["tempo"] | 100;  // 步速百分比
+    command.walkSteps = constrain(steps, 0, 65535);
+    command.walkTempo = constrain(tempo, 1, 255);
+    command.walkFlags = 0;
+    if (strcmp(doc["direction"] | "forward", "backward") == 0) command.walkFlags |= WALK_FLAG_BACKWARD;
+    if (doc["until_stop"] | false) command.walkFlags |= WALK_FLAG_UNTIL_STOP;
+    submitCommand(command);
+}
+
+void MessageHandler::handleServoCalibrate(JsonDocument& doc) {
+    const char* channel = doc["channel"] | "";
+    int angle = doc["angle"] | -1;
+    int pulseUs = doc["pulse_us"] | 0;  // 不给脉宽时只查询校准表
+    
+    if (strcmp(channel, "left") != 0 && strcmp(channel, "right") != 0) {
+        rejectMessage("unknown_channel", "未知的舵机通道: %s", channel);
+        return;
     }
+    
+    Command command = {};
+    command.action = CommandAction::ServoCalibrate;
+    strcpy(command.text, channel);
+    if (doc["reset"] | false) {
+        command.pulseUs = SERVO_CALIBRATION_RESET;
+    } else if (pulseUs != 0) {
+        if (!ServoCalibration::isValidPoint(angle, pulseUs)) {
+            rejectMessage("invalid_calibration", "校准点无效: %d度 %d微秒（角度须为%d的倍数，脉宽须在%d-%d之间）",
+                          angle, pulseUs, SERVO_CALIBRATION_STEP, SERVO_PULSE_MIN_US, SERVO_PULSE_MAX_US);
+            return;
+        }
+        command.leftAngle = angle;
+        command.pulseUs = pulseUs;
+    }
+    submitCommand(command);
 }
 
 void MessageHandler::handleOledControl(JsonDocument& doc) {
-    String action = doc["action"];
-    String content = doc["content"] | "";
-    String fromUser = doc["from_user"];
-    
-    Serial.println("=== OLED控制指令 ===");
-    Serial.println("操作: " + action);
-    Serial.println("内容: " + content);
-    Serial.println("来自用户: " + fromUser);
-    Serial.println("==================");
-    
-    if (action == "emotion") {
-        oledDisplay->displayEmotion(content);
-        wsClient->sendStatusUpdate("OLED显示表情: " + content);
-    } else if (action == "text") {
-        oledDisplay->displayText(content);
-        wsClient->sendStatusUpdate("OLED显示文本: " + content);
-    } else if (action == "clear") {
-        oledDisplay->clear();
-        wsClient->sendStatusUpdate("OLED屏幕已清除");
-    } else {
-        Serial.println("未知的OLED操作: " + action);
-        wsClient->sendStatusUpdate("未知的OLED操作: " + action);
+    const char* action = doc["action"] | "";
+    const char* content = doc["content"] | "";
+    const char* fromUser = doc["from_user"] | "";
+    
+    LOG(OLED_CONTROL, action, content, fromUser);
+    
+    Command command = {};
+    if (!findAction(OLED_ACTIONS, action, command.action)) {
+        LOG(UNKNOWN_OLED_ACTION, action);
+        rejectMessage("unknown_action", "未知的OLED操作: %s", action);
+        return;
     }
+    // 内容超长时截断，并去掉被截断的半个UTF-8字符
+    strncpy(command.text, content, sizeof(command.text) - 1);
+    utf8TrimPartial(command.text);
+    submitCommand(command);
 }
 
 void MessageHandler::handleHeartbeatAck(JsonDocument& doc) {
     // 心跳确认，静默处理
 }
 
-void MessageHandler::processCustomCommand(String command) {
-    if (command == "restart") {
-        Serial.println("执行重启命令");
-        ESP.restart();
-    } else if (command == "status") {
-        wsClient->sendStatusUpdate("设备运行正常");
-    } else if (command.startsWith("led_")) {
-        if (command == "led_on") {
-            ledController->setState(true);
-            wsClient->sendStatusUpdate("LED已开启");
-        } else if (command == "led_off") {
-            ledController->setState(false);
-            wsClient->sendStatusUpdate("LED已关闭");
-        }
+void MessageHandler::handleMetricsRequest(JsonDocument& doc) {
+    // 报告由网络任务在出站队列有空位时分帧发出
+    bool reset = doc["reset"] | false;
+    wsClient->sendMetricsReport(reset);
+}
+
+void MessageHandler::submitCommand(Command& command) {
+    command.t0 = messageT0;
+    command.receivedAt = messageReceivedAt;
+    command.seq = messageSeq;
+    
+    // 命令队列满说明执行核跟不上，直接拒绝并告知服务器，不阻塞网络核
+    if (!commandQueue->push(command)) {
+        LOG(COMMAND_QUEUE_FULL);
+        rejectMessage("queue_full", "设备忙，命令已丢弃");
+        return;
+    }
+    if (messageSeq != 0) {
+        wsClient->sendCommandAck(messageSeq, AckState::Accepted);
+        messageAcked = true;
+    }
+}
+
+void MessageHandler::rejectMessage(const char* reason, const char* format, ...) {
+    char text[STATUS_TEXT_SIZE];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    utf8TrimPartial(text);
+    
+    // 带序号的命令以rejected回执告知原因，其余情况仍发送普通状态
+    if (messageSeq != 0) {
+        wsClient->sendCommandAck(messageSeq, AckState::Rejected, reason, text);
+        messageAcked = true;
+    } else {
+        wsClient->sendStatusUpdate(text, StatusTopic::None);
+    }
+}
+
+void MessageHandler::submitAction(CommandAction action) {
+    Command command = {};
+    command.action = action;
+    command.brightness = LED_BRIGHTNESS_KEEP;  // 文本和自定义命令只开灯，不改变之前设置的亮度
+    submitCommand(command);
+}
+
+void MessageHandler::processCustomCommand(const char* command) {
+    if (strcmp(command, "restart") == 0) {
+        submitAction(CommandAction::Restart);
+    } else if (strcmp(command, "status") == 0) {
+        submitAction(CommandAction::DeviceStatus);
+    } else if (strcmp(command, "led_on") == 0) {
+        submitAction(CommandAction::LedOn);
+    } else if (strcmp(command, "led_off") == 0) {
+        submitAction(CommandAction::LedOff);
     } else {
-        Serial.println("未知命令: " + command);
-    }
-}
-
-void MessageHandler::processTextCommands(String messageText) {
-    // LED控制命令
-    if (messageText.indexOf("亮灯") != -1 || messageText.indexOf("开灯") != -1 || messageText.indexOf("点亮") != -1) {
-        Serial.println("执行点亮LED操作");
-        ledController->setState(true);
-        wsClient->sendStatusUpdate("LED已点亮");
-    } else if (messageText.indexOf("关灯") != -1 || messageText.indexOf("熄灭") != -1 || messageText.indexOf("关闭") != -1) {
-        Serial.println("执行关闭LED操作");
-        ledController->setState(false);
-        wsClient->sendStatusUpdate("LED已关闭");
-    } else if (messageText.indexOf("LED状态") != -1 || messageText.indexOf("灯状态") != -1) {
-        String status = ledController->getStatusString();
-        Serial.println(status);
-        wsClient->sendStatusUpdate(status);
-    }
-    
-    // 机器人步行控制命令
-    else if (messageText.indexOf("前进") != -1 || messageText.indexOf("向前") != -1 || messageText.indexOf("走前") != -1) {
-        Serial.println("执行前进步态");
-        servoController->walkForward();
-        wsClient->sendStatusUpdate("机器人开始前进");
-    } else if (messageText.indexOf("后退") != -1 || messageText.indexOf("向后") != -1 || messageText.indexOf("倒退") != -1) {
-        Serial.println("执行后退步态");
-        servoController->walkBackward();
-        wsClient->sendStatusUpdate("机器人开始后退");
-    } else if (messageText.indexOf("站立") != -1 || messageText.indexOf("站起") != -1 || messageText.indexOf("起立") != -1) {
-        Serial.println("执行站立动作");
-        servoController->standUp();
-        wsClient->sendStatusUpdate("机器人站立完成");
-    } else if (messageText.indexOf("停止") != -1 || messageText.indexOf("停下") != -1 || messageText.indexOf("不动") != -1) {
-        Serial.println("执行停止动作");
-        servoController->stopWalk();
-        wsClient->sendStatusUpdate("机器人停止移动");
-    } else if (messageText.indexOf("左腿前") != -1 || messageText.indexOf("左脚前") != -1) {
-        Serial.println("左腿前进动作");
-        servoController->leftLegForward();
-        wsClient->sendStatusUpdate("左腿前进完成");
-    } else if (messageText.indexOf("左腿后") != -1 || messageText.indexOf("左脚后") != -1) {
-        Serial.println("左腿后退动作");
-        servoController->leftLegBackward();
-        wsClient->sendStatusUpdate("左腿后退完成");
-    } else if (messageText.indexOf("右腿前") != -1 || messageText.indexOf("右脚前") != -1) {
-        Serial.println("右腿前进动作");
-        servoController->rightLegForward();
-        wsClient->sendStatusUpdate("右腿前进完成");
-    } else if (messageText.indexOf("右腿后") != -1 || messageText.indexOf("右脚后") != -1) {
-        Serial.println("右腿后退动作");
-        servoController->rightLegBackward();
-        wsClient->sendStatusUpdate("右腿后退完成");
-    } else if (messageText.indexOf("舵机状态") != -1 || messageText.indexOf("腿部状态") != -1) {
-        String status = servoController->getStatusString();
-        Serial.println(status);
-        wsClient->sendStatusUpdate(status);
+        LOG(UNKNOWN_CUSTOM_COMMAND, command);
+        rejectMessage("unknown_command", "未知命令: %s", command);
     }
 }
+
+void MessageHandler::processTextCommands(const char* messageText) {
+    // 关键字表已编译为自动机（tools/gen_text_commands.py），一次扫描找出最高优先级的命令
+    uint8_t rule = matchTextCommand(messageText, strlen(messageText));
+    if (rule == TEXT_COMMAND_NO_RULE) return;
+    
+    LOG(TEXT_COMMAND, TEXT_COMMAND_RULE_NAMES[rule]);
+    submitAction(TEXT_COMMAND_RULE_ACTIONS[rule]);
+}
@@ -3,33 +3,44 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
-#include "led_controller.h"
-#include "servo_controller.h"
-#include "oled_display.h"
+#include "command.h"
 #include "websocket_client.h"
+#include "message_arena.h"
 
+// 在网络核上运行：只负责解析消息并生成命令，实际执行交给执行核的CommandExecutor
 class MessageHandler {
 private:
-    LedController* ledController;
-    ServoController* servoController;
-    OledDisplay* oledDisplay;
+    CommandQueue* commandQueue;
     WebSocketClientManager* wsClient;
+    JsonDocument filter;  // 解析过滤器：只保留固件会读取的字段
+    MessageArena arena;   // 每条消息的文档都分配在这里，处理完整体复位
+    uint32_t messageT0;          // 当前消息携带的t0，附加到由它生成的命令上
+    uint32_t messageReceivedAt;  // 当前消息的接收时刻（micros()）
+    uint32_t messageSeq;         // 当前消息的命令序号，0表示服务器不需要回执
+    bool messageAcked;           // 当前消息是否已经回执过
 
 public:
-    MessageHandler(LedController* led, ServoController* servo, OledDisplay* oled, WebSocketClientManager* ws);
-    void handleMessage(String message);
+    MessageHandler(CommandQueue* commands, WebSocketClientManager* ws);
+    void handleMessage(const char* data, size_t length);
+    void handleBinaryMessage(const uint8_t* data, size_t length);
     
 private:
+    void parseAndDispatch(const char* data, size_t length);
     void handleWelcomeMessage(JsonDocument& doc);
     void handleAstrBotMessage(JsonDocument& doc);
     void handleCustomCommand(JsonDocument& doc);
     void handleLedControl(JsonDocument& doc);
     void handleServoControl(JsonDocument& doc);
     void handleOledControl(JsonDocument& doc);
+    void handleServoCalibrate(JsonDocument& doc);
     void handleHeartbeatAck(JsonDocument& doc);
+    void handleMetricsRequest(JsonDocument& doc);
     
-    void processCustomCommand(String command);
-    void processTextCommands(String messageText);
+    void processCustomCommand(const char* command);
+    void processTextCommands(const char* messageText);
+    void submitCommand(Command& command);
+    void submitAction(CommandAction action);
+    void rejectMessage(const char* reason, const char* format, ...) __attribute__((format(printf, 3, 4)));
 };
 
 #endif
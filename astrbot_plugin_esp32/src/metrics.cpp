@@ -0,0 +1,129 @@
+#include "metrics.h"
+#include "config.h"
+
+static const char* const STAGE_NAMES[] = {
+    "frame_receive",
+    "parse",
+    "dispatch",
+    "actuator",
+    "status_serialize",
+    "status_send",
+    "time_to_stop"
+};
+
+static LatencyHistogram histograms[(uint8_t)MetricStage::Count];
+static uint32_t cyclesPerUs = 240;
+static uint32_t minMaxAlloc = UINT32_MAX;
+static uint32_t arenaPeak = 0;
+static uint32_t arenaOverflows = 0;
+static volatile uint32_t servoExecuted = 0;
+static volatile uint32_t servoSuppressed = 0;
+static volatile uint32_t servoSlewLimited = 0;
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+void LatencyHistogram::record(uint32_t us) {
+    // 桶序号即耗时的二进制位数
+    uint8_t index = us == 0 ? 0 : 32 - __builtin_clz(us);
+    if (index >= BUCKETS) index = BUCKETS - 1;
+    buckets[index]++;
+    count++;
+    if (us > maxUs) maxUs = us;
+}
+
+void LatencyHistogram::reset() {
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+        buckets[i] = 0;
+    }
+    count = 0;
+    maxUs = 0;
+}
+
+uint32_t LatencyHistogram::getCount() const {
+    return count;
+}
+
+uint32_t LatencyHistogram::getMaxUs() const {
+    return maxUs;
+}
+
+uint32_t LatencyHistogram::getBucket(uint8_t index) const {
+    return index < BUCKETS ? buckets[index] : 0;
+}
+
+void metricsBegin() {
+    cyclesPerUs = ESP.getCpuFreqMHz();
+    if (cyclesPerUs == 0) cyclesPerUs = 1;
+    metricsSampleHeap();
+}
+
+void metricsRecordCycles(MetricStage stage, uint32_t cycles) {
+    histograms[(uint8_t)stage].record(cycles / cyclesPerUs);
+}
+
+void metricsRecordMicros(MetricStage stage, uint32_t us) {
+    histograms[(uint8_t)stage].record(us);
+}
+
+const LatencyHistogram& metricsHistogram(MetricStage stage) {
+    return histograms[(uint8_t)stage];
+}
+
+const char* metricStageName(MetricStage stage) {
+    return stage < MetricStage::Count ? STAGE_NAMES[(uint8_t)stage] : "unknown";
+}
+
+void metricsSampleHeap() {
+    uint32_t maxAlloc = ESP.getMaxAllocHeap();
+    if (maxAlloc < minMaxAlloc) minMaxAlloc = maxAlloc;
+}
+
+void metricsRecordArena(uint32_t peakBytes, bool overflowed) {
+    if (peakBytes > arenaPeak) arenaPeak = peakBytes;
+    if (overflowed) arenaOverflows++;
+}
+
+HeapMetrics metricsHeap() {
+    metricsSampleHeap();
+    HeapMetrics heap;
+    heap.freeBytes = ESP.getFreeHeap();
+    heap.minFreeBytes = ESP.getMinFreeHeap();
+    heap.maxAllocBytes = ESP.getMaxAllocHeap();
+    heap.minMaxAllocBytes = minMaxAlloc;
+    heap.arenaBytes = MESSAGE_ARENA_SIZE;
+    heap.arenaPeakBytes = arenaPeak;
+    heap.arenaOverflows = arenaOverflows;
+    return heap;
+}
+
+void metricsRecordServoWrite(bool executed, bool slewLimited) {
+    if (executed) {
+        servoExecuted++;
+    } else {
+        servoSuppressed++;
+    }
+    if (slewLimited) servoSlewLimited++;
+}
+
+ServoWriteMetrics metricsServoWrites() {
+    ServoWriteMetrics writes;
+    writes.executed = servoExecuted;
+    writes.suppressed = servoSuppressed;
+    writes.slewLimited = servoSlewLimited;
+    return writes;
+}
+
+void metricsReset() {
+    for (uint8_t i = 0; i < (uint8_t)MetricStage::Count; i++) {
+        histograms[i].reset();
+    }
+    minMaxAlloc = UINT32_MAX;
+    arenaPeak = 0;
+    arenaOverflows = 0;
+    servoExecuted = 0;
+    servoSuppressed = 0;
+    servoSlewLimited = 0;
+    metricsSampleHeap();
+}
@@ -0,0 +1,80 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// 命令路径上的各个阶段，每个阶段对应一个延迟直方图
+enum class MetricStage : uint8_t {
+    FrameReceive,     // WebSocket帧读取与重组（网络核）
+    Parse,            // JSON解析或bin1解码（网络核）
+    Dispatch,         // 按消息类型分发并生成命令（网络核）
+    Actuator,         // 执行命令，驱动LED/舵机/OLED（执行核）
+    StatusSerialize,  // 状态、心跳和回报帧的序列化与入队（网络核）
+    StatusSend,       // 单个出站帧的WebSocket发送（网络核）
+    MotionStop,       // 停止/站立命令从网络核收到到控制任务打断当前动作（跨核，按micros()计）
+    Count
+};
+
+// 定长对数直方图，不使用堆内存：第0桶为0微秒，第i桶为[2^(i-1), 2^i)微秒，最后一桶收纳所有更大的值
+// 每个直方图只由一个核写入，另一个核读取时个别计数可能差一次记录，对统计没有影响
+class LatencyHistogram {
+public:
+    static const uint8_t BUCKETS = 20;  // 最后一桶从2^18微秒（约262毫秒）开始
+
+private:
+    volatile uint32_t buckets[BUCKETS];
+    volatile uint32_t count;
+    volatile uint32_t maxUs;
+
+public:
+    LatencyHistogram();
+    void record(uint32_t us);
+    void reset();
+    uint32_t getCount() const;
+    uint32_t getMaxUs() const;
+    uint32_t getBucket(uint8_t index) const;
+};
+
+// 堆内存水位
+struct HeapMetrics {
+    uint32_t freeBytes;         // 当前空闲堆
+    uint32_t minFreeBytes;      // 启动以来空闲堆的最低值
+    uint32_t maxAllocBytes;     // 当前最大可分配块
+    uint32_t minMaxAllocBytes;  // 采样到的最大可分配块最低值，反映碎片化程度
+    uint32_t arenaBytes;        // 消息解析内存池容量
+    uint32_t arenaPeakBytes;    // 单条消息用到的内存池最大字节数
+    uint32_t arenaOverflows;    // 因内存池不足被拒绝的消息数
+};
+
+// 舵机输出级的写入统计（两个通道合计）
+struct ServoWriteMetrics {
+    uint32_t executed;     // 实际写入舵机的次数
+    uint32_t suppressed;   // 取整后角度未变而省去的写入
+    uint32_t slewLimited;  // 因超过最大转速而被限速的控制周期数
+};
+
+void metricsBegin();  // 在setup()中调用，读取CPU频率用于周期数换算
+void metricsRecordCycles(MetricStage stage, uint32_t cycles);
+void metricsRecordMicros(MetricStage stage, uint32_t us);  // 跨核的阶段无法用周期计数器，直接记录微秒
+const LatencyHistogram& metricsHistogram(MetricStage stage);
+const char* metricStageName(MetricStage stage);
+void metricsSampleHeap();  // 由网络任务定期调用，更新最大可分配块的最低值
+void metricsRecordArena(uint32_t peakBytes, bool overflowed);  // 每条消息处理完后记录内存池用量
+HeapMetrics metricsHeap();
+void metricsRecordServoWrite(bool executed, bool slewLimited);  // 由舵机控制任务在每次输出时调用
+ServoWriteMetrics metricsServoWrites();
+void metricsReset();       // 清空直方图、最大可分配块的最低值、内存池水位和舵机写入统计
+
+// 作用域探针：构造时读取周期计数器，析构时把耗时记录到对应阶段
+// 周期计数器每个核独立，探针必须在同一个任务里开始和结束
+class MetricProbe {
+private:
+    MetricStage stage;
+    uint32_t startedAt;
+
+public:
+    explicit MetricProbe(MetricStage s) : stage(s), startedAt(ESP.getCycleCount()) {}
+    ~MetricProbe() { metricsRecordCycles(stage, ESP.getCycleCount() - startedAt); }
+};
+
+#endif
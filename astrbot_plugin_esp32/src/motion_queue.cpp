@@ -0,0 +1,93 @@
+#include "motion_queue.h"
+
+MotionTag::MotionTag() : seq(0), t0(0) {
+}
+
+MotionTag::MotionTag(uint32_t seq, uint32_t t0) : seq(seq), t0(t0) {
+}
+
+bool MotionTag::empty() const {
+    return seq == 0 && t0 == 0;
+}
+
+bool MotionTag::operator==(const MotionTag& other) const {
+    return seq == other.seq && t0 == other.t0;
+}
+
+MotionRequest::MotionRequest()
+    : kind(MotionKind::Gait), gait(nullptr), leftAngle(0), rightAngle(0), durationMs(0), msPerDegree(0),
+      cycles(0), tempo(100), untilStop(false) {
+}
+
+MotionRequest MotionRequest::target(MotionKind kind, int16_t leftAngle, int16_t rightAngle, uint32_t durationMs,
+                                    uint16_t msPerDegree) {
+    MotionRequest request;
+    request.kind = kind;
+    request.leftAngle = leftAngle;
+    request.rightAngle = rightAngle;
+    request.durationMs = durationMs;
+    request.msPerDegree = msPerDegree;
+    return request;
+}
+
+MotionRequest MotionRequest::forGait(const Gait& gait) {
+    MotionRequest request;
+    request.kind = MotionKind::Gait;
+    request.gait = &gait;
+    return request;
+}
+
+MotionRequest MotionRequest::forWalk(const Gait& cycle, uint16_t cycles, uint32_t durationMs, bool untilStop, uint8_t tempo) {
+    MotionRequest request;
+    request.kind = MotionKind::Walk;
+    request.gait = &cycle;
+    request.durationMs = durationMs;
+    request.cycles = cycles;
+    request.tempo = tempo;
+    request.untilStop = untilStop;
+    return request;
+}
+
+MotionQueue::MotionQueue() : head(0), count(0) {
+}
+
+bool MotionQueue::push(const MotionRequest& request) {
+    if (count == MOTION_QUEUE_SIZE) {
+        return false;
+    }
+    items[(head + count) % MOTION_QUEUE_SIZE] = request;
+    count++;
+    return true;
+}
+
+bool MotionQueue::supersede(const MotionRequest& request, MotionTag& replaced) {
+    // 只替换队尾：更早的同类目标后面可能还排着步态，替换它会改变动作的先后顺序
+    if (count == 0 || !isTarget(request.kind)) {
+        return false;
+    }
+    MotionRequest& tail = items[(head + count - 1) % MOTION_QUEUE_SIZE];
+    if (tail.kind != request.kind) {
+        return false;
+    }
+    replaced = tail.tag;
+    tail = request;
+    return true;
+}
+
+bool MotionQueue::pop(MotionRequest& request) {
+    if (count == 0) {
+        return false;
+    }
+    request = items[head];
+    head = (head + 1) % MOTION_QUEUE_SIZE;
+    count--;
+    return true;
+}
+
+uint8_t MotionQueue::size() const {
+    return count;
+}
+
+bool MotionQueue::isTarget(MotionKind kind) {
+    return kind != MotionKind::Gait && kind != MotionKind::Walk;
+}
@@ -0,0 +1,70 @@
+#ifndef MOTION_QUEUE_H
+#define MOTION_QUEUE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "gait_tables.h"
+
+// 动作类型：步态按顺序排队播放，目标角度类动作可以被同类的新目标替换
+enum class MotionKind : uint8_t {
+    Gait,      // 播放步态关键帧表
+    Legs,      // 两腿同时移动到目标角度
+    LeftLeg,   // 只移动左腿
+    RightLeg,  // 只移动右腿
+    Walk       // 连续步行：循环播放步态周期，结束时回到中心
+};
+
+// 动作对应的命令：seq用于完成回执，t0用于延迟测量，两者都为0时动作不留任何记录
+// 延迟基准的命令只带t0不带seq，所以两者一起作为动作的标记
+struct MotionTag {
+    uint32_t seq;
+    uint32_t t0;
+    
+    MotionTag();
+    MotionTag(uint32_t seq, uint32_t t0);
+    bool empty() const;
+    bool operator==(const MotionTag& other) const;
+};
+
+// 等待执行的一个动作，开始执行时才从当前角度出发计算轨迹
+// 只通过构造函数和下面的工厂函数创建，新增字段在默认构造函数中给出初值，不会遗漏
+struct MotionRequest {
+    MotionKind kind;
+    const Gait* gait;       // 仅kind为Gait时有效
+    int16_t leftAngle;
+    int16_t rightAngle;
+    uint32_t durationMs;
+    uint16_t msPerDegree;   // 非0时按开始执行时的移动角度计算时长（单腿摆动），忽略durationMs
+    uint16_t cycles;        // 以下仅kind为Walk时有效：周期数，durationMs为总时长，0均表示不限
+    uint8_t tempo;          // 步速百分比
+    bool untilStop;
+    MotionTag tag;          // 动作开始输出和结束时据此回传延迟和completed回执
+    
+    MotionRequest();
+    // 目标角度类动作（Legs/LeftLeg/RightLeg），未移动的一侧角度忽略
+    static MotionRequest target(MotionKind kind, int16_t leftAngle, int16_t rightAngle, uint32_t durationMs,
+                                uint16_t msPerDegree = 0);
+    static MotionRequest forGait(const Gait& gait);
+    static MotionRequest forWalk(const Gait& cycle, uint16_t cycles, uint32_t durationMs, bool untilStop, uint8_t tempo);
+};
+
+// 舵机控制器前的定长动作队列，不使用堆内存
+// 本身不加锁，由ServoController在持有motionLock时访问
+class MotionQueue {
+private:
+    MotionRequest items[MOTION_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+
+public:
+    MotionQueue();
+    bool push(const MotionRequest& request);       // 队列已满时返回false
+    // 队尾是同类目标时原地替换并返回true，replaced为被替换动作的标记
+    bool supersede(const MotionRequest& request, MotionTag& replaced);
+    bool pop(MotionRequest& request);
+    uint8_t size() const;
+    
+    static bool isTarget(MotionKind kind);  // 目标角度类动作，新目标会替换旧目标
+};
+
+#endif
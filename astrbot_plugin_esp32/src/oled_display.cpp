@@ -1,9 +1,56 @@
 #include "oled_display.h"
+#include "emotion_bitmaps.h"
+#include "emotion_primitives.h"
+#include "json_writer.h"
+#include "binary_log.h"
+#include <limits.h>
+
+static_assert(SCREEN_WIDTH * SCREEN_HEIGHT / 8 == EMOTION_BITMAP_SIZE, "emotion bitmaps must match the screen size");
+static_assert(EMOTION_BITMAP_COUNT == static_cast<uint8_t>(Emotion::Unknown), "emotion bitmaps out of sync with Emotion");
+
+static const unsigned long MIN_FRAME_INTERVAL = 1000 / OLED_ANIMATION_MAX_FPS;
+
+// 眼睛所在区域，用于眨眼动画：x, y, 宽, 高（左眼、右眼）
+struct EyeBox {
+    uint8_t x, y, w, h;
+};
+
+static const EyeBox EYE_BOXES[][2] = {
+    {{35, 35, 16, 16}, {77, 35, 16, 16}},  // happy
+    {{35, 35, 16, 16}, {77, 35, 16, 16}},  // sad
+    {{35, 38, 16, 12}, {77, 38, 16, 12}},  // angry
+    {{30, 30, 20, 20}, {78, 30, 20, 20}},  // surprised
+};
+
+// 每种表情对应的动画
+static const EmotionAnimation* animationFor(Emotion emotion) {
+    switch (emotion) {
+        case Emotion::Happy:
+        case Emotion::Sad:
+        case Emotion::Angry:
+        case Emotion::Surprised:
+            return &ANIMATION_BLINK;
+        case Emotion::Sleepy:
+        case Emotion::Love:
+        case Emotion::Cool:
+            return &ANIMATION_BREATHE;
+        case Emotion::Thinking:
+            return &ANIMATION_TYPING;
+        default:
+            return &ANIMATION_NONE;
+    }
+}
 
 OledDisplay::OledDisplay(int width, int height, int sda, int scl, int address)
-    : screenWidth(width), screenHeight(height), sdaPin(sda), sclPin(scl), 
+    : display(width, height, &Wire, -1, OLED_I2C_CLOCK, OLED_I2C_CLOCK),
+      screenWidth(width), screenHeight(height), sdaPin(sda), sclPin(scl), 
       screenAddress(address), initialized(false),
-      display(width, height, &Wire, -1) {
+      panelBuffer(nullptr), bufferSize(width * ((height + 7) / 8)),
+      lastFlushBytes(0), totalFlushBytes(0), flushCount(0),
+      currentEmotion(Emotion::Unknown), animation(&ANIMATION_NONE), animationFrame(0),
+      frameStartedAt(0), nextRenderAt(0), renderedFrames(0), unchangedFrames(0),
+      lineCount(0), textActive(false), scrollY(0), scrollSpeed(OLED_SCROLL_SPEED),
+      lastScrollAt(0), scrollResumeAt(0) {
 }
 
 bool OledDisplay::init() {
@@ -17,6 +64,13 @@ bool OledDisplay::init() {
         return false;
     }
     
+    panelBuffer = (uint8_t*)malloc(bufferSize);
+    if (!panelBuffer) {
+        Serial.println("OLED刷新缓冲区分配失败!");
+        initialized = false;
+        return false;
+    }
+    
     Serial.println("OLED初始化成功!");
     initialized = true;
     
@@ -28,39 +82,54 @@ bool OledDisplay::init() {
     display.println("AstrBot ESP32S3");
     display.setCursor(0, 30);
     display.println("OLED Ready!");
-    display.display();
+    fullRefresh();
     
     delay(2000);
+    
+#if OLED_VERIFY_BITMAPS
+    verifyEmotionBitmaps();
+#endif
     clear();
     
     return true;
 }
 
-void OledDisplay::displayEmotion(String emotion) {
-    if (!initialized) return;
-    
-    clear();
-    
+Emotion OledDisplay::parseEmotion(String emotion) {
     emotion.toLowerCase();
     
     if (emotion == "happy" || emotion == "开心" || emotion == "高兴" || emotion == "快乐") {
-        drawHappyFace();
+        return Emotion::Happy;
     } else if (emotion == "sad" || emotion == "伤心" || emotion == "难过") {
-        drawSadFace();
+        return Emotion::Sad;
     } else if (emotion == "angry" || emotion == "生气" || emotion == "愤怒") {
-        drawAngryFace();
+        return Emotion::Angry;
     } else if (emotion == "surprised" || emotion == "惊讶" || emotion == "吃惊") {
-        drawSurprisedFace();
+        return Emotion::Surprised;
     } else if (emotion == "sleepy" || emotion == "困" || emotion == "睡觉") {
-        drawSleepyFace();
+        return Emotion::Sleepy;
     } else if (emotion == "love" || emotion == "爱心" || emotion == "喜欢") {
-        drawHeartEyes();
+        return Emotion::Love;
     } else if (emotion == "cool" || emotion == "酷" || emotion == "帅") {
-        drawCoolFace();
+        return Emotion::Cool;
     } else if (emotion == "thinking" || emotion == "思考" || emotion == "想") {
-        drawThinkingFace();
+        return Emotion::Thinking;
+    }
+    return Emotion::Unknown;
+}
+
+void OledDisplay::displayEmotion(String emotion) {
+    if (!initialized) return;
+    
+    textActive = false;
+    Emotion face = parseEmotion(emotion);
+    if (face != Emotion::Unknown) {
+        // 立即显示第一帧，后续帧由tick()推进
+        startAnimation(face, millis());
+        renderAnimationFrame();
     } else {
+        stopAnimation();
         // 默认显示疑问表情
+        display.clearDisplay();
         display.setTextSize(2);
         display.setTextColor(SSD1306_WHITE);
         display.setCursor(45, 20);
@@ -70,264 +139,482 @@ void OledDisplay::displayEmotion(String emotion) {
         display.println("Unknown emotion");
     }
     
-    display.display();
+    flush();
 }
 
-void OledDisplay::displayText(String text) {
+void OledDisplay::blitEmotion(Emotion emotion) {
+    // 位图与帧缓冲区布局相同，直接整屏拷贝，不需要先清屏
+    memcpy_P(display.getBuffer(), EMOTION_BITMAPS[static_cast<uint8_t>(emotion)], EMOTION_BITMAP_SIZE);
+    drawEmotionOverlay(emotion);
+}
+
+void OledDisplay::drawEmotionOverlay(Emotion emotion) {
+    display.setTextColor(SSD1306_WHITE);
+    if (emotion == Emotion::Sleepy) {
+        // ZZZ睡觉符号
+        display.setTextSize(2);
+        display.setCursor(95, 10);
+        display.println("Z");
+        display.setTextSize(1);
+        display.setCursor(105, 20);
+        display.println("Z");
+        display.setCursor(110, 25);
+        display.println("z");
+    } else if (emotion == Emotion::Thinking) {
+        // 问号
+        display.setTextSize(1);
+        display.setCursor(96, 11);
+        display.println("?");
+    }
+}
+
+void OledDisplay::displayText(const char* text) {
     if (!initialized) return;
     
-    clear();
+    stopAnimation();
     
-    // 使用Adafruit库显示文本
-    display.setTextSize(1);
-    display.setTextColor(SSD1306_WHITE);
-    display.setCursor(0, 0);
+    // 保存一份文本供滚动时重绘，超长时在字符边界截断
+    strncpy(viewText, text, sizeof(viewText) - 1);
+    viewText[sizeof(viewText) - 1] = '\0';
+    utf8TrimPartial(viewText);
     
-    // 简单的文本换行处理
-    int lineHeight = 10;
-    int currentY = 0;
-    int maxWidth = 21;  // 每行大约21个字符 (128像素 / 6像素每字符)
+    unsigned long start = micros();
+    layoutText();
+    textActive = true;
+    scrollY = 0;
+    lastScrollAt = millis();
+    scrollResumeAt = lastScrollAt + OLED_SCROLL_PAUSE_MS;
+    renderViewport();
+    unsigned long renderTime = micros() - start;
     
-    String currentLine = "";
-    for (int i = 0; i < text.length(); i++) {
-        currentLine += text[i];
-        
-        // 检查当前行长度或遇到换行符
-        if (currentLine.length() >= maxWidth || text[i] == '\n' || i == text.length() - 1) {
-            if (text[i] == '\n') {
-                currentLine.remove(currentLine.length() - 1);  // 移除换行符
+    flush();
+    
+    LOG(OLED_TEXT_RENDERED, lineCount, renderTime, glyphCache.getHits(), glyphCache.getMisses());
+    if (renderTime > OLED_TEXT_BUDGET_US) {
+        LOG(OLED_TEXT_OVER_BUDGET, renderTime);
+    }
+}
+
+void OledDisplay::layoutText() {
+    // 按UTF-8逐字解码，按像素宽度换行，不会把中文字符拆开；只记录行首偏移，不复制文本
+    lineCount = 0;
+    lineOffsets[lineCount++] = 0;
+    int x = 0;
+    const char* p = viewText;
+    while (*p) {
+        const char* charStart = p;
+        uint32_t codepoint = utf8Next(p);
+        if (codepoint == '\n') {
+            if (lineCount == MAX_TEXT_LINES) {
+                p = charStart;
+                break;
             }
-            
-            display.setCursor(0, currentY);
-            display.println(currentLine);
-            currentY += lineHeight;
-            currentLine = "";
-            
-            // 防止超出屏幕
-            if (currentY > 54) break;  // 64 - 10 = 54
-            
-            // 如果是因为长度换行，保留当前字符
-            if (text[i] != '\n' && i != text.length() - 1) {
-                currentLine = text[i];
+            lineOffsets[lineCount++] = p - viewText;
+            x = 0;
+            continue;
+        }
+        if (codepoint < 0x20) continue;  // 忽略其他控制字符
+        
+        int advance = glyphAdvance(codepoint);
+        if (x + advance > screenWidth) {
+            if (lineCount == MAX_TEXT_LINES) {
+                p = charStart;  // 超出行数上限的部分不显示
+                break;
             }
+            lineOffsets[lineCount++] = charStart - viewText;
+            x = 0;
+        }
+        x += advance;
+    }
+    lineOffsets[lineCount] = p - viewText;
+}
+
+void OledDisplay::drawTextRows(int top, int bottom) {
+    int first = (scrollY + top) / LINE_HEIGHT;
+    for (int line = first; line < lineCount; line++) {
+        int y = line * LINE_HEIGHT - scrollY;
+        if (y >= bottom) break;
+        
+        int x = 0;
+        const char* p = viewText + lineOffsets[line];
+        const char* end = viewText + lineOffsets[line + 1];
+        while (p < end) {
+            uint32_t codepoint = utf8Next(p);
+            if (codepoint < 0x20) continue;
+            drawGlyph(x, y, codepoint);
+            x += glyphAdvance(codepoint);
         }
     }
+}
+
+void OledDisplay::renderViewport() {
+    display.clearDisplay();
+    drawTextRows(0, screenHeight);
+}
+
+int OledDisplay::maxScroll() const {
+    int contentHeight = lineCount * LINE_HEIGHT - 1;  // 最后一行下面没有行距
+    return contentHeight > screenHeight ? contentHeight - screenHeight : 0;
+}
+
+void OledDisplay::scrollTo(int target) {
+    if (target < 0) target = 0;
+    if (target > maxScroll()) target = maxScroll();
+    int delta = target - scrollY;
+    if (delta == 0) return;
+    scrollY = target;
+    
+    if (delta >= screenHeight || -delta >= screenHeight) {
+        renderViewport();
+    } else if (delta > 0) {
+        // 向下滚动：画面上移，只绘制底部新露出的行
+        shiftRows(-delta);
+        display.fillRect(0, screenHeight - delta, screenWidth, delta, SSD1306_BLACK);
+        drawTextRows(screenHeight - delta, screenHeight);
+    } else {
+        shiftRows(-delta);
+        display.fillRect(0, 0, screenWidth, -delta, SSD1306_BLACK);
+        drawTextRows(0, -delta);
+    }
+    flush();
+}
+
+int OledDisplay::pageText(int pages) {
+    if (!textActive) return 0;
+    
+    // 每页为屏幕能完整容纳的行数，翻页后暂停自动滚动
+    int pageHeight = (screenHeight / LINE_HEIGHT) * LINE_HEIGHT;
+    scrollTo(scrollY + pages * pageHeight);
+    lastScrollAt = millis();
+    scrollResumeAt = lastScrollAt + OLED_SCROLL_PAUSE_MS;
+    return (scrollY + pageHeight - 1) / pageHeight + 1;
+}
+
+int OledDisplay::getTextPageCount() const {
+    if (!textActive) return 0;
+    int pageHeight = (screenHeight / LINE_HEIGHT) * LINE_HEIGHT;
+    return (maxScroll() + pageHeight - 1) / pageHeight + 1;
+}
+
+void OledDisplay::setScrollSpeed(uint16_t pixelsPerSecond) {
+    scrollSpeed = pixelsPerSecond;
+    lastScrollAt = millis();
+}
+
+int OledDisplay::glyphAdvance(uint32_t codepoint) const {
+    return codepoint < 0x80 ? 6 : CJK_GLYPH_WIDTH;
+}
+
+void OledDisplay::drawGlyph(int x, int y, uint32_t codepoint) {
+    if (codepoint < 0x80) {
+        // 内置字体高8像素，与中文字形底部对齐
+        display.drawChar(x, y + CJK_GLYPH_HEIGHT - 9, (unsigned char)codepoint, SSD1306_WHITE, SSD1306_WHITE, 1);
+        return;
+    }
+    
+    const uint16_t* rows = glyphCache.lookup(codepoint);
+    if (!rows) {
+        // 字库中没有的字符显示为方框
+        display.drawRect(x + 1, y + 1, CJK_GLYPH_WIDTH - 2, CJK_GLYPH_HEIGHT - 2, SSD1306_WHITE);
+        return;
+    }
     
-    display.display();
+    // 按行把连续的像素合并成水平线段绘制
+    for (int row = 0; row < CJK_GLYPH_HEIGHT; row++) {
+        uint16_t bits = rows[row];
+        int col = 0;
+        while (bits) {
+            while (!(bits & 0x8000)) {
+                bits <<= 1;
+                col++;
+            }
+            int run = 0;
+            while (bits & 0x8000) {
+                bits <<= 1;
+                run++;
+            }
+            display.drawFastHLine(x + col, y + row, run, SSD1306_WHITE);
+            col += run;
+        }
+    }
 }
 
 void OledDisplay::clear() {
     if (!initialized) return;
     
+    stopAnimation();
+    textActive = false;
     display.clearDisplay();
-    display.display();
+    flush();
 }
 
-bool OledDisplay::isInitialized() const {
-    return initialized;
+void OledDisplay::startAnimation(Emotion emotion, unsigned long now) {
+    currentEmotion = emotion;
+    animation = animationFor(emotion);
+    animationFrame = 0;
+    frameStartedAt = now;
+    nextRenderAt = now + MIN_FRAME_INTERVAL;
 }
 
-// 画开心表情 ^_^
-void OledDisplay::drawHappyFace() {
-    // 眉毛（弯曲的开心眉毛）
-    for(int i = 0; i < 2; i++) {
-        display.drawCircle(45, 25, 8 + i, SSD1306_WHITE);
-        display.drawCircle(83, 25, 8 + i, SSD1306_WHITE);
+void OledDisplay::stopAnimation() {
+    currentEmotion = Emotion::Unknown;
+    animation = &ANIMATION_NONE;
+}
+
+void OledDisplay::tick(unsigned long now) {
+    if (!initialized) return;
+    
+    if (textActive) {
+        tickScroll(now);
+    } else {
+        tickAnimation(now);
     }
-    // 遮盖下半部分形成弯眉，同时消除中间连接
-    display.fillRect(37, 25, 16, 10, SSD1306_BLACK);
-    display.fillRect(75, 25, 16, 10, SSD1306_BLACK);
-    // 消除两眼中间的弧
-    display.fillRect(37, 25, 42, 10, SSD1306_BLACK);
-    
-    // 眼睛（大的圆角正方形）
-    display.fillRoundRect(35, 35, 16, 16, 4, SSD1306_WHITE);
-    display.fillRoundRect(77, 35, 16, 16, 4, SSD1306_WHITE);
-    
-    // 嘴巴（开心的微笑弧形）
-    for(int i = 0; i < 3; i++) {
-        display.drawCircle(64, 45, 15 + i, SSD1306_WHITE);
+}
+
+void OledDisplay::tickScroll(unsigned long now) {
+    if (scrollSpeed == 0 || maxScroll() == 0) return;
+    if ((long)(now - nextRenderAt) < 0 || (long)(now - scrollResumeAt) < 0) return;
+    
+    // 到底后停留一段时间再回到顶部
+    if (scrollY >= maxScroll()) {
+        scrollTo(0);
+        lastScrollAt = now;
+        scrollResumeAt = now + OLED_SCROLL_PAUSE_MS;
+        nextRenderAt = now + MIN_FRAME_INTERVAL;
+        return;
     }
-    // 遮盖上半部分形成微笑弧
-    display.fillRect(49, 45, 30, 15, SSD1306_BLACK);
-}
-
-// 画伤心表情 T_T
-void OledDisplay::drawSadFace() {
-    // 眉毛（下垂的伤心眉毛）
-    display.drawLine(35, 18, 50, 25, SSD1306_WHITE);
-    display.drawLine(36, 19, 51, 26, SSD1306_WHITE);
-    display.drawLine(78, 25, 93, 18, SSD1306_WHITE);
-    display.drawLine(77, 26, 92, 19, SSD1306_WHITE);
-    
-    // 眼睛（大的圆角正方形）
-    display.fillRoundRect(35, 35, 16, 16, 4, SSD1306_WHITE);
-    display.fillRoundRect(77, 35, 16, 16, 4, SSD1306_WHITE);
-    
-    // 眼泪
-    display.drawLine(43, 51, 43, 58, SSD1306_WHITE);
-    display.drawLine(85, 51, 85, 58, SSD1306_WHITE);
-    display.fillCircle(43, 59, 2, SSD1306_WHITE);
-    display.fillCircle(85, 59, 2, SSD1306_WHITE);
-    
-    // 嘴巴（倒弧，伤心）
-    for(int i = 0; i < 3; i++) {
-        display.drawCircle(64, 75, 15 + i, SSD1306_WHITE);
+    
+    // 按经过的时间计算应滚动的像素数，帧率受限时一次滚动多行像素
+    unsigned long pixels = (now - lastScrollAt) * scrollSpeed / 1000;
+    if (pixels == 0) return;
+    lastScrollAt += pixels * 1000 / scrollSpeed;
+    scrollTo(scrollY + (int)pixels);
+    if (scrollY >= maxScroll()) {
+        scrollResumeAt = now + OLED_SCROLL_PAUSE_MS;
     }
-    // 遮盖下半部分形成倒弧
-    display.fillRect(49, 60, 30, 15, SSD1306_BLACK);
+    nextRenderAt = now + MIN_FRAME_INTERVAL;
 }
 
-// 画生气表情 >:(
-void OledDisplay::drawAngryFace() {
-    // 眉毛（愤怒的倾斜眉毛）
-    display.fillTriangle(30, 20, 50, 30, 30, 25, SSD1306_WHITE);
-    display.fillTriangle(98, 20, 78, 30, 98, 25, SSD1306_WHITE);
-    
-    // 眼睛（大的圆角正方形，稍微倾斜）
-    display.fillRoundRect(35, 38, 16, 12, 3, SSD1306_WHITE);
-    display.fillRoundRect(77, 38, 16, 12, 3, SSD1306_WHITE);
-    
-    // 鼻孔（愤怒时的鼻孔）
-    display.fillCircle(62, 50, 1, SSD1306_WHITE);
-    display.fillCircle(66, 50, 1, SSD1306_WHITE);
-    
-    // 嘴巴（愤怒的波浪线）
-    display.drawLine(45, 58, 55, 55, SSD1306_WHITE);
-    display.drawLine(55, 55, 65, 58, SSD1306_WHITE);
-    display.drawLine(65, 58, 75, 55, SSD1306_WHITE);
-    display.drawLine(75, 55, 85, 58, SSD1306_WHITE);
+void OledDisplay::tickAnimation(unsigned long now) {
+    if (animation->frameCount == 0) return;
+    if ((long)(now - nextRenderAt) < 0) return;
+    
+    // 当前帧的保持时间还没到，无需重绘
+    const AnimationFrame& frame = animation->frames[animationFrame];
+    if (now - frameStartedAt < frame.durationMs) return;
+    
+    // 处理能力不足时直接跳到当前应显示的帧，不补绘中间帧
+    do {
+        frameStartedAt += animation->frames[animationFrame].durationMs;
+        animationFrame = (animationFrame + 1) % animation->frameCount;
+    } while (now - frameStartedAt >= animation->frames[animationFrame].durationMs);
+    
+    renderAnimationFrame();
+    nextRenderAt = now + MIN_FRAME_INTERVAL;
 }
 
-// 画惊讶表情 O_O
-void OledDisplay::drawSurprisedFace() {
-    // 眉毛（高高扬起的惊讶眉毛）
-    for(int i = 0; i < 2; i++) {
-        display.drawCircle(45, 15, 12 + i, SSD1306_WHITE);
-        display.drawCircle(83, 15, 12 + i, SSD1306_WHITE);
+unsigned long OledDisplay::timeUntilNextFrame(unsigned long now) const {
+    if (!initialized) return ULONG_MAX;
+    
+    unsigned long due;
+    if (textActive) {
+        if (scrollSpeed == 0 || maxScroll() == 0) return ULONG_MAX;
+        due = scrollY >= maxScroll() ? scrollResumeAt : lastScrollAt + 1000 / scrollSpeed;
+        if ((long)(scrollResumeAt - due) > 0) due = scrollResumeAt;
+    } else {
+        if (animation->frameCount == 0) return ULONG_MAX;
+        due = frameStartedAt + animation->frames[animationFrame].durationMs;
     }
-    // 遮盖下半部分形成高眉
-    display.fillRect(33, 15, 24, 12, SSD1306_BLACK);
-    display.fillRect(71, 15, 24, 12, SSD1306_BLACK);
-    
-    // 眼睛（非常大的圆角正方形）
-    display.fillRoundRect(30, 30, 20, 20, 5, SSD1306_WHITE);
-    display.fillRoundRect(78, 30, 20, 20, 5, SSD1306_WHITE);
-    // 瞳孔
-    display.fillCircle(40, 40, 3, SSD1306_BLACK);
-    display.fillCircle(88, 40, 3, SSD1306_BLACK);
-    
-    // 嘴巴（大的惊讶圆圈）
-    display.drawCircle(64, 58, 8, SSD1306_WHITE);
-    display.drawCircle(64, 58, 7, SSD1306_WHITE);
-}
-
-// 画困倦表情 -_-
-void OledDisplay::drawSleepyFace() {
-    // 眉毛（下垂的困倦眉毛）
-    display.drawLine(35, 22, 50, 18, SSD1306_WHITE);
-    display.drawLine(36, 23, 51, 19, SSD1306_WHITE);
-    display.drawLine(78, 18, 93, 22, SSD1306_WHITE);
-    display.drawLine(77, 19, 92, 23, SSD1306_WHITE);
-    
-    // 眼睛（扁平的圆角矩形，表示闭眼）
-    display.fillRoundRect(35, 40, 16, 4, 2, SSD1306_WHITE);
-    display.fillRoundRect(77, 40, 16, 4, 2, SSD1306_WHITE);
-    
-    // 嘴巴（小的困倦弧）
-    for(int i = 0; i < 2; i++) {
-        display.drawCircle(64, 52, 6 + i, SSD1306_WHITE);
+    if ((long)(nextRenderAt - due) > 0) due = nextRenderAt;
+    return (long)(due - now) > 0 ? due - now : 0;
+}
+
+void OledDisplay::renderAnimationFrame() {
+    // 先在帧缓冲区中完整绘制一帧，再与屏幕内容比较后刷新
+    blitEmotion(currentEmotion);
+    if (animation->frameCount > 0) {
+        uint8_t level = animation->frames[animationFrame].level;
+        switch (animation->effect) {
+            case AnimationEffect::Blink:
+                applyBlink(currentEmotion, level);
+                break;
+            case AnimationEffect::Breathe:
+                shiftRows(level);
+                break;
+            case AnimationEffect::Typing:
+                drawTypingDots(level);
+                break;
+            default:
+                break;
+        }
     }
-    display.fillRect(58, 52, 12, 6, SSD1306_BLACK);
     
-    // ZZZ睡觉符号
-    display.setTextSize(2);
-    display.setCursor(95, 10);
-    display.println("Z");
-    display.setTextSize(1);
-    display.setCursor(105, 20);
-    display.println("Z");
-    display.setCursor(110, 25);
-    display.println("z");
-}
-
-// 画爱心眼表情
-void OledDisplay::drawHeartEyes() {
-    // 眉毛（开心的弯眉）
-    for(int i = 0; i < 2; i++) {
-        display.drawCircle(45, 22, 10 + i, SSD1306_WHITE);
-        display.drawCircle(83, 22, 10 + i, SSD1306_WHITE);
+    renderedFrames++;
+    flush();
+    if (lastFlushBytes == 0) {
+        unchangedFrames++;
     }
-    display.fillRect(35, 22, 20, 10, SSD1306_BLACK);
-    display.fillRect(73, 22, 20, 10, SSD1306_BLACK);
-    
-    // 爱心眼睛（在圆角正方形框架内）
-    display.drawRoundRect(32, 32, 20, 20, 5, SSD1306_WHITE);
-    display.drawRoundRect(76, 32, 20, 20, 5, SSD1306_WHITE);
-    
-    // 左爱心
-    display.fillCircle(38, 38, 3, SSD1306_WHITE);
-    display.fillCircle(46, 38, 3, SSD1306_WHITE);
-    display.fillTriangle(35, 41, 49, 41, 42, 48, SSD1306_WHITE);
-    
-    // 右爱心
-    display.fillCircle(82, 38, 3, SSD1306_WHITE);
-    display.fillCircle(90, 38, 3, SSD1306_WHITE);
-    display.fillTriangle(79, 41, 93, 41, 86, 48, SSD1306_WHITE);
-    
-    // 微笑
-    for(int i = 0; i < 3; i++) {
-        display.drawCircle(64, 45, 15 + i, SSD1306_WHITE);
+}
+
+void OledDisplay::applyBlink(Emotion emotion, uint8_t level) {
+    if (level == 0 || static_cast<uint8_t>(emotion) >= sizeof(EYE_BOXES) / sizeof(EYE_BOXES[0])) return;
+    
+    for (const EyeBox& eye : EYE_BOXES[static_cast<uint8_t>(emotion)]) {
+        if (level == 1) {
+            // 半闭：遮住上半部分
+            display.fillRect(eye.x, eye.y, eye.w, eye.h / 2, SSD1306_BLACK);
+        } else {
+            // 闭眼：只留一条横线
+            display.fillRect(eye.x, eye.y, eye.w, eye.h, SSD1306_BLACK);
+            display.fillRect(eye.x, eye.y + eye.h / 2 - 1, eye.w, 2, SSD1306_WHITE);
+        }
     }
-    display.fillRect(49, 45, 30, 15, SSD1306_BLACK);
 }
 
-// 画酷表情（戴墨镜）
-void OledDisplay::drawCoolFace() {
-    // 眉毛（平直的酷眉）
-    display.fillRect(35, 18, 18, 3, SSD1306_WHITE);
-    display.fillRect(75, 18, 18, 3, SSD1306_WHITE);
-    
-    // 墨镜（连体的大墨镜）
-    display.fillRoundRect(25, 30, 78, 20, 8, SSD1306_WHITE);
-    display.fillRoundRect(30, 34, 25, 12, 6, SSD1306_BLACK);
-    display.fillRoundRect(73, 34, 25, 12, 6, SSD1306_BLACK);
-    display.fillRect(55, 38, 18, 4, SSD1306_WHITE); // 鼻梁
+void OledDisplay::shiftRows(int pixels) {
+    if (pixels == 0) return;
+    
+    // 帧缓冲区每列由各页的同一列字节组成，低位在上；逐列把各页字节拼成一个64位整数整体移位
+    uint8_t* buffer = display.getBuffer();
+    int pages = (screenHeight + 7) / 8;
+    for (int x = 0; x < screenWidth; x++) {
+        uint64_t column = 0;
+        for (int page = 0; page < pages; page++) {
+            column |= (uint64_t)buffer[page * screenWidth + x] << (page * 8);
+        }
+        column = pixels > 0 ? column << pixels : column >> -pixels;
+        for (int page = 0; page < pages; page++) {
+            buffer[page * screenWidth + x] = (uint8_t)(column >> (page * 8));
+        }
+    }
+}
+
+void OledDisplay::drawTypingDots(uint8_t count) {
+    if (count == 0) return;
     
-    // 嘴巴（酷酷的直线，稍微上扬）
-    display.drawLine(50, 58, 78, 56, SSD1306_WHITE);
-    display.drawLine(50, 59, 78, 57, SSD1306_WHITE);
+    // 用思考气泡里的点代替问号
+    display.fillRect(96, 11, 5, 7, SSD1306_BLACK);
+    for (uint8_t i = 0; i < count; i++) {
+        display.fillCircle(95 + i * 5, 16, 1, SSD1306_WHITE);
+    }
+}
+
+bool OledDisplay::isInitialized() const {
+    return initialized;
 }
 
-// 画思考表情
-void OledDisplay::drawThinkingFace() {
-    // 眉毛（一高一低，表示疑惑）
-    for(int i = 0; i < 2; i++) {
-        display.drawCircle(45, 20, 8 + i, SSD1306_WHITE);
+uint32_t OledDisplay::getLastFlushBytes() const {
+    return lastFlushBytes;
+}
+
+uint32_t OledDisplay::getTotalFlushBytes() const {
+    return totalFlushBytes;
+}
+
+uint32_t OledDisplay::getFlushCount() const {
+    return flushCount;
+}
+
+uint32_t OledDisplay::getRenderedFrames() const {
+    return renderedFrames;
+}
+
+uint32_t OledDisplay::getUnchangedFrames() const {
+    return unchangedFrames;
+}
+
+void OledDisplay::flush() {
+    const uint8_t* buffer = display.getBuffer();
+    int pages = (screenHeight + 7) / 8;
+    uint32_t sent = 0;
+    
+    // 帧缓冲区按页（8行）排列，每页screenWidth字节；逐页找出变化的列范围
+    for (int page = 0; page < pages; page++) {
+        const uint8_t* row = buffer + page * screenWidth;
+        uint8_t* shown = panelBuffer + page * screenWidth;
+        
+        int first = 0;
+        while (first < screenWidth && row[first] == shown[first]) first++;
+        if (first == screenWidth) continue;  // 该页没有变化
+        int last = screenWidth - 1;
+        while (row[last] == shown[last]) last--;
+        
+        // 水平寻址模式下，设定列和页窗口后数据按顺序写入
+        const uint8_t window[] = {
+            SSD1306_COLUMNADDR, (uint8_t)first, (uint8_t)last,
+            SSD1306_PAGEADDR, (uint8_t)page, (uint8_t)page
+        };
+        sent += sendCommands(window, sizeof(window));
+        sent += sendData(row + first, last - first + 1);
+        memcpy(shown + first, row + first, last - first + 1);
     }
-    display.fillRect(37, 20, 16, 8, SSD1306_BLACK);
-    display.drawLine(78, 18, 93, 25, SSD1306_WHITE);
-    display.drawLine(77, 19, 92, 26, SSD1306_WHITE);
-    
-    // 眼睛（一个正常，一个眯眼）
-    display.fillRoundRect(35, 35, 16, 16, 4, SSD1306_WHITE);
-    display.fillRoundRect(77, 40, 16, 6, 3, SSD1306_WHITE);
     
-    // 瞳孔（向上看）
-    display.fillCircle(43, 38, 2, SSD1306_BLACK);
-    
-    // 嘴巴（歪嘴，表示思考）
-    display.drawLine(55, 58, 70, 56, SSD1306_WHITE);
-    display.drawLine(55, 59, 70, 57, SSD1306_WHITE);
-    
-    // 思考气泡
-    display.drawCircle(100, 15, 10, SSD1306_WHITE);
-    display.fillCircle(90, 25, 3, SSD1306_WHITE);
-    display.fillCircle(85, 30, 2, SSD1306_WHITE);
-    display.fillCircle(82, 33, 1, SSD1306_WHITE);
-    
-    // 问号
-    display.setTextSize(1);
-    display.setCursor(96, 11);
-    display.println("?");
+    lastFlushBytes = sent;
+    totalFlushBytes += sent;
+    flushCount++;
+    if (sent > 0) {
+        LOG(OLED_FLUSH, sent);
+    }
+}
+
+void OledDisplay::fullRefresh() {
+    const uint8_t window[] = {
+        SSD1306_COLUMNADDR, 0, (uint8_t)(screenWidth - 1),
+        SSD1306_PAGEADDR, 0, (uint8_t)((screenHeight + 7) / 8 - 1)
+    };
+    uint32_t sent = sendCommands(window, sizeof(window));
+    sent += sendData(display.getBuffer(), bufferSize);
+    memcpy(panelBuffer, display.getBuffer(), bufferSize);
+    
+    lastFlushBytes = sent;
+    totalFlushBytes += sent;
+    flushCount++;
+}
+
+// 返回值为总线上传输的字节数（含地址字节和控制字节）
+uint32_t OledDisplay::sendCommands(const uint8_t* commands, size_t count) {
+    Wire.beginTransmission(screenAddress);
+    Wire.write((uint8_t)0x00);  // 控制字节：后续均为命令
+    Wire.write(commands, count);
+    Wire.endTransmission();
+    return count + 2;
 }
+
+uint32_t OledDisplay::sendData(const uint8_t* data, size_t count) {
+    uint32_t sent = 0;
+    while (count > 0) {
+        size_t chunk = count > I2C_CHUNK_SIZE ? I2C_CHUNK_SIZE : count;
+        Wire.beginTransmission(screenAddress);
+        Wire.write((uint8_t)0x40);  // 控制字节：后续均为显示数据
+        Wire.write(data, chunk);
+        Wire.endTransmission();
+        sent += chunk + 2;
+        data += chunk;
+        count -= chunk;
+    }
+    return sent;
+}
+
+#if OLED_VERIFY_BITMAPS
+
+// 逐个比对预生成位图与原始绘制结果（不含文字叠加），并测量两种方式的耗时
+void OledDisplay::verifyEmotionBitmaps() {
+    for (uint8_t i = 0; i < EMOTION_BITMAP_COUNT; i++) {
+        Emotion emotion = static_cast<Emotion>(i);
+        
+        unsigned long start = micros();
+        display.clearDisplay();
+        drawEmotionPrimitives(display, emotion);
+        unsigned long drawTime = micros() - start;
+        bool match = memcmp_P(display.getBuffer(), EMOTION_BITMAPS[i], EMOTION_BITMAP_SIZE) == 0;
+        
+        start = micros();
+        memcpy_P(display.getBuffer(), EMOTION_BITMAPS[i], EMOTION_BITMAP_SIZE);
+        unsigned long blitTime = micros() - start;
+        
+        Serial.printf("表情位图%u: %s, 原始绘制%luus, 位图拷贝%luus\n", i, match ? "一致" : "不一致", drawTime, blitTime);
+    }
+    display.clearDisplay();
+}
+
+#endif
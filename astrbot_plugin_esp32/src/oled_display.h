@@ -5,6 +5,22 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "config.h"
+#include "emotion_animations.h"
+#include "glyph_cache.h"
+
+// 顺序与emotion_bitmaps.h中的位图一致
+enum class Emotion : uint8_t {
+    Happy,
+    Sad,
+    Angry,
+    Surprised,
+    Sleepy,
+    Love,
+    Cool,
+    Thinking,
+    Unknown
+};
 
 class OledDisplay {
 private:
@@ -15,24 +31,88 @@ private:
     int sclPin;
     int screenAddress;
     bool initialized;
+    
+    // 脏区刷新：panelBuffer记录屏幕上实际显示的内容，刷新时只发送与之不同的页和列
+    uint8_t* panelBuffer;
+    size_t bufferSize;
+    uint32_t lastFlushBytes;   // 最近一次刷新经I2C发送的字节数
+    uint32_t totalFlushBytes;
+    uint32_t flushCount;
+    
+    // 表情动画：在loop()中由tick()推进，每帧先在帧缓冲区完整绘制再刷新，不会出现撕裂
+    Emotion currentEmotion;
+    const EmotionAnimation* animation;
+    uint8_t animationFrame;
+    unsigned long frameStartedAt;   // 当前动画帧开始的时间
+    unsigned long nextRenderAt;     // 下一次允许绘制的时间，受最高帧率限制
+    uint32_t renderedFrames;
+    uint32_t unchangedFrames;       // 绘制后与屏幕内容相同、没有发送的帧
+    
+    // 文本显示：ASCII使用内置6x8字体，其他字符使用flash中的中文子集字库
+    GlyphCache glyphCache;
+    static const int LINE_HEIGHT = CJK_GLYPH_HEIGHT + 1;
+    static const size_t TEXT_CAPACITY = 256;
+    static const uint8_t MAX_TEXT_LINES = 64;
+    
+    // 文本视口：整段文本只排版一次，记录每行在viewText中的起始偏移；滚动时平移帧缓冲区，只绘制新露出的行
+    char viewText[TEXT_CAPACITY];
+    uint16_t lineOffsets[MAX_TEXT_LINES + 1];  // 最后一项为文本结尾
+    uint8_t lineCount;
+    bool textActive;
+    int scrollY;                    // 视口顶部对应的文本像素行
+    uint16_t scrollSpeed;           // 自动滚动速度（像素/秒）
+    unsigned long lastScrollAt;
+    unsigned long scrollResumeAt;   // 在顶部/底部停留结束的时间
+    
+    int glyphAdvance(uint32_t codepoint) const;
+    void drawGlyph(int x, int y, uint32_t codepoint);
+    void layoutText();
+    void drawTextRows(int top, int bottom);  // 绘制与屏幕第top到bottom-1行相交的文本行
+    void renderViewport();
+    void scrollTo(int target);
+    int maxScroll() const;
+    void tickAnimation(unsigned long now);
+    void tickScroll(unsigned long now);
+    
+    static const size_t I2C_CHUNK_SIZE = 127;  // 每次I2C传输的数据字节数（ESP32 Wire缓冲区为128字节）
+    
+    void flush();         // 只发送脏页中变化的列范围
+    void fullRefresh();   // 发送整个帧缓冲区，用于初始化
+    uint32_t sendCommands(const uint8_t* commands, size_t count);
+    uint32_t sendData(const uint8_t* data, size_t count);
 
-    // 表情绘制私有方法
-    void drawHappyFace();
-    void drawSadFace();
-    void drawAngryFace();
-    void drawSurprisedFace();
-    void drawSleepyFace();
-    void drawHeartEyes();
-    void drawCoolFace();
-    void drawThinkingFace();
+    // 表情显示：整屏位图一次拷贝，再叠加运行时绘制的文字
+    void blitEmotion(Emotion emotion);
+    void drawEmotionOverlay(Emotion emotion);
+    void startAnimation(Emotion emotion, unsigned long now);
+    void stopAnimation();
+    void renderAnimationFrame();
+    void applyBlink(Emotion emotion, uint8_t level);
+    void shiftRows(int pixels);  // 整个帧缓冲区垂直平移，正数向下
+    void drawTypingDots(uint8_t count);
+    
+#if OLED_VERIFY_BITMAPS
+    void verifyEmotionBitmaps();  // 用原始绘制方法（emotion_primitives.h）校验预生成的位图
+#endif
 
 public:
     OledDisplay(int width, int height, int sda, int scl, int address);
     bool init();
+    static Emotion parseEmotion(String emotion);
     void displayEmotion(String emotion);
-    void displayText(String text);
+    void displayText(const char* text);
+    int pageText(int pages);              // 翻页，正数向后；返回翻页后的页码（从1开始）
+    int getTextPageCount() const;
+    void setScrollSpeed(uint16_t pixelsPerSecond);
     void clear();
+    void tick(unsigned long now);  // 推进表情动画和文本自动滚动，应在loop()中调用
+    unsigned long timeUntilNextFrame(unsigned long now) const;  // 距下一帧的毫秒数，没有动画时返回ULONG_MAX
     bool isInitialized() const;
+    uint32_t getLastFlushBytes() const;
+    uint32_t getTotalFlushBytes() const;
+    uint32_t getFlushCount() const;
+    uint32_t getRenderedFrames() const;
+    uint32_t getUnchangedFrames() const;
 };
 
 #endif
@@ -0,0 +1,88 @@
+#include "servo_calibration.h"
+#include <Preferences.h>
+
+ServoCalibration::ServoCalibration(const char* nvsKey) : key(nvsKey) {
+    reset();
+}
+
+void ServoCalibration::reset() {
+    for (uint8_t i = 0; i < SERVO_CALIBRATION_POINTS; i++) {
+        pulses[i] = SERVO_DEFAULT_MIN_US +
+                    (uint32_t)(SERVO_DEFAULT_MAX_US - SERVO_DEFAULT_MIN_US) * i / (SERVO_CALIBRATION_POINTS - 1);
+    }
+}
+
+bool ServoCalibration::load() {
+    Preferences preferences;
+    if (!preferences.begin(SERVO_CALIBRATION_NVS, true)) {
+        return false;
+    }
+    // 校准点数量变化后旧表长度不符，直接忽略
+    uint16_t stored[SERVO_CALIBRATION_POINTS];
+    bool loaded = preferences.getBytesLength(key) == sizeof(stored) &&
+                  preferences.getBytes(key, stored, sizeof(stored)) == sizeof(stored);
+    preferences.end();
+    if (!loaded) {
+        return false;
+    }
+    for (uint8_t i = 0; i < SERVO_CALIBRATION_POINTS; i++) {
+        if (stored[i] < SERVO_PULSE_MIN_US || stored[i] > SERVO_PULSE_MAX_US) {
+            return false;
+        }
+    }
+    memcpy(pulses, stored, sizeof(pulses));
+    return true;
+}
+
+bool ServoCalibration::save() const {
+    Preferences preferences;
+    if (!preferences.begin(SERVO_CALIBRATION_NVS, false)) {
+        return false;
+    }
+    bool saved = preferences.putBytes(key, pulses, sizeof(pulses)) == sizeof(pulses);
+    preferences.end();
+    return saved;
+}
+
+bool ServoCalibration::remove() {
+    Preferences preferences;
+    if (!preferences.begin(SERVO_CALIBRATION_NVS, false)) {
+        return false;
+    }
+    bool removed = preferences.remove(key);
+    preferences.end();
+    return removed;
+}
+
+bool ServoCalibration::isValidPoint(int angle, int pulseUs) {
+    return angle >= 0 && angle <= 180 && angle % SERVO_CALIBRATION_STEP == 0 &&
+           pulseUs >= SERVO_PULSE_MIN_US && pulseUs <= SERVO_PULSE_MAX_US;
+}
+
+void ServoCalibration::setPoint(int angle, uint16_t pulseUs) {
+    pulses[angle / SERVO_CALIBRATION_STEP] = pulseUs;
+}
+
+uint16_t ServoCalibration::getPoint(uint8_t index) const {
+    return index < SERVO_CALIBRATION_POINTS ? pulses[index] : 0;
+}
+
+uint16_t ServoCalibration::pulseFor(AngleQ8 angle) const {
+    const AngleQ8 span = angleToQ8(SERVO_CALIBRATION_STEP);
+    if (angle <= 0) {
+        return pulses[0];
+    }
+    if (angle >= angleToQ8(180)) {
+        return pulses[SERVO_CALIBRATION_POINTS - 1];
+    }
+    
+    // 相邻两个校准点之间按小数角度线性插值；装反的舵机校准表是递减的，差值可以为负
+    uint8_t index = angle / span;
+    int32_t fraction = angle - index * span;
+    int32_t delta = (int32_t)pulses[index + 1] - pulses[index];
+    return pulses[index] + (delta * fraction + (delta >= 0 ? span / 2 : -span / 2)) / span;
+}
+
+const char* ServoCalibration::getKey() const {
+    return key;
+}
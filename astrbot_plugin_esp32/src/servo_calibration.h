@@ -0,0 +1,42 @@
+#ifndef SERVO_CALIBRATION_H
+#define SERVO_CALIBRATION_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// 角度定点数：低8位为小数部分（1/256度），插值轨迹和输出级全程使用整数运算
+typedef int32_t AngleQ8;
+const uint8_t ANGLE_FRAC_BITS = 8;
+
+constexpr AngleQ8 angleToQ8(int degrees) {
+    return (AngleQ8)degrees << ANGLE_FRAC_BITS;
+}
+
+inline int angleFromQ8(AngleQ8 angle) {
+    return (angle + (1 << (ANGLE_FRAC_BITS - 1))) >> ANGLE_FRAC_BITS;
+}
+
+const uint8_t SERVO_CALIBRATION_POINTS = 180 / SERVO_CALIBRATION_STEP + 1;
+
+// 单个舵机通道的校准表：每隔SERVO_CALIBRATION_STEP度一个脉宽（微秒），之间线性插值
+// 每个引脚并联两个舵机，各通道按实际装配调整校准点，让两个舵机停在同一位置而不互相顶着
+class ServoCalibration {
+private:
+    const char* key;  // NVS中的键名
+    uint16_t pulses[SERVO_CALIBRATION_POINTS];
+
+public:
+    explicit ServoCalibration(const char* nvsKey);
+    void reset();       // 恢复为与ESP32Servo默认映射一致的线性表
+    bool load();        // 从NVS读取，没有保存过时保留当前表
+    bool save() const;
+    bool remove();      // 删除NVS中保存的表
+    // angle须为SERVO_CALIBRATION_STEP的整数倍，pulseUs须在SERVO_PULSE_MIN_US到SERVO_PULSE_MAX_US之间
+    static bool isValidPoint(int angle, int pulseUs);
+    void setPoint(int angle, uint16_t pulseUs);
+    uint16_t getPoint(uint8_t index) const;
+    uint16_t pulseFor(AngleQ8 angle) const;  // 控制周期中调用，只用整数运算
+    const char* getKey() const;
+};
+
+#endif
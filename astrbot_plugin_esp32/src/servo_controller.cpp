@@ -1,7 +1,22 @@
 #include "servo_controller.h"
+#include "config.h"
+#include "binary_log.h"
+#include "metrics.h"
 
-ServoController::ServoController() 
-    : leftPin(39), rightPin(38), currentLeftAngle(90), currentRightAngle(90) {
+TaskHandle_t ServoController::controlTaskHandle = nullptr;
+
+ServoController::ServoController()
+    : leftOutput("left", SERVO_LEFT_SLEW_DPS, SERVO_CENTER_ANGLE),
+      rightOutput("right", SERVO_RIGHT_SLEW_DPS, SERVO_CENTER_ANGLE),
+      leftPin(39), rightPin(38),
+      motionState(MotionState::Idle), motionStep(0), nextStepAt(0), currentGait(nullptr),
+      activeKind(MotionKind::Gait), outputPending(false), eventHead(0), eventCount(0),
+      walkCycles(0), walkCyclesDone(0), walkDurationMs(0), walkStartedAt(0), walkTempo(100),
+      walkUntilStop(false), walkFinishing(false),
+      stopPending(false), stopRequestedAt(0),
+      leftTrajectory{angleToQ8(90), angleToQ8(90), angleToQ8(90), 0, 0, false},
+      rightTrajectory{angleToQ8(90), angleToQ8(90), angleToQ8(90), 0, 0, false},
+      motionProfile(MotionProfile::MinJerk), motionLock(nullptr), controlTimer(nullptr) {
 }
 
 void ServoController::init(int leftLegPin, int rightLegPin) {
@@ -11,179 +26,496 @@ void ServoController::init(int leftLegPin, int rightLegPin) {
     Serial.begin(9600);
     Serial.println("开始初始化舵机腿部控制...");
     
-    // 将舵机连接到指定引脚
-    servoLeft.attach(leftPin);
-    servoRight.attach(rightPin);
+    // 将舵机连接到指定引脚，同时读取NVS中保存的校准表
+    leftOutput.attach(leftPin);
+    rightOutput.attach(rightPin);
     
     // 等待舵机连接稳定
     delay(500);
     
-    // 设置初始站立姿态
+    motionLock = xSemaphoreCreateMutex();
+    startControlLoop();
+    
+    // 设置初始站立姿态（由控制任务完成）
     standUp();
 }
 
-void ServoController::moveLeftLeg(int angle) {
-    // 限制角度范围
-    if (angle < 0) angle = 0;
-    if (angle > 180) angle = 180;
+void ServoController::startControlLoop() {
+    // 控制任务与loop()同核，优先级更高，保证采样周期不受loop()繁忙程度影响
+    xTaskCreatePinnedToCore(controlTask, "servo_ctrl", 4096, this, 5, &controlTaskHandle, ARDUINO_RUNNING_CORE);
     
-    servoLeft.write(angle);
-    currentLeftAngle = angle;
+    // 硬件定时器：1MHz计数，每个控制周期唤醒一次控制任务
+    controlTimer = timerBegin(0, 80, true);
+    timerAttachInterrupt(controlTimer, &ServoController::onControlTimer, true);
+    timerAlarmWrite(controlTimer, 1000000 / SERVO_CONTROL_HZ, true);
+    timerAlarmEnable(controlTimer);
     
-    Serial.println("左腿角度设置为: " + String(angle) + "度");
+    Serial.println("舵机控制环已启动: " + String(SERVO_CONTROL_HZ) + "Hz");
+}
+
+void IRAM_ATTR ServoController::onControlTimer() {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(controlTaskHandle, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void ServoController::controlTask(void* param) {
+    ServoController* controller = static_cast<ServoController*>(param);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        controller->tick(millis());
+    }
 }
 
-void ServoController::moveRightLeg(int angle) {
+// 返回false表示该通道已经停在目标角度，不需要新的轨迹
+bool ServoController::setTarget(ServoTrajectory& trajectory, int angle, unsigned long duration, unsigned long now) {
     // 限制角度范围
     if (angle < 0) angle = 0;
     if (angle > 180) angle = 180;
+    AngleQ8 target = angleToQ8(angle);
+    if (!trajectory.active && trajectory.position == target) {
+        return false;
+    }
     
-    servoRight.write(angle);
-    currentRightAngle = angle;
+    // 从当前插值位置出发，保证重新设定目标时不跳变
+    trajectory.startAngle = trajectory.position;
+    trajectory.targetAngle = target;
+    trajectory.startTime = now;
+    trajectory.duration = duration;
+    trajectory.active = true;
+    return true;
+}
+
+AngleQ8 ServoController::sampleTrajectory(ServoTrajectory& trajectory, unsigned long now) {
+    unsigned long elapsed = now - trajectory.startTime;
+    if (elapsed >= trajectory.duration) {
+        trajectory.active = false;
+        trajectory.position = trajectory.targetAngle;
+        return trajectory.position;
+    }
     
-    Serial.println("右腿角度设置为: " + String(angle) + "度");
+    // 进度s为Q16定点数（ONE即1.0），曲线多项式逐项右移回Q16，控制周期中不做浮点运算
+    const int64_t ONE = 1 << 16;
+    int64_t s = ((int64_t)elapsed << 16) / trajectory.duration;
+    int64_t s2 = (s * s) >> 16;
+    switch (motionProfile) {
+        case MotionProfile::Cubic:
+            s = (s2 * (3 * ONE - 2 * s)) >> 16;
+            break;
+        case MotionProfile::MinJerk:
+            s = ((((s2 * s) >> 16) * (10 * ONE - 15 * s + 6 * s2)) >> 16);
+            break;
+        default:
+            break;
+    }
+    int64_t distance = trajectory.targetAngle - trajectory.startAngle;
+    trajectory.position = trajectory.startAngle + (AngleQ8)((distance * s) / ONE);
+    return trajectory.position;
 }
 
-void ServoController::moveLegs(int leftAngle, int rightAngle) {
-    moveLeftLeg(leftAngle);
-    moveRightLeg(rightAngle);
+MotionAdmission ServoController::moveLeftLeg(int angle, unsigned long duration, const MotionTag& tag) {
+    LOG(LEFT_LEG_TARGET, angle, duration);
+    return submitMotion(MotionRequest::target(MotionKind::LeftLeg, angle, 0, duration), tag);
 }
 
-void ServoController::standUp() {
-    Serial.println("设置舵机初始站立角度...");
-    
-    // 左腿初始化为180度，右腿初始化为0度
-    moveLeftLeg(180);
-    moveRightLeg(0);
-    delay(1000);
-    
-    // 然后移动到中心站立位置
-    moveLeftLeg(90);
-    moveRightLeg(90);
-    delay(1000);
-    
-    Serial.println("站立完成");
+MotionAdmission ServoController::moveRightLeg(int angle, unsigned long duration, const MotionTag& tag) {
+    LOG(RIGHT_LEG_TARGET, angle, duration);
+    return submitMotion(MotionRequest::target(MotionKind::RightLeg, 0, angle, duration), tag);
 }
 
-void ServoController::walkForward() {
-    Serial.println("开始前进步态...");
-    
-    // 第一步：右腿前进，左腿后退
-    Serial.println("右腿前进，左腿后退");
-    moveRightLeg(45);   // 右腿前进到中间位置
-    moveLeftLeg(45);    // 左腿后退到中间位置
-    delay(500);
-    
-    // 第二步：右腿继续前进，左腿继续后退
-    moveRightLeg(30);   // 右腿更多前进
-    moveLeftLeg(30);    // 左腿更多后退
-    delay(500);
-    
-    // 第三步：切换方向 - 右腿后退，左腿前进
-    Serial.println("右腿后退，左腿前进");
-    moveRightLeg(120);  // 右腿开始后退
-    moveLeftLeg(120);   // 左腿开始前进
-    delay(500);
-    
-    // 第四步：右腿继续后退，左腿继续前进
-    moveRightLeg(150);  // 右腿更多后退
-    moveLeftLeg(150);   // 左腿更多前进
-    delay(500);
+MotionAdmission ServoController::moveLegs(int leftAngle, int rightAngle, unsigned long duration, const MotionTag& tag) {
+    LOG(LEFT_LEG_TARGET, leftAngle, duration);
+    LOG(RIGHT_LEG_TARGET, rightAngle, duration);
+    return submitMotion(MotionRequest::target(MotionKind::Legs, leftAngle, rightAngle, duration), tag);
+}
+
+void ServoController::standUp(uint32_t requestedAt, const MotionTag& tag) {
+    LOG(GAIT_STAND_UP);
+    preemptMotion(GAIT_STAND_UP, requestedAt, tag);
+}
+
+MotionAdmission ServoController::walkForward(const MotionTag& tag) {
+    LOG(GAIT_WALK_FORWARD);
+    return playGait(GAIT_WALK_FORWARD, tag);
+}
+
+MotionAdmission ServoController::walkBackward(const MotionTag& tag) {
+    LOG(GAIT_WALK_BACKWARD);
+    return playGait(GAIT_WALK_BACKWARD, tag);
+}
+
+void ServoController::stopWalk(uint32_t requestedAt, const MotionTag& tag) {
+    LOG(GAIT_STOP);
+    preemptMotion(GAIT_STOP, requestedAt, tag);
+}
+
+MotionAdmission ServoController::playGait(const Gait& gait, const MotionTag& tag) {
+    return submitMotion(MotionRequest::forGait(gait), tag);
+}
+
+MotionAdmission ServoController::walk(const Gait& cycle, uint16_t cycles, uint32_t durationMs, bool untilStop, uint8_t tempo,
+                                      const MotionTag& tag) {
+    LOG(WALK_START, cycle.name, cycles, durationMs, untilStop, tempo);
+    return submitMotion(MotionRequest::forWalk(cycle, cycles, durationMs, untilStop, tempo), tag);
+}
+
+MotionAdmission ServoController::leftLegForward(const MotionTag& tag) {
+    // 左腿前进：从开始执行时的角度到180度
+    return submitMotion(MotionRequest::target(MotionKind::LeftLeg, 180, 0, 0, LEG_SWEEP_MS_PER_DEGREE), tag);
+}
+
+MotionAdmission ServoController::leftLegBackward(const MotionTag& tag) {
+    // 左腿后退：到0度
+    return submitMotion(MotionRequest::target(MotionKind::LeftLeg, 0, 0, 0, LEG_SWEEP_MS_PER_DEGREE), tag);
+}
+
+MotionAdmission ServoController::rightLegForward(const MotionTag& tag) {
+    // 右腿前进：到0度
+    return submitMotion(MotionRequest::target(MotionKind::RightLeg, 0, 0, 0, LEG_SWEEP_MS_PER_DEGREE), tag);
+}
+
+MotionAdmission ServoController::rightLegBackward(const MotionTag& tag) {
+    // 右腿后退：到180度
+    return submitMotion(MotionRequest::target(MotionKind::RightLeg, 0, 180, 0, LEG_SWEEP_MS_PER_DEGREE), tag);
+}
+
+MotionAdmission ServoController::submitMotion(MotionRequest request, const MotionTag& tag) {
+    MotionAdmission admission = MotionAdmission::Queued;
+    request.tag = tag;
+    MotionTag replaced;
     
-    // 回到中间位置准备下一个循环
-    Serial.println("回到中间位置");
-    moveRightLeg(90);   // 右腿中间位置
-    moveLeftLeg(90);    // 左腿中间位置
-    delay(500);
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    if (motionQueue.supersede(request, replaced)) {
+        LOG(MOTION_SUPERSEDED, (uint8_t)request.kind);
+        pushEvent(replaced, MotionEventType::Superseded, 0);
+    } else if (motionQueue.size() == 0 &&
+               (motionFinished() || (MotionQueue::isTarget(request.kind) && request.kind == activeKind))) {
+        // 空闲，或正在执行的是同类目标：直接从当前插值位置出发，不会跳变
+        beginMotion(request, millis());
+        admission = MotionAdmission::Started;
+    } else if (!motionQueue.push(request)) {
+        admission = MotionAdmission::Rejected;
+    }
+    uint8_t queued = motionQueue.size();
+    xSemaphoreGive(motionLock);
     
-    Serial.println("一个前进步态循环完成");
+    if (admission == MotionAdmission::Rejected) {
+        LOG(MOTION_QUEUE_FULL, queued);
+    }
+    return admission;
 }
 
-void ServoController::walkBackward() {
-    Serial.println("开始后退步态...");
+void ServoController::preemptMotion(const Gait& gait, uint32_t requestedAt, const MotionTag& tag) {
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    retireActive(MotionEventType::Preempted);
+    uint8_t dropped = 0;
+    MotionRequest cancelled;
+    while (motionQueue.pop(cancelled)) {
+        pushEvent(cancelled.tag, MotionEventType::Cancelled, 0);
+        dropped++;
+    }
+    currentGait = &gait;
+    activeKind = MotionKind::Gait;
+    activate(tag);
+    startMotion(MotionState::Gait);
+    stopPending = requestedAt != 0;
+    stopRequestedAt = requestedAt;
+    xSemaphoreGive(motionLock);
     
-    // 后退步态与前进相反
-    // 第一步：左腿前进，右腿后退
-    Serial.println("左腿前进，右腿后退");
-    moveLeftLeg(120);   // 左腿前进
-    moveRightLeg(120);  // 右腿后退
-    delay(500);
+    if (dropped > 0) {
+        LOG(MOTION_QUEUE_CLEARED, dropped);
+    }
+}
+
+// 调用方需持有motionLock
+void ServoController::beginMotion(const MotionRequest& request, unsigned long now) {
+    // 正在执行的同类目标被直接替换时，它没有走完
+    retireActive(MotionEventType::Superseded);
+    activeKind = request.kind;
+    activate(request.tag);
+    if (request.kind == MotionKind::Gait) {
+        currentGait = request.gait;
+        startMotion(MotionState::Gait);
+        return;
+    }
+    if (request.kind == MotionKind::Walk) {
+        currentGait = request.gait;
+        walkCycles = request.cycles;
+        walkDurationMs = request.durationMs;
+        walkUntilStop = request.untilStop;
+        if (walkCycles == 0 && walkDurationMs == 0 && !walkUntilStop) {
+            walkCycles = 1;
+        }
+        walkTempo = request.tempo != 0 ? request.tempo : 100;
+        walkCyclesDone = 0;
+        walkStartedAt = now;
+        walkFinishing = false;
+        startMotion(MotionState::Walk);
+        return;
+    }
     
-    moveLeftLeg(150);   // 左腿更多前进
-    moveRightLeg(150);  // 右腿更多后退
-    delay(500);
+    // 目标角度类动作没有关键帧序列，只设定轨迹；会打断正在播放的步态
+    motionState = MotionState::Idle;
+    if (request.kind != MotionKind::RightLeg) {
+        unsigned long duration = request.msPerDegree != 0
+            ? abs(request.leftAngle - leftOutput.getAngle()) * request.msPerDegree : request.durationMs;
+        setTarget(leftTrajectory, request.leftAngle, duration, now);
+    }
+    if (request.kind != MotionKind::LeftLeg) {
+        unsigned long duration = request.msPerDegree != 0
+            ? abs(request.rightAngle - rightOutput.getAngle()) * request.msPerDegree : request.durationMs;
+        setTarget(rightTrajectory, request.rightAngle, duration, now);
+    }
+}
+
+// 调用方需持有motionLock
+// 轨迹时间走完后输出级可能仍被限速落在后面，等两个通道都追上终点才算结束，
+// 下一个排队动作和完成回执才不会从尚未到达的姿态出发
+bool ServoController::motionFinished() const {
+    return motionState == MotionState::Idle && !leftTrajectory.active && !rightTrajectory.active &&
+           leftOutput.reached(leftTrajectory.position) && rightOutput.reached(rightTrajectory.position);
+}
+
+// 调用方需持有motionLock；动作开始执行时调用，此后的第一次舵机输出归属于这个动作
+void ServoController::activate(const MotionTag& tag) {
+    activeTag = tag;
+    outputPending = tag.t0 != 0;
+}
+
+// 调用方需持有motionLock
+void ServoController::pushEvent(const MotionTag& tag, MotionEventType type, uint32_t at) {
+    if (tag.empty()) return;
+    // 执行核长时间没有取走时丢弃最早的记录，对应命令在服务器端按超时处理
+    if (eventCount == EVENT_SLOTS) {
+        eventHead = (eventHead + 1) % EVENT_SLOTS;
+        eventCount--;
+    }
+    events[(eventHead + eventCount) % EVENT_SLOTS] = {tag, type, at};
+    eventCount++;
+}
+
+// 调用方需持有motionLock；当前动作已经到位时按正常完成记录，否则记为interrupted
+void ServoController::retireActive(MotionEventType interrupted) {
+    pushEvent(activeTag, motionFinished() ? MotionEventType::Completed : interrupted, 0);
+    activeTag = MotionTag();
+    outputPending = false;
+}
+
+bool ServoController::takeMotionEvent(MotionEvent& event) {
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    bool taken = eventCount > 0;
+    if (taken) {
+        event = events[eventHead];
+        eventHead = (eventHead + 1) % EVENT_SLOTS;
+        eventCount--;
+    }
+    xSemaphoreGive(motionLock);
+    return taken;
+}
+
+void ServoController::setMotionProfile(MotionProfile profile) {
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    motionProfile = profile;
+    xSemaphoreGive(motionLock);
+}
+
+MotionProfile ServoController::getMotionProfile() const {
+    return motionProfile;
+}
+
+// 调用方需持有motionLock
+void ServoController::startMotion(MotionState state) {
+    // 替换当前的关键帧序列，第一步在下一个控制周期执行
+    motionState = state;
+    motionStep = 0;
+    nextStepAt = millis();
+}
+
+void ServoController::tick(unsigned long now) {
+    xSemaphoreTake(motionLock, portMAX_DELAY);
     
-    // 第二步：切换方向
-    Serial.println("左腿后退，右腿前进");
-    moveLeftLeg(45);    // 左腿后退
-    moveRightLeg(45);   // 右腿前进
-    delay(500);
+    // 当前动作结束后记录结果，并开始队列中的下一个动作
+    MotionRequest next;
+    if (motionFinished()) {
+        retireActive(MotionEventType::Completed);
+        if (motionQueue.pop(next)) {
+            beginMotion(next, now);
+        }
+    }
     
-    moveLeftLeg(30);    // 左腿更多后退
-    moveRightLeg(30);   // 右腿更多前进
-    delay(500);
+    // 推进动作序列
+    if (motionState != MotionState::Idle && (long)(now - nextStepAt) >= 0) {
+        long holdTime = runMotionStep(motionStep++, now);
+        if (holdTime < 0) {
+            motionState = MotionState::Idle;
+        } else {
+            nextStepAt = now + holdTime;
+        }
+        
+        // 停止/站立的第一帧已替换掉原来的轨迹，本周期起舵机朝新目标移动
+        if (stopPending) {
+            metricsRecordMicros(MetricStage::MotionStop, micros() - stopRequestedAt);
+            stopPending = false;
+        }
+    }
     
-    // 回到中间位置
-    moveLeftLeg(90);
-    moveRightLeg(90);
-    delay(500);
+    // 采样插值轨迹，由输出级限速、去掉重复角度后写入舵机；轨迹结束后输出级继续追赶被限速落下的部分
+    if (leftTrajectory.active) {
+        sampleTrajectory(leftTrajectory, now);
+    }
+    if (rightTrajectory.active) {
+        sampleTrajectory(rightTrajectory, now);
+    }
+    if (leftOutput.update(leftTrajectory.position)) {
+        noteOutput();
+    }
+    if (rightOutput.update(rightTrajectory.position)) {
+        noteOutput();
+    }
     
-    Serial.println("一个后退步态循环完成");
+    xSemaphoreGive(motionLock);
 }
 
-void ServoController::stopWalk() {
-    Serial.println("停止步行，回到站立位置");
-    moveLeftLeg(90);
-    moveRightLeg(90);
-    delay(1000);
+bool ServoController::isBusy() const {
+    return !motionFinished() || motionQueue.size() > 0;
 }
 
-void ServoController::leftLegForward() {
-    // 左腿前进：从90度到180度
-    for(int angle = currentLeftAngle; angle <= 180; angle += 5) {
-        moveLeftLeg(angle);
-        delay(50);
+// 执行当前动作的第step步，返回该步需要保持的时间（毫秒），动作结束时返回-1
+long ServoController::runMotionStep(uint8_t step, unsigned long now) {
+    switch (motionState) {
+        case MotionState::Gait:
+            // 按顺序播放关键帧，在该帧保持时间内插值到目标角度
+            if (step < currentGait->frameCount) {
+                const GaitKeyframe& frame = currentGait->frames[step];
+                bool moving = setTarget(leftTrajectory, frame.leftAngle, frame.durationMs, now);
+                moving = setTarget(rightTrajectory, frame.rightAngle, frame.durationMs, now) || moving;
+                // 两腿已经停在该帧的角度（如步态结束在90度后再收到stop）时不必空等保持时间
+                return moving ? frame.durationMs : 0;
+            }
+            return -1;
+        
+        case MotionState::Walk:
+            return runWalkStep(step, now);
+        
+        default:
+            return -1;
     }
 }
 
-void ServoController::leftLegBackward() {
-    // 左腿后退：从90度到0度
-    for(int angle = currentLeftAngle; angle >= 0; angle -= 5) {
-        moveLeftLeg(angle);
-        delay(50);
+// 调用方需持有motionLock
+long ServoController::runWalkStep(uint8_t step, unsigned long now) {
+    if (walkFinishing) {
+        LOG(WALK_FINISHED, walkCyclesDone);
+        return -1;
+    }
+    
+    if (step >= currentGait->frameCount) {
+        walkCyclesDone++;
+        if (walkShouldEnd(now)) {
+            // 最后回到中心站立位置
+            walkFinishing = true;
+            unsigned long hold = walkHoldTime(WALK_STEP_DELAY);
+            bool moving = setTarget(leftTrajectory, SERVO_CENTER_ANGLE, hold, now);
+            moving = setTarget(rightTrajectory, SERVO_CENTER_ANGLE, hold, now) || moving;
+            return moving ? hold : 0;
+        }
+        // 下一周期直接从第一帧开始，不经过中心位置
+        step = 0;
+        motionStep = 1;
     }
+    
+    const GaitKeyframe& frame = currentGait->frames[step];
+    unsigned long hold = walkHoldTime(frame.durationMs);
+    setTarget(leftTrajectory, frame.leftAngle, hold, now);
+    setTarget(rightTrajectory, frame.rightAngle, hold, now);
+    return hold;
 }
 
-void ServoController::rightLegForward() {
-    // 右腿前进：从90度到0度
-    for(int angle = currentRightAngle; angle >= 0; angle -= 5) {
-        moveRightLeg(angle);
-        delay(50);
+bool ServoController::walkShouldEnd(unsigned long now) const {
+    if (walkUntilStop) {
+        // 一直走到被停止命令打断，或者有其他动作在排队
+        return motionQueue.size() > 0;
     }
+    if (walkCycles != 0 && walkCyclesDone >= walkCycles) {
+        return true;
+    }
+    return walkDurationMs != 0 && now - walkStartedAt >= walkDurationMs;
 }
 
-void ServoController::rightLegBackward() {
-    // 右腿后退：从90度到180度
-    for(int angle = currentRightAngle; angle <= 180; angle += 5) {
-        moveRightLeg(angle);
-        delay(50);
-    }
+unsigned long ServoController::walkHoldTime(unsigned long nominal) const {
+    unsigned long hold = nominal * 100 / walkTempo;
+    return hold < WALK_MIN_STEP_DELAY ? WALK_MIN_STEP_DELAY : hold;
 }
 
 int ServoController::getCurrentLeftAngle() {
-    return currentLeftAngle;
+    return leftOutput.getAngle();
 }
 
 int ServoController::getCurrentRightAngle() {
-    return currentRightAngle;
+    return rightOutput.getAngle();
+}
+
+// 调用方需持有motionLock；只记录当前动作开始执行后的第一次输出
+void ServoController::noteOutput() {
+    if (outputPending) {
+        pushEvent(activeTag, MotionEventType::Output, micros());
+        outputPending = false;
+    }
 }
 
 String ServoController::getStatusString() const {
-    return "左腿角度: " + String(currentLeftAngle) + "度, 右腿角度: " + String(currentRightAngle) + "度";
+    return "左腿角度: " + String(leftOutput.getAngle()) + "度, 右腿角度: " + String(rightOutput.getAngle()) + "度, 写入" +
+           String(leftOutput.getExecutedWrites() + rightOutput.getExecutedWrites()) + "次, 省去重复写入" +
+           String(leftOutput.getSuppressedWrites() + rightOutput.getSuppressedWrites()) + "次";
+}
+
+ServoOutput& ServoController::outputFor(ServoChannel channel) {
+    return channel == ServoChannel::Left ? leftOutput : rightOutput;
+}
+
+bool ServoController::calibrate(ServoChannel channel, int angle, uint16_t pulseUs) {
+    ServoOutput& output = outputFor(channel);
+    // 在锁内修改并复制一份，写NVS耗时较长，放在锁外用副本写入，不与控制任务同时访问同一张表
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    output.getCalibration().setPoint(angle, pulseUs);
+    output.refresh();
+    ServoCalibration snapshot = output.getCalibration();
+    xSemaphoreGive(motionLock);
+    LOG(SERVO_CALIBRATED, snapshot.getKey(), angle, pulseUs);
+    
+    if (!snapshot.save()) {
+        LOG(SERVO_CAL_SAVE_FAILED, snapshot.getKey());
+        return false;
+    }
+    return true;
+}
+
+bool ServoController::resetCalibration(ServoChannel channel) {
+    ServoOutput& output = outputFor(channel);
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    output.getCalibration().reset();
+    output.refresh();
+    xSemaphoreGive(motionLock);
+    LOG(SERVO_CAL_RESET, output.getCalibration().getKey());
+    return output.getCalibration().remove();
+}
+
+String ServoController::getCalibrationString(ServoChannel channel) {
+    xSemaphoreTake(motionLock, portMAX_DELAY);
+    ServoCalibration calibration = outputFor(channel).getCalibration();
+    xSemaphoreGive(motionLock);
+    String text = String(channel == ServoChannel::Left ? "左腿" : "右腿") + "校准表(每" +
+                  String(SERVO_CALIBRATION_STEP) + "度, 微秒):";
+    for (uint8_t i = 0; i < SERVO_CALIBRATION_POINTS; i++) {
+        text += " " + String(calibration.getPoint(i));
+    }
+    return text;
 }
 
 void ServoController::detachServos() {
-    servoLeft.detach();
-    servoRight.detach();
+    leftOutput.detach();
+    rightOutput.detach();
     Serial.println("舵机已断开连接");
 }
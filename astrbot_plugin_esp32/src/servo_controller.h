@@ -2,32 +2,164 @@
 #define SERVO_CONTROLLER_H
 
 #include <Arduino.h>
-#include <ESP32Servo.h>
+#include "servo_output.h"
+#include "gait_tables.h"
+#include "motion_queue.h"
+
+// 当前正在执行的动作，由 tick() 逐步推进
+enum class MotionState : uint8_t {
+    Idle,
+    Gait,      // 播放步态关键帧表
+    Walk       // 循环播放步态周期，满足结束条件后回到中心
+};
+
+// 动作提交的结果
+enum class MotionAdmission : uint8_t {
+    Started,   // 立即开始（或替换了正在执行的同类目标）
+    Queued,    // 进入动作队列，或替换了队尾的同类目标
+    Rejected   // 动作队列已满
+};
+
+// 带标记的动作留给执行核的事件：开始输出用于延迟测量，其余为动作的结束方式，随完成回执告知服务器
+enum class MotionEventType : uint8_t {
+    Output,      // 动作第一次写入舵机（仅带t0的动作）
+    Completed,   // 正常执行完毕，两个通道都已到达终点
+    Superseded,  // 被同类的新目标替换
+    Preempted,   // 执行中被停止/站立打断
+    Cancelled    // 排队中被停止/站立清除，没有执行
+};
+
+struct MotionEvent {
+    MotionTag tag;
+    MotionEventType type;
+    uint32_t at;  // 仅Output有效：写入舵机的时刻（micros()）
+};
+
+// 轨迹插值曲线
+enum class MotionProfile : uint8_t {
+    Linear,    // 匀速
+    Cubic,     // 三次曲线，起止速度为0
+    MinJerk    // 最小加加速度曲线，起止速度和加速度均为0
+};
+
+// 舵机通道（每个通道是并联在同一引脚上的两个舵机）
+enum class ServoChannel : uint8_t {
+    Left,
+    Right
+};
+
+// 单个舵机通道从起始角度到目标角度的插值轨迹
+// 角度均为AngleQ8定点数，插值得到的小数角度原样交给输出级
+struct ServoTrajectory {
+    AngleQ8 startAngle;
+    AngleQ8 targetAngle;
+    AngleQ8 position;        // 当前插值位置
+    unsigned long startTime;
+    unsigned long duration;
+    bool active;
+};
 
 class ServoController {
 private:
-    Servo servoLeft;   // 左腿舵机 (引脚39) - 两条左腿并联
-    Servo servoRight;  // 右腿舵机 (引脚38) - 两条右腿并联
+    ServoOutput leftOutput;   // 左腿舵机 (引脚39) - 两条左腿并联
+    ServoOutput rightOutput;  // 右腿舵机 (引脚38) - 两条右腿并联
     int leftPin, rightPin;
-    int currentLeftAngle, currentRightAngle;
+    
+    // 非阻塞动作状态机
+    MotionState motionState;
+    uint8_t motionStep;
+    unsigned long nextStepAt;
+    const Gait* currentGait;  // 正在播放的步态
+    MotionKind activeKind;    // 正在执行的动作类型
+    MotionQueue motionQueue;  // 当前动作结束后依次执行的动作
+    MotionTag activeTag;      // 正在执行的动作的标记
+    bool outputPending;       // 正在执行的动作带t0且还没有写入过舵机
+    
+    // 带标记的动作事件，按发生顺序由执行核取走；每个动作最多两条（开始输出、结束），
+    // 容量覆盖正在执行的和排队的全部动作
+    static const uint8_t EVENT_SLOTS = (MOTION_QUEUE_SIZE + 2) * 2;
+    MotionEvent events[EVENT_SLOTS];
+    uint8_t eventHead;
+    uint8_t eventCount;
+    
+    // 连续步行：在周期边界检查结束条件
+    uint16_t walkCycles;       // 目标周期数，0表示不限
+    uint16_t walkCyclesDone;
+    uint32_t walkDurationMs;   // 目标总时长，0表示不限
+    unsigned long walkStartedAt;
+    uint8_t walkTempo;
+    bool walkUntilStop;
+    bool walkFinishing;        // 正在播放回到中心的最后一帧
+    
+    // 停止耗时：停止/站立命令从网络核收到到控制任务开始执行它的时间
+    bool stopPending;
+    uint32_t stopRequestedAt;
+    
+    // 轨迹插值，由硬件定时器驱动的控制任务按固定频率采样
+    ServoTrajectory leftTrajectory, rightTrajectory;
+    MotionProfile motionProfile;
+    SemaphoreHandle_t motionLock;  // 保护动作状态，命令来自loop()，执行在控制任务中
+    hw_timer_t* controlTimer;
+    static TaskHandle_t controlTaskHandle;
+    
+    void startMotion(MotionState state);
+    MotionAdmission submitMotion(MotionRequest request, const MotionTag& tag);
+    void preemptMotion(const Gait& gait, uint32_t requestedAt, const MotionTag& tag);
+    void beginMotion(const MotionRequest& request, unsigned long now);
+    void activate(const MotionTag& tag);
+    bool motionFinished() const;
+    void pushEvent(const MotionTag& tag, MotionEventType type, uint32_t at);
+    void retireActive(MotionEventType interrupted);
+    long runWalkStep(uint8_t step, unsigned long now);
+    bool walkShouldEnd(unsigned long now) const;
+    unsigned long walkHoldTime(unsigned long nominal) const;
+    long runMotionStep(uint8_t step, unsigned long now);
+    bool setTarget(ServoTrajectory& trajectory, int angle, unsigned long duration, unsigned long now);
+    AngleQ8 sampleTrajectory(ServoTrajectory& trajectory, unsigned long now);
+    void startControlLoop();
+    void noteOutput();
+    ServoOutput& outputFor(ServoChannel channel);
+    static void IRAM_ATTR onControlTimer();
+    static void controlTask(void* param);
     
 public:
     ServoController();
     void init(int leftLegPin = 39, int rightLegPin = 38);
-    void moveLeftLeg(int angle);
-    void moveRightLeg(int angle);
-    void moveLegs(int leftAngle, int rightAngle);
-    void standUp();          // 站立姿态
-    void walkForward();      // 前进步态循环
-    void walkBackward();     // 后退步态循环
-    void stopWalk();         // 停止并回到中心位置
-    void leftLegForward();   // 左腿前进 (180-90度)
-    void leftLegBackward();  // 左腿后退 (90-0度)
-    void rightLegForward();  // 右腿前进 (0-90度)
-    void rightLegBackward(); // 右腿后退 (90-180度)
+    // 以下动作均为非阻塞：调用后立即返回，由控制任务推进
+    // 步态和腿部动作在当前动作结束后依次执行；同类的新目标角度替换尚未完成的旧目标，不再排队
+    // tag为动作对应的命令，非空时动作开始输出和结束后可由takeMotionEvent()取得事件
+    // 移动到指定角度；duration为0时直接跳转，否则按当前插值曲线平滑移动
+    MotionAdmission moveLeftLeg(int angle, unsigned long duration = 0, const MotionTag& tag = MotionTag());
+    MotionAdmission moveRightLeg(int angle, unsigned long duration = 0, const MotionTag& tag = MotionTag());
+    MotionAdmission moveLegs(int leftAngle, int rightAngle, unsigned long duration = 0, const MotionTag& tag = MotionTag());
+    MotionAdmission walkForward(const MotionTag& tag = MotionTag());   // 前进步态循环
+    MotionAdmission walkBackward(const MotionTag& tag = MotionTag());  // 后退步态循环
+    MotionAdmission playGait(const Gait& gait, const MotionTag& tag = MotionTag());  // 播放任意步态关键帧表
+    // 连续步行：循环播放cycle（GAIT_WALK_*_CYCLE），周期之间不回中心；
+    // 走满cycles个周期、走满durationMs或（untilStop时）有其他动作排队后，在周期边界回到中心
+    // 三个结束条件都没给时只走一个周期；tempo为步速百分比，100为步态表的标准速度
+    MotionAdmission walk(const Gait& cycle, uint16_t cycles, uint32_t durationMs, bool untilStop, uint8_t tempo,
+                         const MotionTag& tag = MotionTag());
+    MotionAdmission leftLegForward(const MotionTag& tag = MotionTag());   // 左腿前进 (到180度)
+    MotionAdmission leftLegBackward(const MotionTag& tag = MotionTag());  // 左腿后退 (到0度)
+    MotionAdmission rightLegForward(const MotionTag& tag = MotionTag());  // 右腿前进 (到0度)
+    MotionAdmission rightLegBackward(const MotionTag& tag = MotionTag()); // 右腿后退 (到180度)
+    // 停止和站立不排队：清空动作队列并在下一个控制周期打断当前动作
+    // requestedAt为收到命令的时刻（micros()），用于统计停止耗时，0表示不统计
+    void standUp(uint32_t requestedAt = 0, const MotionTag& tag = MotionTag());   // 站立姿态
+    void stopWalk(uint32_t requestedAt = 0, const MotionTag& tag = MotionTag());  // 停止并回到中心位置
+    bool takeMotionEvent(MotionEvent& event);  // 取出最早的一个动作事件，没有时返回false
+    void setMotionProfile(MotionProfile profile);
+    MotionProfile getMotionProfile() const;
     int getCurrentLeftAngle();
     int getCurrentRightAngle();
     String getStatusString() const;
+    // 校准：修改校准点后立即按新表重新输出当前角度，并保存到NVS；保存失败时返回false，新表仍在本次运行中生效
+    bool calibrate(ServoChannel channel, int angle, uint16_t pulseUs);
+    bool resetCalibration(ServoChannel channel);  // 恢复默认校准表并删除NVS中保存的表
+    String getCalibrationString(ServoChannel channel);
+    void tick(unsigned long now);  // 控制周期：推进当前动作并输出插值角度
+    bool isBusy() const;
     void detachServos();
 };
 
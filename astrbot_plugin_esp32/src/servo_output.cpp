@@ -0,0 +1,92 @@
+#include "servo_output.h"
+#include "config.h"
+#include "metrics.h"
+#include "binary_log.h"
+
+ServoOutput::ServoOutput(const char* calibrationKey, uint16_t degreesPerSecond, int initialAngle)
+    : calibration(calibrationKey), commanded(angleToQ8(initialAngle)), written(-1),
+      maxStep(angleToQ8(degreesPerSecond) / SERVO_CONTROL_HZ),
+      executedWrites(0), suppressedWrites(0), slewLimitedTicks(0) {
+}
+
+void ServoOutput::attach(int pin) {
+    if (calibration.load()) {
+        LOG(SERVO_CAL_LOADED, calibration.getKey());
+    }
+    servo.attach(pin, SERVO_PULSE_MIN_US, SERVO_PULSE_MAX_US);
+}
+
+void ServoOutput::detach() {
+    servo.detach();
+}
+
+bool ServoOutput::update(AngleQ8 target) {
+    // 已经到位时直接返回，空闲的控制周期不产生任何写入
+    if (reached(target)) {
+        return false;
+    }
+    
+    AngleQ8 step = target - commanded;
+    bool limited = false;
+    if (maxStep > 0 && step > maxStep) {
+        step = maxStep;
+        limited = true;
+    } else if (maxStep > 0 && step < -maxStep) {
+        step = -maxStep;
+        limited = true;
+    }
+    commanded += step;
+    if (limited) slewLimitedTicks++;
+    
+    // 慢速插值时相邻周期的脉宽常常相同，这样的写入没有意义
+    uint16_t pulse = calibration.pulseFor(commanded);
+    if (pulse == written) {
+        suppressedWrites++;
+        metricsRecordServoWrite(false, limited);
+        return false;
+    }
+    writePulse(pulse);
+    metricsRecordServoWrite(true, limited);
+    return true;
+}
+
+void ServoOutput::writePulse(uint16_t pulseUs) {
+    servo.writeMicroseconds(pulseUs);
+    written = pulseUs;
+    executedWrites++;
+}
+
+bool ServoOutput::reached(AngleQ8 target) const {
+    return commanded == target;
+}
+
+int ServoOutput::getAngle() const {
+    return angleFromQ8(commanded);
+}
+
+int ServoOutput::getPulseUs() const {
+    return written;
+}
+
+ServoCalibration& ServoOutput::getCalibration() {
+    return calibration;
+}
+
+void ServoOutput::refresh() {
+    // 尚未输出过的通道保持不动，等第一次动作时再按新表输出
+    if (written >= 0) {
+        writePulse(calibration.pulseFor(commanded));
+    }
+}
+
+uint32_t ServoOutput::getExecutedWrites() const {
+    return executedWrites;
+}
+
+uint32_t ServoOutput::getSuppressedWrites() const {
+    return suppressedWrites;
+}
+
+uint32_t ServoOutput::getSlewLimitedTicks() const {
+    return slewLimitedTicks;
+}
@@ -0,0 +1,45 @@
+#ifndef SERVO_OUTPUT_H
+#define SERVO_OUTPUT_H
+
+#include <Arduino.h>
+#include <ESP32Servo.h>
+#include "servo_calibration.h"
+
+// 单个舵机通道的输出级：每个控制周期把插值轨迹给出的角度限速后，经校准表换算为脉宽写入舵机
+// 角度和脉宽全程为整数：小数角度不再取整到整度，脉宽与上次写入相同时不再写
+// 目标突变时按最大转速逐周期逼近，避免并联舵机同时猛转造成电流尖峰
+// 只在持有ServoController::motionLock时调用
+class ServoOutput {
+private:
+    Servo servo;
+    ServoCalibration calibration;
+    AngleQ8 commanded;  // 限速后的角度，逐周期逼近目标
+    int written;        // 最近一次写入舵机的脉宽（微秒），-1表示尚未写入
+    AngleQ8 maxStep;    // 每个控制周期最多转过的角度，0表示不限速
+    
+    // 写入统计
+    uint32_t executedWrites;
+    uint32_t suppressedWrites;
+    uint32_t slewLimitedTicks;
+    
+    void writePulse(uint16_t pulseUs);
+
+public:
+    // calibrationKey为校准表在NVS中的键名；degreesPerSecond为该通道的最大转速，0表示不限速；
+    // initialAngle为上电后舵机所处的角度
+    ServoOutput(const char* calibrationKey, uint16_t degreesPerSecond, int initialAngle);
+    void attach(int pin);  // 同时从NVS读取校准表
+    void detach();
+    // 朝target前进一个控制周期，实际写入舵机时返回true
+    bool update(AngleQ8 target);
+    bool reached(AngleQ8 target) const;  // 输出已经到达target，不再需要写入
+    int getAngle() const;      // 当前角度，取整到度
+    int getPulseUs() const;    // 最近一次写入的脉宽
+    ServoCalibration& getCalibration();
+    void refresh();            // 校准表修改后按当前角度重新写入，立即生效
+    uint32_t getExecutedWrites() const;
+    uint32_t getSuppressedWrites() const;
+    uint32_t getSlewLimitedTicks() const;
+};
+
+#endif
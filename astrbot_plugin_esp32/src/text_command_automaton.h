@@ -0,0 +1,173 @@
+// 由 tools/gen_text_commands.py 生成，请勿手动修改
+#ifndef TEXT_COMMAND_AUTOMATON_H
+#define TEXT_COMMAND_AUTOMATON_H
+
+#include <stdint.h>
+#include "command.h"
+
+// ESP32上const数组直接存放在flash中
+
+typedef uint8_t TextCommandState;
+const uint16_t TEXT_COMMAND_STATE_COUNT = 157;
+const uint8_t TEXT_COMMAND_RULE_COUNT = 12;
+const uint8_t TEXT_COMMAND_NO_RULE = 0xFF;
+
+// 规则按优先级排列，序号越小优先级越高
+const CommandAction TEXT_COMMAND_RULE_ACTIONS[] = {
+    CommandAction::LedOn,
+    CommandAction::LedOff,
+    CommandAction::LedStatus,
+    CommandAction::WalkForward,
+    CommandAction::WalkBackward,
+    CommandAction::StandUp,
+    CommandAction::Stop,
+    CommandAction::LeftForward,
+    CommandAction::LeftBackward,
+    CommandAction::RightForward,
+    CommandAction::RightBackward,
+    CommandAction::ServoStatus,
+};
+
+const char* const TEXT_COMMAND_RULE_NAMES[] = {
+    "执行点亮LED操作",
+    "执行关闭LED操作",
+    "查询LED状态",
+    "执行前进步态",
+    "执行后退步态",
+    "执行站立动作",
+    "执行停止动作",
+    "左腿前进动作",
+    "左腿后退动作",
+    "右腿前进动作",
+    "右腿后退动作",
+    "查询舵机状态",
+};
+
+// 状态s的转移边为TEXT_COMMAND_EDGE_BYTES[EDGE_START[s] .. EDGE_START[s+1])，按字节升序排列
+const uint16_t TEXT_COMMAND_EDGE_START[] = {
+    0, 5, 7, 8, 9, 10, 11, 11, 19, 20, 21, 22, 23, 23, 27, 28,
+    29, 30, 31, 31, 32, 34, 35, 36, 36, 37, 38, 39, 40, 40, 41, 42,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 50, 51, 52, 53, 54, 55, 56,
+    57, 57, 58, 59, 60, 61, 61, 63, 64, 66, 67, 67, 70, 72, 73, 74,
+    75, 75, 76, 77, 78, 78, 79, 79, 80, 81, 82, 83, 83, 84, 86, 87,
+    88, 88, 89, 90, 90, 91, 92, 93, 93, 94, 96, 97, 98, 98, 99, 100,
+    100, 101, 102, 103, 104, 104, 105, 106, 108, 109, 110, 112, 113, 113, 114, 115,
+    117, 118, 118, 119, 119, 120, 120, 121, 122, 124, 125, 126, 128, 129, 129, 130,
+    131, 133, 134, 134, 135, 135, 136, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+    145, 146, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 156,
+};
+
+const uint8_t TEXT_COMMAND_EDGE_BYTES[] = {
+    0x4C, 0xE4, 0xE5, 0xE7, 0xE8, 0xB8, 0xBA, 0xAE, 0xE7, 0x81, 0xAF, 0x80, 0x81, 0x85, 0x89, 0x8F,
+    0x90, 0xB7, 0xBC, 0x80, 0xE7, 0x81, 0xAF, 0x81, 0x82, 0x86, 0xAB, 0xB9, 0xE4, 0xBA, 0xAE, 0xB3,
+    0xE7, 0xE9, 0x81, 0xAF, 0x84, 0xE7, 0x81, 0xAD, 0x97, 0xAD, 0x45, 0x44, 0xE7, 0x8A, 0xB6, 0xE6,
+    0x80, 0x81, 0xAF, 0xE7, 0x8A, 0xB6, 0xE6, 0x80, 0x81, 0x8D, 0xE8, 0xBF, 0x9B, 0x8E, 0x91, 0xE5,
+    0x89, 0x90, 0x8D, 0x85, 0x88, 0xB5, 0xB0, 0xB7, 0xE5, 0x89, 0x8D, 0xE9, 0x80, 0x80, 0x8E, 0x92,
+    0xE9, 0x80, 0x80, 0x99, 0xE7, 0xE8, 0xAB, 0x8B, 0xB5, 0xB7, 0xE7, 0xAB, 0x8B, 0x9C, 0xE4, 0xE6,
+    0xAD, 0xA2, 0xB8, 0x8B, 0x8D, 0xE5, 0x8A, 0xA8, 0xA6, 0xE8, 0x84, 0x85, 0xBF, 0xE5, 0x89, 0x90,
+    0x8D, 0x9A, 0xE5, 0x89, 0x90, 0x8D, 0x8E, 0x8E, 0xB3, 0xE8, 0x84, 0x85, 0xBF, 0xE5, 0x89, 0x90,
+    0x8D, 0x9A, 0xE5, 0x89, 0x90, 0x8D, 0x8E, 0x8E, 0xB5, 0xE6, 0x9C, 0xBA, 0xE7, 0x8A, 0xB6, 0xE6,
+    0x80, 0x81, 0xBF, 0xE9, 0x83, 0xA8, 0xE7, 0x8A, 0xB6, 0xE6, 0x80, 0x81,
+};
+
+const uint8_t TEXT_COMMAND_EDGE_TARGETS[] = {
+    32, 1, 7, 13, 59, 96, 2, 3, 4, 5, 6, 71, 88, 19, 49, 118,
+    54, 101, 8, 9, 10, 11, 12, 41, 14, 24, 76, 15, 16, 17, 18, 20,
+    21, 29, 22, 23, 25, 26, 27, 28, 30, 31, 33, 34, 35, 36, 37, 38,
+    39, 40, 42, 43, 44, 45, 46, 47, 48, 50, 51, 52, 53, 65, 55, 56,
+    57, 69, 58, 146, 135, 60, 61, 84, 62, 63, 64, 66, 67, 68, 70, 72,
+    73, 74, 75, 77, 78, 81, 79, 80, 82, 83, 85, 86, 87, 89, 93, 90,
+    91, 92, 94, 95, 97, 98, 99, 100, 102, 103, 109, 104, 105, 106, 107, 114,
+    108, 110, 111, 112, 116, 113, 115, 117, 119, 120, 126, 121, 122, 123, 124, 131,
+    125, 127, 128, 129, 133, 130, 132, 134, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156,
+};
+
+// 根状态的完整转移表，消息中大多数字节都从根状态出发，避免逐条查找
+const uint8_t TEXT_COMMAND_ROOT[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 7, 0, 13, 59, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// 失配指针
+const uint8_t TEXT_COMMAND_FAIL[] = {
+    0, 0, 0, 0, 13, 41, 42, 0, 0, 0, 13, 41, 42, 0, 0, 0,
+    1, 2, 3, 0, 0, 13, 41, 42, 0, 0, 13, 41, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 0, 59, 0, 0, 0, 0, 7, 49, 50, 0, 0, 0, 7, 49,
+    50, 0, 0, 0, 0, 54, 65, 0, 0, 0, 0, 0, 0, 0, 13, 76,
+    0, 59, 60, 84, 0, 13, 76, 0, 0, 0, 0, 0, 0, 1, 96, 0,
+    0, 0, 7, 0, 0, 0, 0, 59, 146, 147, 7, 49, 50, 0, 0, 7,
+    49, 50, 54, 65, 54, 65, 0, 0, 59, 146, 147, 7, 49, 50, 0, 0,
+    7, 49, 50, 54, 65, 54, 65, 0, 0, 0, 0, 0, 13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0,
+};
+
+// 到达该状态时命中的最高优先级规则（已合并失配链），没有时为TEXT_COMMAND_NO_RULE
+const uint8_t TEXT_COMMAND_OUTPUT[] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x05, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x06,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0xFF, 0x08, 0xFF, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x09, 0xFF, 0x0A, 0xFF, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+};
+
+// 原始关键字表，供主机端基准程序对照
+const char* const TEXT_COMMAND_KEYWORDS[] = {
+    "亮灯",
+    "开灯",
+    "点亮",
+    "关灯",
+    "熄灭",
+    "关闭",
+    "LED状态",
+    "灯状态",
+    "前进",
+    "向前",
+    "走前",
+    "后退",
+    "向后",
+    "倒退",
+    "站立",
+    "站起",
+    "起立",
+    "停止",
+    "停下",
+    "不动",
+    "左腿前",
+    "左脚前",
+    "左腿后",
+    "左脚后",
+    "右腿前",
+    "右脚前",
+    "右腿后",
+    "右脚后",
+    "舵机状态",
+    "腿部状态",
+};
+const uint8_t TEXT_COMMAND_KEYWORD_RULES[] = {
+    0, 0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5,
+    5, 6, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+};
+const uint8_t TEXT_COMMAND_KEYWORD_COUNT = 30;
+
+#endif
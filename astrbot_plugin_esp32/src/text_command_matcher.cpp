@@ -0,0 +1,32 @@
+#include "text_command_matcher.h"
+
+// 查找状态state在字节byte上的转移，没有时返回-1；每个状态只有几条边，线性查找即可
+static int findEdge(TextCommandState state, uint8_t byte) {
+    for (uint16_t i = TEXT_COMMAND_EDGE_START[state]; i < TEXT_COMMAND_EDGE_START[state + 1]; i++) {
+        if (TEXT_COMMAND_EDGE_BYTES[i] == byte) {
+            return TEXT_COMMAND_EDGE_TARGETS[i];
+        }
+    }
+    return -1;
+}
+
+uint8_t matchTextCommand(const char* text, size_t length) {
+    TextCommandState state = 0;
+    uint8_t best = TEXT_COMMAND_NO_RULE;
+    
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = (uint8_t)text[i];
+        int next = -1;
+        while (state != 0 && (next = findEdge(state, byte)) < 0) {
+            state = TEXT_COMMAND_FAIL[state];
+        }
+        state = next >= 0 ? (TextCommandState)next : TEXT_COMMAND_ROOT[byte];
+        
+        uint8_t rule = TEXT_COMMAND_OUTPUT[state];
+        if (rule < best) {
+            best = rule;
+            if (best == 0) break;  // 已命中最高优先级规则
+        }
+    }
+    return best;
+}
@@ -0,0 +1,11 @@
+#ifndef TEXT_COMMAND_MATCHER_H
+#define TEXT_COMMAND_MATCHER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "text_command_automaton.h"
+
+// 单次扫描匹配文本命令关键字，返回命中的最高优先级规则序号，没有命中时返回TEXT_COMMAND_NO_RULE
+uint8_t matchTextCommand(const char* text, size_t length);
+
+#endif
@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include <ESP32Servo.h>
+#include "gait_tables.h"
 
 // 舵机对象定义
 Servo servoLeft;   // 引脚39的舵机（左腿）
@@ -36,36 +37,15 @@ void setup() {
 }
 
 void loop() {
-    // 四足前进步态
+    // 四足前进步态，与ServoController共用同一份关键帧表
     Serial.println("开始前进...");
     
-    // 第一步：右腿前进(0-90度)，左腿后退(90-0度)
-    Serial.println("右腿前进，左腿后退");
-    servoRight.write(45);   // 右腿前进到中间位置
-    servoLeft.write(45);    // 左腿后退到中间位置
-    delay(500);
-    
-    // 第二步：右腿继续前进，左腿继续后退
-    servoRight.write(30);   // 右腿更多前进
-    servoLeft.write(30);    // 左腿更多后退
-    delay(500);
-    
-    // 第三步：切换方向 - 右腿后退(90-180度)，左腿前进(90-180度)
-    Serial.println("右腿后退，左腿前进");
-    servoRight.write(120);  // 右腿开始后退
-    servoLeft.write(120);   // 左腿开始前进
-    delay(500);
-    
-    // 第四步：右腿继续后退，左腿继续前进
-    servoRight.write(150);  // 右腿更多后退
-    servoLeft.write(150);   // 左腿更多前进
-    delay(500);
-    
-    // 回到中间位置准备下一个循环
-    Serial.println("回到中间位置");
-    servoRight.write(90);   // 右腿中间位置
-    servoLeft.write(90);    // 左腿中间位置
-    delay(500);
+    for (uint8_t i = 0; i < GAIT_WALK_FORWARD.frameCount; i++) {
+        const GaitKeyframe& frame = GAIT_WALK_FORWARD.frames[i];
+        servoRight.write(frame.rightAngle);
+        servoLeft.write(frame.leftAngle);
+        delay(frame.durationMs);
+    }
     
     Serial.println("一个步态循环完成");
     delay(1000);
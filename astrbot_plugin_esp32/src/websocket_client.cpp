@@ -1,11 +1,18 @@
 #include "websocket_client.h"
+#include <stdarg.h>
+#include "binary_protocol.h"
+#include "config.h"
+#include "binary_log.h"
 
 WebSocketClientManager::WebSocketClientManager(String host, int port, String id, unsigned long interval)
-    : serverHost(host), serverPort(port), deviceId(id), heartbeatInterval(interval),
-      lastHeartbeat(0), messageCallback(nullptr), connectionCallback(nullptr) {
+    : serverHost(host), serverPort(port), deviceId(id), wifiSsid(nullptr), wifiPassword(nullptr),
+      state(ConnectionState::WifiConnecting), stateSince(0), retryAt(0), wifiAttempts(0), wsAttempts(0),
+      lastHeartbeat(0), heartbeatInterval(interval), outboundHead(0), outboundCount(0), outboundDropped(0),
+      metricsCursor(METRICS_REPORT_PARTS), metricsResetAfter(false), metricsReportId(0), pollStartedAt(0),
+      messageCallback(nullptr), connectionCallback(nullptr) {
 }
 
-void WebSocketClientManager::setMessageCallback(void (*callback)(String)) {
+void WebSocketClientManager::setMessageCallback(void (*callback)(const char*, size_t, bool)) {
     messageCallback = callback;
 }
 
@@ -13,7 +20,10 @@ void WebSocketClientManager::setConnectionCallback(void (*callback)(bool)) {
     connectionCallback = callback;
 }
 
-void WebSocketClientManager::begin() {
+void WebSocketClientManager::begin(const char* ssid, const char* password) {
+    wifiSsid = ssid;
+    wifiPassword = password;
+    
     // 设置WebSocket事件回调
     client.onMessage([this](websockets::WebsocketsMessage message) {
         this->onMessage(message);
@@ -23,114 +33,487 @@ void WebSocketClientManager::begin() {
         this->onEvent(event, data);
     });
     
-    // 首次连接
-    reconnect();
+    // 首次连接由状态机在loop()中完成
+    startWifi();
 }
 
 void WebSocketClientManager::loop() {
-    client.poll();
-    
-    // 检查连接状态，如果断开则重连
-    if (!client.available()) {
-        Serial.println("WebSocket连接断开，尝试重连...");
-        reconnect();
-        return;
-    }
+    unsigned long now = millis();
+    bool wifiUp = WiFi.status() == WL_CONNECTED;
     
-    // 定期发送心跳
-    if (millis() - lastHeartbeat > heartbeatInterval) {
-        sendHeartbeat();
-        lastHeartbeat = millis();
+    switch (state) {
+        case ConnectionState::WifiConnecting:
+            if (wifiUp) {
+                LOG(WIFI_CONNECTED, WiFi.localIP().toString());
+                wifiAttempts = 0;
+                retryAt = now;
+                setState(ConnectionState::WebSocketBackoff);
+            } else if (now - stateSince > WIFI_CONNECT_TIMEOUT) {
+                WiFi.disconnect();
+                retryAt = now + nextBackoff(wifiAttempts);
+                LOG(WIFI_TIMEOUT, (uint32_t)(retryAt - now));
+                setState(ConnectionState::WifiBackoff);
+            }
+            break;
+            
+        case ConnectionState::WifiBackoff:
+            if (wifiUp) {
+                retryAt = now;
+                setState(ConnectionState::WebSocketBackoff);
+            } else if ((long)(now - retryAt) >= 0) {
+                startWifi();
+            }
+            break;
+            
+        case ConnectionState::WebSocketBackoff:
+            if (!wifiUp) {
+                LOG(WIFI_LOST);
+                startWifi();
+            } else if ((long)(now - retryAt) >= 0) {
+                connectWebSocket();
+            }
+            break;
+            
+        case ConnectionState::Connected:
+            pollStartedAt = ESP.getCycleCount();
+            client.poll();
+            if (!wifiUp || !client.available()) {
+                handleDisconnected();
+                if (!wifiUp) {
+                    LOG(WIFI_LOST);
+                    startWifi();
+                }
+                break;
+            }
+            
+            // 定期发送心跳
+            if (now - lastHeartbeat > heartbeatInterval) {
+                sendHeartbeat();
+                lastHeartbeat = now;
+#if METRICS_IN_HEARTBEAT
+                sendMetricsReport(false);
+#endif
+            }
+            
+            pumpMetricsReport();
+            
+            // 平滑发送：每次最多发出固定数量的排队帧
+            drainOutbound(OUTBOUND_DRAIN_PER_LOOP);
+            break;
     }
 }
 
 bool WebSocketClientManager::isConnected() {
-    return client.available();
+    return state == ConnectionState::Connected && client.available();
+}
+
+ConnectionState WebSocketClientManager::getConnectionState() const {
+    return state;
+}
+
+unsigned long WebSocketClientManager::getTimeInState() const {
+    return millis() - stateSince;
 }
 
-void WebSocketClientManager::sendMessage(String message) {
-    if (client.available()) {
-        client.send(message);
+void WebSocketClientManager::setState(ConnectionState newState) {
+    state = newState;
+    stateSince = millis();
+}
+
+void WebSocketClientManager::startWifi() {
+    LOG(WIFI_CONNECTING);
+    WiFi.begin(wifiSsid, wifiPassword);
+    setState(ConnectionState::WifiConnecting);
+}
+
+void WebSocketClientManager::connectWebSocket() {
+    String websocket_url = "ws://" + serverHost + ":" + String(serverPort) + "/";
+    LOG(WS_CONNECTING, websocket_url);
+    
+    // TCP握手本身仍是同步的（库没有提供连接超时，停顿时长见README的已知限制），但失败后不再原地等待，而是进入退避状态
+    if (client.connect(websocket_url)) {
+        LOG(WS_CONNECTED);
+        wsAttempts = 0;
+        setState(ConnectionState::Connected);
+        handleConnected();
     } else {
-        Serial.println("WebSocket未连接，无法发送消息");
+        unsigned long now = millis();
+        retryAt = now + nextBackoff(wsAttempts);
+        LOG(WS_CONNECT_FAILED, (uint32_t)(retryAt - now));
+        setState(ConnectionState::WebSocketBackoff);
     }
 }
 
-void WebSocketClientManager::sendStatusUpdate(String status) {
-    JsonDocument doc;
-    doc["type"] = "status";
-    doc["status"] = status;
-    doc["device_id"] = deviceId;
-    doc["timestamp"] = millis();
-    
-    String message;
-    serializeJson(doc, message);
+unsigned long WebSocketClientManager::nextBackoff(uint8_t& attempts) {
+    // 指数退避加随机抖动：取[delay/2, delay]之间的随机值，避免多台设备同时重连
+    unsigned long delayMs = BACKOFF_BASE << (attempts < 6 ? attempts : 6);
+    if (delayMs > BACKOFF_MAX) delayMs = BACKOFF_MAX;
+    if (attempts < 255) attempts++;
+    return delayMs / 2 + random(delayMs / 2 + 1);
+}
+
+void WebSocketClientManager::sendMessage(const String& message) {
+    if (!enqueueFrame(FrameKind::Message, StatusTopic::None, message.c_str(), message.length())) {
+        LOG(FRAME_DROPPED, "message");
+    }
+}
+
+void WebSocketClientManager::sendStatusUpdate(const char* status, StatusTopic topic) {
+    MetricProbe probe(MetricStage::StatusSerialize);
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "status");
+    writer.field("status", status);
+    writer.field("device_id", deviceId.c_str());
+    writer.field("timestamp", (uint32_t)millis());
+    writer.endObject();
     
-    if (client.available()) {
-        client.send(message);
-        Serial.println("发送状态更新: " + status);
+    if (enqueueFrame(FrameKind::Status, topic, writer)) {
+        LOG(STATUS_QUEUED, status);
     } else {
-        Serial.println("WebSocket未连接，无法发送状态更新");
+        LOG(STATUS_DROPPED, status);
     }
 }
 
+void WebSocketClientManager::sendStatusUpdatef(StatusTopic topic, const char* format, ...) {
+    // 格式化到栈上的定长缓冲区，超长时按UTF-8字符边界截断
+    char status[STATUS_TEXT_SIZE];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(status, sizeof(status), format, args);
+    va_end(args);
+    if (written >= (int)sizeof(status)) {
+        utf8TrimPartial(status);
+    }
+    sendStatusUpdate(status, topic);
+}
+
 void WebSocketClientManager::sendHeartbeat() {
-    JsonDocument doc;
-    doc["type"] = "heartbeat";
-    doc["device_id"] = deviceId;
-    doc["timestamp"] = millis();
+    MetricProbe probe(MetricStage::StatusSerialize);
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "heartbeat");
+    writer.field("device_id", deviceId.c_str());
+    writer.field("timestamp", (uint32_t)millis());
+    writer.endObject();
+    
+    if (!enqueueFrame(FrameKind::Heartbeat, StatusTopic::None, writer)) {
+        LOG(FRAME_DROPPED, "heartbeat");
+    }
+}
+
+void WebSocketClientManager::sendLatencyReport(const LatencySample& sample) {
+    // hold_us为设备从收到命令到发出本报告的时间，服务器用往返时间减去它估算单程网络延迟
+    MetricProbe probe(MetricStage::StatusSerialize);
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "latency");
+    writer.field("device_id", deviceId.c_str());
+    writer.field("t0", sample.t0);
+    writer.field("action", (uint32_t)sample.action);
+    writer.field("queue_us", sample.queueUs);
+    writer.field("exec_us", sample.executeUs);
+    writer.field("output_us", (int32_t)sample.outputUs);
+    writer.field("hold_us", (uint32_t)(micros() - sample.receivedAt));
+    writer.endObject();
     
-    String message;
-    serializeJson(doc, message);
+    // 每条结果都要送达，不参与状态合并
+    if (!enqueueFrame(FrameKind::Message, StatusTopic::None, writer)) {
+        LOG(FRAME_DROPPED, "latency");
+    }
+}
+
+void WebSocketClientManager::sendMetricsReport(bool resetAfter) {
+    // 新请求覆盖尚未发完的报告，从头开始
+    metricsReportId++;
+    metricsCursor = 0;
+    metricsResetAfter = resetAfter;
+}
+
+void WebSocketClientManager::pumpMetricsReport() {
+    // 始终给其他帧留出一个空位，报告不会挤掉排队中的状态
+    while (metricsCursor < METRICS_REPORT_PARTS && outboundCount + 1 < OUTBOUND_QUEUE_SIZE) {
+        writeMetricsFrame(metricsCursor++);
+    }
+    if (metricsCursor == METRICS_REPORT_PARTS && metricsResetAfter) {
+        metricsReset();
+        metricsResetAfter = false;
+    }
+}
+
+void WebSocketClientManager::writeMetricsFrame(uint8_t part) {
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "metrics");
+    writer.field("device_id", deviceId.c_str());
+    writer.field("report", metricsReportId);
+    writer.field("parts", (uint32_t)METRICS_REPORT_PARTS);
     
-    if (client.available()) {
-        client.send(message);
-        // 心跳发送，静默处理
+    if (part == 0) {
+        HeapMetrics heap = metricsHeap();
+        writer.field("part", "heap");
+        writer.field("free", heap.freeBytes);
+        writer.field("min_free", heap.minFreeBytes);
+        writer.field("max_alloc", heap.maxAllocBytes);
+        writer.field("min_max_alloc", heap.minMaxAllocBytes);
+        writer.field("arena", heap.arenaBytes);
+        writer.field("arena_peak", heap.arenaPeakBytes);
+        writer.field("arena_overflows", heap.arenaOverflows);
+        ServoWriteMetrics servo = metricsServoWrites();
+        writer.field("servo_writes", servo.executed);
+        writer.field("servo_suppressed", servo.suppressed);
+        writer.field("servo_slew_limited", servo.slewLimited);
+        writer.field("dropped_frames", outboundDropped);
+        writer.field("timestamp", (uint32_t)millis());
     } else {
-        Serial.println("WebSocket未连接，无法发送心跳");
+        MetricStage stage = static_cast<MetricStage>(part - 1);
+        const LatencyHistogram& histogram = metricsHistogram(stage);
+        writer.field("part", "stage");
+        writer.field("stage", metricStageName(stage));
+        writer.field("count", histogram.getCount());
+        writer.field("max_us", histogram.getMaxUs());
+        // 去掉末尾的空桶，第i个元素对应[2^(i-1), 2^i)微秒
+        uint8_t used = LatencyHistogram::BUCKETS;
+        while (used > 0 && histogram.getBucket(used - 1) == 0) used--;
+        writer.beginArray("hist");
+        for (uint8_t i = 0; i < used; i++) {
+            writer.element(histogram.getBucket(i));
+        }
+        writer.endArray();
+    }
+    writer.endObject();
+    
+    if (!enqueueFrame(FrameKind::Message, StatusTopic::None, writer)) {
+        LOG(FRAME_DROPPED, "metrics");
     }
 }
 
-void WebSocketClientManager::onMessage(websockets::WebsocketsMessage message) {
-    Serial.printf("收到消息: %s\n", message.data().c_str());
+void WebSocketClientManager::sendCommandAck(uint32_t seq, AckState state, const char* reason, const char* status) {
+    static const char* const STATE_NAMES[] = {"accepted", "completed", "rejected", "started", "queued"};
+    
+    MetricProbe probe(MetricStage::StatusSerialize);
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "ack");
+    writer.field("device_id", deviceId.c_str());
+    writer.field("seq", seq);
+    writer.field("state", STATE_NAMES[(uint8_t)state]);
+    if (reason) writer.field("reason", reason);
+    if (status && status[0]) writer.field("status", status);
+    writer.endObject();
+    
+    // 尚未发出的accepted/started/queued会被同一序号的completed替换，队列紧张时每条命令只占一帧
+    if (!enqueueFrame(FrameKind::Ack, StatusTopic::None, writer, false, seq)) {
+        LOG(ACK_DROPPED, seq, STATE_NAMES[(uint8_t)state]);
+    }
+}
+
+uint8_t WebSocketClientManager::getQueuedFrameCount() const {
+    return outboundCount;
+}
+
+uint32_t WebSocketClientManager::getDroppedFrameCount() const {
+    return outboundDropped;
+}
+
+bool WebSocketClientManager::enqueueFrame(FrameKind kind, StatusTopic topic, const JsonFrameWriter& writer, bool atFront, uint32_t seq) {
+    if (writer.overflowed()) {
+        LOG(FRAME_OVERFLOW);
+        return false;
+    }
+    return enqueueFrame(kind, topic, writer.c_str(), writer.size(), atFront, seq);
+}
+
+bool WebSocketClientManager::enqueueFrame(FrameKind kind, StatusTopic topic, const char* data, size_t length, bool atFront, uint32_t seq) {
+    if (length >= OUTBOUND_FRAME_SIZE) {
+        LOG(FRAME_TOO_LARGE);
+        return false;
+    }
+    
+    // 合并：心跳只保留最新一条；同一子系统的状态用新内容替换尚未发出的旧状态；同一命令的回执只保留最新状态
+    OutboundFrame* slot = nullptr;
+    for (uint8_t i = 0; i < outboundCount; i++) {
+        OutboundFrame& queued = outbound[(outboundHead + i) % OUTBOUND_QUEUE_SIZE];
+        if (queued.kind != kind) continue;
+        if (kind == FrameKind::Heartbeat ||
+            (kind == FrameKind::Status && topic != StatusTopic::None && queued.topic == topic) ||
+            (kind == FrameKind::Ack && queued.seq == seq)) {
+            slot = &queued;
+            break;
+        }
+    }
+    
+    if (!slot) {
+        // 队列已满时先挤掉不如新帧重要的旧帧；全是更重要的帧时丢弃新帧本身，同样计入丢帧数，由调用者记录丢了什么
+        if (outboundCount == OUTBOUND_QUEUE_SIZE && evictFrame(kind) == 0) {
+            outboundDropped++;
+            return false;
+        }
+        if (atFront) {
+            outboundHead = (outboundHead + OUTBOUND_QUEUE_SIZE - 1) % OUTBOUND_QUEUE_SIZE;
+            slot = &outbound[outboundHead];
+        } else {
+            slot = &outbound[(outboundHead + outboundCount) % OUTBOUND_QUEUE_SIZE];
+        }
+        outboundCount++;
+    }
+    
+    slot->kind = kind;
+    slot->topic = topic;
+    slot->seq = seq;
+    slot->length = length;
+    memcpy(slot->data, data, length);
+    return true;
+}
+
+// 出站帧的重要性：心跳和状态都会被更新的内容取代，延迟和指标丢了只影响统计，回执丢了服务器只能按超时处理
+static uint8_t framePriority(FrameKind kind) {
+    switch (kind) {
+        case FrameKind::Heartbeat: return 0;
+        case FrameKind::Status:    return 1;
+        case FrameKind::Message:   return 2;
+        case FrameKind::Ack:       return 3;
+    }
+    return 0;
+}
+
+// 丢弃重要性最低的帧中最旧的一帧，只考虑不比incoming更重要的帧；返回丢弃的字节数，没有可丢的帧时返回0
+size_t WebSocketClientManager::evictFrame(FrameKind incoming) {
+    uint8_t lowest = framePriority(incoming) + 1;
+    uint8_t victim = outboundCount;
+    for (uint8_t i = 0; i < outboundCount; i++) {
+        uint8_t priority = framePriority(outbound[(outboundHead + i) % OUTBOUND_QUEUE_SIZE].kind);
+        if (priority < lowest) {
+            lowest = priority;
+            victim = i;
+        }
+    }
+    if (victim == outboundCount) {
+        return 0;
+    }
+    
+    // 后面的帧依次前移一格，发送顺序不变
+    size_t length = outbound[(outboundHead + victim) % OUTBOUND_QUEUE_SIZE].length;
+    for (uint8_t i = victim; i + 1 < outboundCount; i++) {
+        outbound[(outboundHead + i) % OUTBOUND_QUEUE_SIZE] = outbound[(outboundHead + i + 1) % OUTBOUND_QUEUE_SIZE];
+    }
+    outboundCount--;
+    outboundDropped++;
+    return length;
+}
+
+void WebSocketClientManager::drainOutbound(uint8_t maxFrames) {
+    while (maxFrames > 0 && outboundCount > 0 && client.available()) {
+        OutboundFrame& frame = outbound[outboundHead];
+        bool sent;
+        {
+            MetricProbe probe(MetricStage::StatusSend);
+            sent = client.send(frame.data, frame.length);
+        }
+        if (!sent) {
+            // 发送失败时保留在队列中，等待重连后补发
+            break;
+        }
+        outboundHead = (outboundHead + 1) % OUTBOUND_QUEUE_SIZE;
+        outboundCount--;
+        maxFrames--;
+    }
+}
+
+void WebSocketClientManager::trimForReplay() {
+    // 断线期间排队的心跳已经过时，不再补发
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < outboundCount; i++) {
+        const OutboundFrame& frame = outbound[(outboundHead + i) % OUTBOUND_QUEUE_SIZE];
+        if (frame.kind == FrameKind::Heartbeat) continue;
+        OutboundFrame& target = outbound[(outboundHead + kept) % OUTBOUND_QUEUE_SIZE];
+        if (&target != &frame) target = frame;
+        kept++;
+    }
+    outboundDropped += outboundCount - kept;
+    outboundCount = kept;
+    
+    // 超出补发字节上限时，按重要性从低到高、同类从最旧的帧开始丢弃，回执最后才丢
+    size_t total = 0;
+    for (uint8_t i = 0; i < outboundCount; i++) {
+        total += outbound[(outboundHead + i) % OUTBOUND_QUEUE_SIZE].length;
+    }
+    while (outboundCount > 0 && total > OUTBOUND_REPLAY_MAX_BYTES) {
+        total -= evictFrame(FrameKind::Ack);
+    }
+    
+    if (outboundCount > 0) {
+        LOG(WS_REPLAY, outboundCount, (uint32_t)total);
+    }
+}
+
+void WebSocketClientManager::onMessage(const websockets::WebsocketsMessage& message) {
+    // 直接使用库内部的接收缓冲区，不再复制成String
+    const std::string& payload = message.rawData();
+    metricsRecordCycles(MetricStage::FrameReceive, ESP.getCycleCount() - pollStartedAt);
+    
+    bool binary = message.isBinary();
+    
+    if (binary) {
+        LOG(WS_BINARY_RECEIVED, payload.size());
+    } else {
+        // 日志只保留消息开头LOG_MAX_STRING字节
+        LOG(WS_TEXT_RECEIVED, payload.size(), payload.c_str());
+    }
     
     if (messageCallback) {
-        messageCallback(message.data());
+        messageCallback(payload.c_str(), payload.size(), binary);
     }
+    
+    // 同一次poll()中的下一条消息从这里开始计算接收耗时
+    pollStartedAt = ESP.getCycleCount();
 }
 
 void WebSocketClientManager::onEvent(websockets::WebsocketsEvent event, String data) {
     if (event == websockets::WebsocketsEvent::ConnectionOpened) {
-        Serial.println("WebSocket连接已建立");
-        if (connectionCallback) {
-            connectionCallback(true);
-        }
-        sendStatusUpdate("connected");
+        // 连接状态的变化统一由状态机处理，避免重复通知
+        LOG(WS_EVENT_OPENED);
     } else if (event == websockets::WebsocketsEvent::ConnectionClosed) {
-        Serial.println("WebSocket连接已关闭");
-        if (connectionCallback) {
-            connectionCallback(false);
-        }
+        LOG(WS_EVENT_CLOSED);
     } else if (event == websockets::WebsocketsEvent::GotPing) {
-        Serial.println("收到Ping");
+        LOG(WS_GOT_PING);
     } else if (event == websockets::WebsocketsEvent::GotPong) {
-        Serial.println("收到Pong");
+        LOG(WS_GOT_PONG);
     }
 }
 
-void WebSocketClientManager::reconnect() {
-    String websocket_url = "ws://" + serverHost + ":" + String(serverPort) + "/";
-    Serial.println("正在连接到AstrBot WebSocket服务器: " + websocket_url);
+void WebSocketClientManager::handleConnected() {
+    if (connectionCallback) {
+        connectionCallback(true);
+    }
     
-    bool connected = client.connect(websocket_url);
-    if(connected) {
-        Serial.println("WebSocket连接成功!");
-        if (connectionCallback) {
-            connectionCallback(true);
-        }
-        sendStatusUpdate("connected");
-    } else {
-        Serial.println("WebSocket连接失败，5秒后再试...");
-        delay(5000);
+    // 先整理断线期间积压的帧，再把connected状态放到队首优先发出
+    trimForReplay();
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "status");
+    writer.field("status", "connected");
+    writer.field("device_id", deviceId.c_str());
+    // 声明设备支持的命令编码，服务器据此选择发送JSON还是二进制帧
+    writer.rawField("encodings", "[\"json\",\"" BINARY_ENCODING_NAME "\"]");
+    // 带seq的命令会收到ack回执
+    writer.field("acks", true);
+    writer.field("timestamp", (uint32_t)millis());
+    writer.endObject();
+    if (!enqueueFrame(FrameKind::Status, StatusTopic::None, writer, true)) {
+        LOG(FRAME_DROPPED, "connected");
+    }
+}
+
+void WebSocketClientManager::handleDisconnected() {
+    LOG(WS_DISCONNECTED);
+    client.close();
+    if (connectionCallback) {
+        connectionCallback(false);
     }
+    
+    // 首次重连等待很短，之后按指数退避
+    unsigned long now = millis();
+    retryAt = now + nextBackoff(wsAttempts);
+    setState(ConnectionState::WebSocketBackoff);
 }
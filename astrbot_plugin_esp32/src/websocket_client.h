@@ -2,37 +2,119 @@
 #define WEBSOCKET_CLIENT_H
 
 #include <Arduino.h>
+#include <WiFi.h>
 #include <ArduinoWebsockets.h>
 #include <ArduinoJson.h>
+#include "json_writer.h"
+#include "command.h"
+#include "metrics.h"
+
+// WiFi与WebSocket的统一连接状态
+enum class ConnectionState : uint8_t {
+    WifiConnecting,    // 已调用WiFi.begin()，等待连接
+    WifiBackoff,       // WiFi连接超时，退避等待下一次尝试
+    WebSocketBackoff,  // WiFi已连接，等待下一次WebSocket连接尝试
+    Connected          // WebSocket已连接
+};
+
+// 出站帧类型；队列满时按心跳、状态、消息、回执的顺序丢弃
+enum class FrameKind : uint8_t {
+    Message,
+    Status,
+    Heartbeat,
+    Ack        // 命令回执，同一序号只保留最新的一条
+};
 
 class WebSocketClientManager {
+public:
+    static const size_t OUTBOUND_FRAME_SIZE = 384;         // 单个出站帧最大字节数
+    static const uint8_t OUTBOUND_QUEUE_SIZE = 8;          // 出站队列容量（帧）
+    static const uint8_t OUTBOUND_DRAIN_PER_LOOP = 2;      // 每次loop()最多发送的帧数
+    static const size_t OUTBOUND_REPLAY_MAX_BYTES = 2048;  // 重连后最多补发的字节数
+    static const unsigned long WIFI_CONNECT_TIMEOUT = 15000;  // 单次WiFi连接等待上限（毫秒）
+    static const unsigned long BACKOFF_BASE = 500;            // 退避基准时间（毫秒）
+    static const unsigned long BACKOFF_MAX = 30000;           // 退避上限（毫秒）
+    
 private:
+    struct OutboundFrame {
+        FrameKind kind;
+        StatusTopic topic;
+        uint32_t seq;  // 仅Ack帧使用
+        uint16_t length;
+        char data[OUTBOUND_FRAME_SIZE];
+    };
+    
+
     websockets::WebsocketsClient client;
     String serverHost;
     int serverPort;
     String deviceId;
+    const char* wifiSsid;
+    const char* wifiPassword;
+    
+    // 连接状态机：任何状态下都不阻塞，loop()每次只推进一步
+    ConnectionState state;
+    unsigned long stateSince;
+    unsigned long retryAt;
+    uint8_t wifiAttempts;
+    uint8_t wsAttempts;
     unsigned long lastHeartbeat;
     unsigned long heartbeatInterval;
+    char frameBuffer[OUTBOUND_FRAME_SIZE];  // 状态/心跳帧复用的预分配缓冲区
+    
+    // 定长出站环形队列：断线期间保留，重连后按顺序补发
+    OutboundFrame outbound[OUTBOUND_QUEUE_SIZE];
+    uint8_t outboundHead;
+    uint8_t outboundCount;
+    uint32_t outboundDropped;
+    
+    // 指标报告按部分分帧：第0部分为堆内存，之后每个阶段一帧；出站队列有空位时才生成下一帧
+    static const uint8_t METRICS_REPORT_PARTS = 1 + (uint8_t)MetricStage::Count;
+    uint8_t metricsCursor;     // 下一帧要生成的部分，等于METRICS_REPORT_PARTS表示没有进行中的报告
+    bool metricsResetAfter;    // 报告发完后清空直方图
+    uint32_t metricsReportId;  // 同一份报告的各帧带相同的编号
+    uint32_t pollStartedAt;    // 本次poll()开始（或上一条消息处理完）时的周期计数
     
     // 回调函数指针
-    void (*messageCallback)(String message);
+    void (*messageCallback)(const char* data, size_t length, bool binary);
     void (*connectionCallback)(bool connected);
 
 public:
     WebSocketClientManager(String host, int port, String id, unsigned long interval = 30000);
-    void setMessageCallback(void (*callback)(String));
+    void setMessageCallback(void (*callback)(const char*, size_t, bool));
     void setConnectionCallback(void (*callback)(bool));
-    void begin();
+    void begin(const char* ssid, const char* password);
     void loop();
     bool isConnected();
-    void sendMessage(String message);
-    void sendStatusUpdate(String status);
+    ConnectionState getConnectionState() const;
+    unsigned long getTimeInState() const;  // 进入当前连接状态后经过的毫秒数
+    void sendMessage(const String& message);
+    void sendStatusUpdate(const char* status, StatusTopic topic = StatusTopic::None);
+    void sendStatusUpdatef(StatusTopic topic, const char* format, ...) __attribute__((format(printf, 3, 4)));
     void sendHeartbeat();
+    void sendLatencyReport(const LatencySample& sample);
+    void sendMetricsReport(bool resetAfter);
+    void sendCommandAck(uint32_t seq, AckState state, const char* reason = nullptr, const char* status = nullptr);
+    uint8_t getQueuedFrameCount() const;
+    uint32_t getDroppedFrameCount() const;
     
 private:
-    void onMessage(websockets::WebsocketsMessage message);
+    void onMessage(const websockets::WebsocketsMessage& message);
     void onEvent(websockets::WebsocketsEvent event, String data);
-    void reconnect();
+    void setState(ConnectionState newState);
+    void startWifi();
+    void connectWebSocket();
+    unsigned long nextBackoff(uint8_t& attempts);
+    void handleConnected();
+    void handleDisconnected();
+    // 帧没有进入队列（超出帧大小、写入溢出，或队列已满且没有可挤掉的帧）时返回false
+    bool enqueueFrame(FrameKind kind, StatusTopic topic, const char* data, size_t length, bool atFront = false, uint32_t seq = 0);
+    bool enqueueFrame(FrameKind kind, StatusTopic topic, const JsonFrameWriter& writer, bool atFront = false, uint32_t seq = 0);
+    void drainOutbound(uint8_t maxFrames);
+    void trimForReplay();
+    size_t evictFrame(FrameKind incoming);
+    void pumpMetricsReport();
+    void writeMetricsFrame(uint8_t part);
 };
 
 #endif
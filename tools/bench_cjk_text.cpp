@@ -0,0 +1,122 @@
+// 中文文本显示基准：用实际字库（cjk_font.h）在主机上绘制一条40字的回复，
+// 报告字库占用的flash、文本显示占用的RAM，以及冷缓存（首次显示）和热缓存（再次显示）的绘制耗时
+// 耗时只覆盖排版和绘制到帧缓冲区，不含I2C刷新；主机上的数值只用于比较，设备上的实际耗时在LOG_LEVEL设为DEBUG后见OLED_TEXT_RENDERED日志
+//
+// 构建并运行（在仓库根目录）:
+//   g++ -O2 -std=gnu++11 -I astrbot_plugin_esp32/host -I astrbot_plugin_esp32/src tools/bench_cjk_text.cpp \
+//       astrbot_plugin_esp32/src/glyph_cache.cpp -o bench_cjk_text && ./bench_cjk_text
+//   加 --dump 参数时以字符画输出绘制结果，用于检查字形
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "glyph_cache.h"
+
+static const int SCREEN_W = 128;
+static const int SCREEN_H = 64;
+static const int LINE_HEIGHT = CJK_GLYPH_HEIGHT + 1;
+
+// 40个字符的回复，全部在字库中
+static const char* const REPLY = "好的，我已经把灯打开了，现在是蓝色，亮度百分之五十。今天天气很好，要不要出去走？";
+
+static uint8_t frame[SCREEN_W * SCREEN_H / 8];
+
+static void drawHLine(int x, int y, int w) {
+    for (int i = x; i < x + w; i++) {
+        if (i >= 0 && i < SCREEN_W && y >= 0 && y < SCREEN_H) {
+            frame[(y / 8) * SCREEN_W + i] |= 1 << (y & 7);
+        }
+    }
+}
+
+// 与OledDisplay::layoutText()/drawGlyph()相同的排版和绘制：按行把连续像素合并成水平线段
+static int render(GlyphCache& cache, const char* text) {
+    memset(frame, 0, sizeof(frame));
+    int x = 0;
+    int y = 0;
+    int lines = 1;
+    const char* p = text;
+    while (*p) {
+        uint32_t codepoint = utf8Next(p);
+        int advance = codepoint < 0x80 ? 6 : CJK_GLYPH_WIDTH;
+        if (x + advance > SCREEN_W) {
+            x = 0;
+            y += LINE_HEIGHT;
+            lines++;
+        }
+        const uint16_t* rows = cache.lookup(codepoint);
+        if (rows) {
+            for (int row = 0; row < CJK_GLYPH_HEIGHT; row++) {
+                uint16_t bits = rows[row];
+                int col = 0;
+                while (bits) {
+                    while (!(bits & 0x8000)) {
+                        bits <<= 1;
+                        col++;
+                    }
+                    int run = 0;
+                    while (bits & 0x8000) {
+                        bits <<= 1;
+                        run++;
+                    }
+                    drawHLine(x + col, y + row, run);
+                    col += run;
+                }
+            }
+        }
+        x += advance;
+    }
+    return lines;
+}
+
+static void dump() {
+    for (int y = 0; y < SCREEN_H; y++) {
+        char line[SCREEN_W + 1];
+        for (int x = 0; x < SCREEN_W; x++) {
+            line[x] = (frame[(y / 8) * SCREEN_W + x] & (1 << (y & 7))) ? '#' : '.';
+        }
+        line[SCREEN_W] = '\0';
+        printf("%s\n", line);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* p = REPLY;
+    int chars = 0;
+    while (*p) {
+        utf8Next(p);
+        chars++;
+    }
+    
+    printf("字库: %u个字形, flash %u字节（字形%u + 码点%u）\n", (unsigned)CJK_GLYPH_COUNT,
+           (unsigned)(CJK_GLYPH_COUNT * (CJK_GLYPH_BYTES + 2)),
+           (unsigned)(CJK_GLYPH_COUNT * CJK_GLYPH_BYTES), (unsigned)(CJK_GLYPH_COUNT * 2));
+    printf("RAM: 字形缓存%u字节（%u个字形），帧缓冲区%u字节\n", (unsigned)sizeof(GlyphCache),
+           (unsigned)GlyphCache::CACHE_SIZE, (unsigned)sizeof(frame));
+    
+    // 冷缓存：每轮新建缓存，相当于开机后第一次显示
+    const int rounds = 2000;
+    int lines = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        GlyphCache cache;
+        lines = render(cache, REPLY);
+    }
+    double coldUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+    
+    GlyphCache cache;
+    render(cache, REPLY);
+    uint32_t misses = cache.getMisses();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        render(cache, REPLY);
+    }
+    double warmUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+    
+    printf("%d字回复: %d行, 解码%u个字形, 冷缓存%.1fus, 热缓存%.1fus\n", chars, lines, (unsigned)misses, coldUs, warmUs);
+    
+    if (argc > 1 && strcmp(argv[1], "--dump") == 0) {
+        dump();
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+// 命令解码基准：用固件自己的MessageHandler分别处理同一条命令的JSON文本和bin1帧，
+// 对比帧大小、从收到消息到命令进入命令队列的耗时，以及单独decodeBinaryCommand的耗时
+// 同时校验两种编码解出的命令一致（只比较执行器会读取的字段）
+// 帧内容与tools/codec_bench.py的SAMPLES相同，bin1帧由adapter/binary_protocol.py的encode_command生成，
+// JSON文本为json.dumps的输出（与adapter/main.py下发的格式一致）
+//
+// 构建并运行（在仓库根目录，需要真实的ArduinoJson 7，与tools/build_host.sh相同）:
+//   g++ -O2 -std=gnu++11 -pthread -I astrbot_plugin_esp32/host -I astrbot_plugin_esp32/src -I "$ARDUINOJSON_DIR"
+//       tools/bench_command_decode.cpp $(ls astrbot_plugin_esp32/src/*.cpp | grep -v -e main.cpp -e _test.cpp)
+//       $(ls astrbot_plugin_esp32/host/*.cpp | grep -v host_main.cpp) -o bench_command_decode && ./bench_command_decode
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "binary_protocol.h"
+#include "message_handler.h"
+
+enum class CompareFields : uint8_t {
+    Action,      // 只看动作
+    Brightness,  // LED亮度
+    Motion,      // 舵机角度、时长、曲线和步行参数
+    Text         // OLED文本
+};
+
+struct Sample {
+    const char* name;
+    CompareFields compare;
+    const char* json;
+    uint8_t frame[64];
+    size_t frameSize;
+};
+
+static const Sample SAMPLES[] = {
+    {"led_control/on", CompareFields::Brightness,
+     "{\"type\": \"led_control\", \"action\": \"on\", \"brightness\": 80, \"from_user\": \"\\u7528\\u6237\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x00, 0x00, 0x50, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00}, 14},
+    {"servo_control/walk_forward", CompareFields::Motion,
+     "{\"type\": \"servo_control\", \"action\": \"walk_forward\", \"from_user\": \"\\u7528\\u6237\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x04, 0x00, 0x64, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00}, 14},
+    {"servo_control/move_legs", CompareFields::Motion,
+     "{\"type\": \"servo_control\", \"action\": \"move_legs\", \"left_angle\": 45, \"right_angle\": 135, \"duration_ms\": 400, "
+     "\"profile\": \"min_jerk\", \"from_user\": \"\\u7528\\u6237\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x0C, 0x03, 0x64, 0x00, 0x2D, 0x00, 0x87, 0x00, 0x90, 0x01, 0x00, 0x00}, 14},
+    {"oled_control/emotion", CompareFields::Text,
+     "{\"type\": \"oled_control\", \"action\": \"emotion\", \"content\": \"happy\", \"from_user\": \"\\u7528\\u6237\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x10, 0x00, 0x64, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x61, 0x70, 0x70, 0x79}, 19},
+    {"oled_control/text", CompareFields::Text,
+     "{\"type\": \"oled_control\", \"action\": \"text\", \"content\": \"\\u4f60\\u597d\\uff0c\\u4eca\\u5929\\u5929\\u6c14\\u4e0d\\u9519\", "
+     "\"from_user\": \"\\u7528\\u6237\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x11, 0x00, 0x64, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xE4, 0xBD, 0xA0, 0xE5, 0xA5, 0xBD, 0xEF, 0xBC, 0x8C, 0xE4, 0xBB, 0x8A, 0xE5, 0xA4, 0xA9,
+      0xE5, 0xA4, 0xA9, 0xE6, 0xB0, 0x94, 0xE4, 0xB8, 0x8D, 0xE9, 0x94, 0x99}, 41},
+    {"custom_command/status", CompareFields::Action,
+     "{\"type\": \"custom_command\", \"command\": \"status\", \"from_user\": \"\\u7ba1\\u7406\\u5458\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x13, 0x00, 0x64, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00}, 14},
+    // 自定义命令只开灯：两种编码都必须解出LED_BRIGHTNESS_KEEP，不能把亮度重置为100%
+    {"custom_command/led_on", CompareFields::Brightness,
+     "{\"type\": \"custom_command\", \"command\": \"led_on\", \"from_user\": \"\\u7ba1\\u7406\\u5458\", \"timestamp\": 12345.678}",
+     {0xA5, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00}, 14},
+};
+
+static bool sameCommand(const Command& a, const Command& b, CompareFields compare) {
+    if (a.action != b.action) return false;
+    switch (compare) {
+        case CompareFields::Action:
+            return true;
+        case CompareFields::Brightness:
+            return a.brightness == b.brightness;
+        case CompareFields::Motion:
+            return a.profile == b.profile && a.leftAngle == b.leftAngle && a.rightAngle == b.rightAngle &&
+                   a.durationMs == b.durationMs && a.walkSteps == b.walkSteps && a.walkTempo == b.walkTempo &&
+                   a.walkFlags == b.walkFlags;
+        case CompareFields::Text:
+            return strcmp(a.text, b.text) == 0;
+    }
+    return false;
+}
+
+template <typename F>
+static double measureNs(int rounds, F decode) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        decode();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / rounds;
+}
+
+int main() {
+    const int rounds = 100000;
+    const size_t sampleCount = sizeof(SAMPLES) / sizeof(SAMPLES[0]);
+    
+    // 未连接的客户端：这些命令不带seq，处理过程中不会产生出站帧
+    static CommandQueue commandQueue;
+    static WebSocketClientManager wsClient(WEBSOCKET_SERVER, WEBSOCKET_PORT, DEVICE_ID, HEARTBEAT_INTERVAL);
+    static MessageHandler handler(&commandQueue, &wsClient);
+    Command command;
+    
+    int mismatches = 0;
+    size_t jsonBytesTotal = 0, binaryBytesTotal = 0;
+    double jsonNsTotal = 0, binaryNsTotal = 0, decodeNsTotal = 0;
+    printf("%-28s %6s %10s %10s %10s %10s %12s\n", "command", "match", "JSON B", "bin1 B", "JSON ns", "bin1 ns", "decode ns");
+    for (size_t i = 0; i < sampleCount; i++) {
+        const Sample& sample = SAMPLES[i];
+        size_t jsonSize = strlen(sample.json);
+        
+        Command fromJson = {}, fromBinary = {};
+        handler.handleMessage(sample.json, jsonSize);
+        bool jsonQueued = commandQueue.pop(fromJson);
+        handler.handleBinaryMessage(sample.frame, sample.frameSize);
+        bool binaryQueued = commandQueue.pop(fromBinary);
+        bool match = jsonQueued && binaryQueued && sameCommand(fromJson, fromBinary, sample.compare);
+        
+        double jsonNs = measureNs(rounds, [&] {
+            handler.handleMessage(sample.json, jsonSize);
+            commandQueue.pop(command);
+        });
+        double binaryNs = measureNs(rounds, [&] {
+            handler.handleBinaryMessage(sample.frame, sample.frameSize);
+            commandQueue.pop(command);
+        });
+        double decodeNs = measureNs(rounds, [&] {
+            decodeBinaryCommand(sample.frame, sample.frameSize, command);
+        });
+        
+        printf("%-28s %6s %10u %10u %10.0f %10.0f %12.0f\n", sample.name, match ? "ok" : "DIFF",
+               (unsigned)jsonSize, (unsigned)sample.frameSize, jsonNs, binaryNs, decodeNs);
+        if (!match) {
+            printf("  JSON%s入队（动作%u），bin1%s入队（动作%u）\n", jsonQueued ? "" : "未", (unsigned)fromJson.action,
+                   binaryQueued ? "" : "未", (unsigned)fromBinary.action);
+            mismatches++;
+        }
+        jsonBytesTotal += jsonSize;
+        binaryBytesTotal += sample.frameSize;
+        jsonNsTotal += jsonNs;
+        binaryNsTotal += binaryNs;
+        decodeNsTotal += decodeNs;
+    }
+    
+    printf("\n合计：JSON %u字节，bin1 %u字节（%.0f%%）\n", (unsigned)jsonBytesTotal, (unsigned)binaryBytesTotal,
+           100.0 * binaryBytesTotal / jsonBytesTotal);
+    printf("平均每条命令：JSON %.0f ns，bin1 %.0f ns（其中decodeBinaryCommand %.0f ns），快%.1f倍\n",
+           jsonNsTotal / sampleCount, binaryNsTotal / sampleCount, decodeNsTotal / sampleCount, jsonNsTotal / binaryNsTotal);
+    if (mismatches > 0) {
+        printf("%d条命令两种编码解出的结果不一致\n", mismatches);
+        return 1;
+    }
+    printf("全部%u条命令两种编码解出的结果一致\n", (unsigned)sampleCount);
+    return 0;
+}
@@ -0,0 +1,267 @@
+// 状态/心跳帧序列化基准：对比原先的String拼接 + JsonDocument + serializeJson到String，
+// 与现在的栈上格式化 + JsonFrameWriter写入预分配缓冲区，统计每条消息的堆分配次数、字节数和耗时
+// 同时校验两种方式生成的帧逐字节一致
+//
+// 堆统计通过替换malloc/calloc/realloc实现（转发到glibc的__libc_*），ArduinoJson和String都经由它们分配
+//
+// 构建并运行（在仓库根目录，ArduinoJson 7的src目录由ARDUINOJSON_DIR给出）:
+// 需要真实的ArduinoJson 7（与tools/build_host.sh相同），原先的方式完全依赖它的分配和序列化行为
+//   g++ -O2 -std=gnu++11 -pthread -I astrbot_plugin_esp32/host -I astrbot_plugin_esp32/src -I "$ARDUINOJSON_DIR"
+//       tools/bench_status_frames.cpp astrbot_plugin_esp32/src/json_writer.cpp
+//       astrbot_plugin_esp32/host/host_arduino.cpp astrbot_plugin_esp32/host/sim_trace.cpp
+//       -o bench_status_frames && ./bench_status_frames
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ArduinoJson.h>
+#include "config.h"
+#include "command.h"
+#include "json_writer.h"
+#include "websocket_client.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+}
+
+static bool heapCounting = false;
+static unsigned long heapAllocs = 0;
+static unsigned long heapBytes = 0;
+
+extern "C" void* malloc(size_t size) {
+    if (heapCounting) {
+        heapAllocs++;
+        heapBytes += size;
+    }
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    if (heapCounting) {
+        heapAllocs++;
+        heapBytes += count * size;
+    }
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+    if (heapCounting) {
+        heapAllocs++;
+        heapBytes += size;
+    }
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void* ptr) {
+    __libc_free(ptr);
+}
+
+static uint32_t timestamp = 123456;
+static volatile size_t sink = 0;
+
+// 原先的做法：状态文本按值传入，JsonDocument在堆上建树，再序列化到堆上的String
+static void oldStatusUpdate(String status) {
+    JsonDocument doc;
+    doc["type"] = "status";
+    doc["status"] = status;
+    doc["device_id"] = DEVICE_ID;
+    doc["timestamp"] = timestamp;
+    
+    String message;
+    serializeJson(doc, message);
+    sink += message.length();
+}
+
+static void oldHeartbeat() {
+    JsonDocument doc;
+    doc["type"] = "heartbeat";
+    doc["device_id"] = DEVICE_ID;
+    doc["timestamp"] = timestamp;
+    
+    String message;
+    serializeJson(doc, message);
+    sink += message.length();
+}
+
+// 现在的做法：与WebSocketClientManager::sendStatusUpdate/sendStatusUpdatef/sendHeartbeat相同
+static char frameBuffer[WebSocketClientManager::OUTBOUND_FRAME_SIZE];
+
+static void newStatusUpdate(const char* status) {
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "status");
+    writer.field("status", status);
+    writer.field("device_id", DEVICE_ID);
+    writer.field("timestamp", timestamp);
+    writer.endObject();
+    sink += writer.size();
+}
+
+static void newStatusUpdatef(const char* format, ...) {
+    char status[STATUS_TEXT_SIZE];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(status, sizeof(status), format, args);
+    va_end(args);
+    if (written >= (int)sizeof(status)) {
+        utf8TrimPartial(status);
+    }
+    newStatusUpdate(status);
+}
+
+static void newHeartbeat() {
+    JsonFrameWriter writer(frameBuffer, sizeof(frameBuffer));
+    writer.beginObject();
+    writer.field("type", "heartbeat");
+    writer.field("device_id", DEVICE_ID);
+    writer.field("timestamp", timestamp);
+    writer.endObject();
+    sink += writer.size();
+}
+
+struct Measurement {
+    double ns;
+    double cycles;
+    double allocs;
+    double bytes;
+};
+
+template <typename F>
+static Measurement measure(int rounds, F send) {
+    Measurement result;
+    heapAllocs = 0;
+    heapBytes = 0;
+    heapCounting = true;
+    send();
+    heapCounting = false;
+    result.allocs = heapAllocs;
+    result.bytes = heapBytes;
+    
+    auto start = std::chrono::steady_clock::now();
+#if HAVE_TSC
+    unsigned long long tscStart = __rdtsc();
+#endif
+    for (int r = 0; r < rounds; r++) {
+        send();
+    }
+#if HAVE_TSC
+    result.cycles = (double)(__rdtsc() - tscStart) / rounds;
+#else
+    result.cycles = 0;
+#endif
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    result.ns = std::chrono::duration<double, std::nano>(elapsed).count() / rounds;
+    return result;
+}
+
+// 取两种方式各自生成的帧文本用于比较
+static std::string oldFrame(const char* kind, const String& status) {
+    JsonDocument doc;
+    doc["type"] = kind;
+    if (strcmp(kind, "status") == 0) {
+        doc["status"] = status;
+    }
+    doc["device_id"] = DEVICE_ID;
+    doc["timestamp"] = timestamp;
+    String text;
+    serializeJson(doc, text);
+    return text.c_str();
+}
+
+struct Case {
+    const char* name;
+    const char* kind;
+    int brightness;  // >=0时状态文本为"LED已开启，亮度N%"，需要格式化
+    const char* text;
+};
+
+static const Case CASES[] = {
+    {"led_on",     "status",    80, nullptr},
+    {"stand_up",   "status",    -1, "机器人站立完成"},
+    {"stop_walk",  "status",    -1, "机器人停止步行，回到站立位置"},
+    {"heartbeat",  "heartbeat", -1, nullptr},
+};
+
+int main() {
+    const int rounds = 200000;
+    int mismatches = 0;
+    double oldNsTotal = 0, newNsTotal = 0, oldCyclesTotal = 0, newCyclesTotal = 0;
+    double oldBytesTotal = 0, oldAllocsTotal = 0, newBytesTotal = 0, newAllocsTotal = 0;
+    const size_t caseCount = sizeof(CASES) / sizeof(CASES[0]);
+    
+    printf("%-10s %5s %10s %10s %8s %10s | %10s %10s %8s %10s\n", "message", "match",
+           "old ns", "old cyc", "allocs", "heap B", "new ns", "new cyc", "allocs", "heap B");
+    for (size_t i = 0; i < caseCount; i++) {
+        const Case& c = CASES[i];
+        bool heartbeat = strcmp(c.kind, "heartbeat") == 0;
+        int brightness = c.brightness;
+        const char* text = c.text;
+        
+        Measurement oldResult = measure(rounds, [&] {
+            if (heartbeat) {
+                oldHeartbeat();
+            } else if (brightness >= 0) {
+                oldStatusUpdate("LED已开启，亮度" + String(brightness) + "%");
+            } else {
+                oldStatusUpdate(text);
+            }
+        });
+        Measurement newResult = measure(rounds, [&] {
+            if (heartbeat) {
+                newHeartbeat();
+            } else if (brightness >= 0) {
+                newStatusUpdatef("LED已开启，亮度%d%%", brightness);
+            } else {
+                newStatusUpdate(text);
+            }
+        });
+        
+        // frameBuffer中保留着最后一次新方式生成的帧
+        String status = brightness >= 0 ? "LED已开启，亮度" + String(brightness) + "%" : String(text);
+        std::string expected = oldFrame(c.kind, status);
+        bool match = expected == frameBuffer;
+        if (!match) {
+            printf("  原先: %s\n  现在: %s\n", expected.c_str(), frameBuffer);
+            mismatches++;
+        }
+        
+        printf("%-10s %5s %10.0f %10.0f %8.0f %10.0f | %10.0f %10.0f %8.0f %10.0f\n", c.name,
+               match ? "ok" : "DIFF", oldResult.ns, oldResult.cycles, oldResult.allocs, oldResult.bytes,
+               newResult.ns, newResult.cycles, newResult.allocs, newResult.bytes);
+        oldNsTotal += oldResult.ns;
+        newNsTotal += newResult.ns;
+        oldCyclesTotal += oldResult.cycles;
+        newCyclesTotal += newResult.cycles;
+        oldAllocsTotal += oldResult.allocs;
+        oldBytesTotal += oldResult.bytes;
+        newAllocsTotal += newResult.allocs;
+        newBytesTotal += newResult.bytes;
+    }
+    
+    printf("\n平均每条消息：原先 %.0f ns（%.0f周期）、%.1f次堆分配共%.0f字节；现在 %.0f ns（%.0f周期）、%.1f次堆分配共%.0f字节\n",
+           oldNsTotal / caseCount, oldCyclesTotal / caseCount, oldAllocsTotal / caseCount, oldBytesTotal / caseCount,
+           newNsTotal / caseCount, newCyclesTotal / caseCount, newAllocsTotal / caseCount, newBytesTotal / caseCount);
+    printf("每条消息节省 %.0f ns（%.0f周期）和%.0f字节堆分配，快%.1f倍\n",
+           (oldNsTotal - newNsTotal) / caseCount, (oldCyclesTotal - newCyclesTotal) / caseCount,
+           (oldBytesTotal - newBytesTotal) / caseCount, oldNsTotal / newNsTotal);
+#if !HAVE_TSC
+    printf("（本机没有TSC，周期数未统计）\n");
+#endif
+    if (mismatches > 0) {
+        printf("%d条消息与原先的序列化结果不一致\n", mismatches);
+        return 1;
+    }
+    printf("全部%u条消息与原先的序列化结果逐字节一致\n", (unsigned)caseCount);
+    return 0;
+}
@@ -0,0 +1,80 @@
+// 文本命令匹配基准：对比单次扫描的自动机与原先逐个关键字查找（String::indexOf）的方式
+// 同时校验两种方式对每条消息给出的命令完全一致
+//
+// 构建并运行（在仓库根目录）:
+//   g++ -O2 -std=c++11 -I astrbot_plugin_esp32/src tools/bench_text_commands.cpp \
+//       astrbot_plugin_esp32/src/text_command_matcher.cpp -o bench_text_commands && ./bench_text_commands
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "text_command_matcher.h"
+
+// 原先的做法：按规则顺序对每个关键字做一次子串查找
+static uint8_t matchSequential(const std::string& text) {
+    for (uint8_t rule = 0; rule < TEXT_COMMAND_RULE_COUNT; rule++) {
+        for (uint8_t k = 0; k < TEXT_COMMAND_KEYWORD_COUNT; k++) {
+            if (TEXT_COMMAND_KEYWORD_RULES[k] == rule && text.find(TEXT_COMMAND_KEYWORDS[k]) != std::string::npos) {
+                return rule;
+            }
+        }
+    }
+    return TEXT_COMMAND_NO_RULE;
+}
+
+// 生成指定字节数的聊天消息：中文填充文字，可选在末尾放一个关键字（最坏情况）
+static std::string makeMessage(std::mt19937& rng, size_t bytes, const char* keyword) {
+    static const char* const FILLER[] = {"你", "好", "今", "天", "的", "我", "们", "去", "看", "吧", "a", "b", " ", "，"};
+    std::string text;
+    size_t reserve = keyword ? strlen(keyword) : 0;
+    while (text.size() + reserve < bytes) {
+        text += FILLER[rng() % (sizeof(FILLER) / sizeof(FILLER[0]))];
+    }
+    if (keyword) text += keyword;
+    return text;
+}
+
+template <typename F>
+static double measureNs(const std::vector<std::string>& messages, int rounds, F match) {
+    volatile unsigned sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (const std::string& message : messages) {
+            sink += match(message);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (rounds * messages.size());
+}
+
+int main() {
+    std::mt19937 rng(42);
+    const size_t lengths[] = {10, 50, 100, 250, 500, 1000, 2000};
+    
+    printf("%8s %14s %14s %8s\n", "bytes", "sequential ns", "automaton ns", "speedup");
+    for (size_t length : lengths) {
+        // 一半消息不含关键字，一半在末尾含最低优先级的关键字
+        std::vector<std::string> messages;
+        for (int i = 0; i < 64; i++) {
+            const char* keyword = (i % 2) ? TEXT_COMMAND_KEYWORDS[TEXT_COMMAND_KEYWORD_COUNT - 1] : nullptr;
+            messages.push_back(makeMessage(rng, length, keyword));
+        }
+        
+        for (const std::string& message : messages) {
+            if (matchSequential(message) != matchTextCommand(message.data(), message.size())) {
+                fprintf(stderr, "结果不一致: %s\n", message.c_str());
+                return 1;
+            }
+        }
+        
+        int rounds = (int)(200000 / length) + 1;
+        double sequential = measureNs(messages, rounds, [](const std::string& m) { return matchSequential(m); });
+        double automaton = measureNs(messages, rounds, [](const std::string& m) { return matchTextCommand(m.data(), m.size()); });
+        printf("%8zu %14.0f %14.0f %7.1fx\n", length, sequential, automaton, sequential / automaton);
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#!/bin/sh
+# 在Linux主机上编译固件，硬件库替换为 astrbot_plugin_esp32/host/ 中的替身，
+# setup()/loop() 作为普通进程运行，连接本机WebSocket服务器，记录舵机角度、LED PWM和OLED面板内容。
+#
+# 依赖：g++（C++11）和ArduinoJson 7源码（仅头文件）。
+# ArduinoJson默认从Arduino库目录查找，也可用ARDUINOJSON_DIR指定其src目录。
+#
+# 用法: tools/build_host.sh [输出路径，默认 build/host/esp32_sim]
+#   ESP32_SIM_TRACE=trace.csv ESP32_SIM_PANEL=panel.pbm ESP32_SIM_DURATION_MS=10000 build/host/esp32_sim
+#   配合 tools/sim_server.py 在本机提供服务器并发送命令
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+OUTPUT=${1:-"$ROOT/build/host/esp32_sim"}
+ARDUINOJSON_DIR=${ARDUINOJSON_DIR:-"$HOME/Arduino/libraries/ArduinoJson/src"}
+CXX=${CXX:-g++}
+
+if [ ! -f "$ARDUINOJSON_DIR/ArduinoJson.h" ]; then
+    echo "找不到ArduinoJson.h，请设置ARDUINOJSON_DIR为ArduinoJson的src目录" >&2
+    exit 1
+fi
+
+# 固件源文件中*_test.cpp是独立的测试草图，各自定义了setup()/loop()，不参与编译
+SOURCES=$(ls "$ROOT"/astrbot_plugin_esp32/src/*.cpp | grep -v '_test\.cpp$')
+
+mkdir -p "$(dirname "$OUTPUT")"
+# 警告即错误：主机构建同时充当固件的编译检查
+$CXX -std=gnu++11 -O2 -g -Wall -Werror -pthread \
+    -I "$ROOT/astrbot_plugin_esp32/host" \
+    -I "$ROOT/astrbot_plugin_esp32/src" \
+    -I "$ARDUINOJSON_DIR" \
+    $SOURCES "$ROOT"/astrbot_plugin_esp32/host/*.cpp \
+    -o "$OUTPUT"
+echo "已生成 $OUTPUT"
@@ -0,0 +1,108 @@
+// 表情位图校验与基准：用原始绘制方法（emotion_primitives.cpp）在主机的Adafruit GFX替身上逐个画出表情，
+// 与emotion_bitmaps.h中预生成的PROGMEM位图逐字节比较，并对比两种方式的耗时和帧缓冲区写入量
+// 任何一个表情不一致时以非0状态退出，打印第一个不同的像素位置
+//
+// 构建并运行（在仓库根目录）:
+//   g++ -O2 -std=gnu++11 -pthread -DOLED_VERIFY_BITMAPS=1 -I astrbot_plugin_esp32/host -I astrbot_plugin_esp32/src
+//       tools/check_emotion_bitmaps.cpp astrbot_plugin_esp32/src/emotion_primitives.cpp
+//       astrbot_plugin_esp32/host/host_display.cpp astrbot_plugin_esp32/host/host_arduino.cpp
+//       astrbot_plugin_esp32/host/sim_trace.cpp -o check_emotion_bitmaps && ./check_emotion_bitmaps
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "emotion_bitmaps.h"
+#include "emotion_primitives.h"
+
+static const char* const EMOTION_NAMES[EMOTION_BITMAP_COUNT] = {
+    "happy", "sad", "angry", "surprised", "sleepy", "love", "cool", "thinking"
+};
+
+// 统计像素写入次数：主机替身的直线和填充最终都落到drawPixel，每次读改写帧缓冲区的一个字节
+class CountingDisplay : public Adafruit_SSD1306 {
+public:
+    unsigned long pixelWrites;
+    
+    CountingDisplay() : Adafruit_SSD1306(128, 64), pixelWrites(0) {}
+    
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        pixelWrites++;
+        Adafruit_SSD1306::drawPixel(x, y, color);
+    }
+};
+
+template <typename F>
+static double measureNs(int rounds, F render) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        render();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / rounds;
+}
+
+int main() {
+    const int rounds = 2000;
+    CountingDisplay display;
+    if (!display.begin()) {
+        fprintf(stderr, "帧缓冲区分配失败\n");
+        return 1;
+    }
+    uint8_t* buffer = display.getBuffer();
+    
+    int mismatches = 0;
+    double drawTotal = 0, blitTotal = 0;
+    unsigned long writesTotal = 0;
+    printf("%-10s %6s %12s %10s %12s %10s\n", "emotion", "match", "draw ns", "blit ns", "pixel writes", "blit bytes");
+    for (uint8_t i = 0; i < EMOTION_BITMAP_COUNT; i++) {
+        Emotion emotion = static_cast<Emotion>(i);
+        
+        display.clearDisplay();
+        display.pixelWrites = 0;
+        drawEmotionPrimitives(display, emotion);
+        unsigned long writes = display.pixelWrites;
+        
+        int firstDiff = -1;
+        for (size_t b = 0; b < EMOTION_BITMAP_SIZE; b++) {
+            if (buffer[b] != EMOTION_BITMAPS[i][b]) {
+                firstDiff = (int)b;
+                break;
+            }
+        }
+        uint8_t drawnByte = firstDiff >= 0 ? buffer[firstDiff] : 0;  // 下面的计时会覆盖帧缓冲区
+        
+        double drawNs = measureNs(rounds, [&] {
+            display.clearDisplay();
+            drawEmotionPrimitives(display, emotion);
+        });
+        double blitNs = measureNs(rounds, [&] {
+            memcpy_P(buffer, EMOTION_BITMAPS[i], EMOTION_BITMAP_SIZE);
+        });
+        
+        printf("%-10s %6s %12.0f %10.0f %12lu %10u\n", EMOTION_NAMES[i], firstDiff < 0 ? "ok" : "DIFF",
+               drawNs, blitNs, writes, (unsigned)EMOTION_BITMAP_SIZE);
+        if (firstDiff >= 0) {
+            // SSD1306页布局：每字节为一列中纵向的8个像素
+            printf("  第一个不同的字节%d：x=%d，y=%d-%d，位图0x%02X，绘制0x%02X\n", firstDiff,
+                   firstDiff % 128, firstDiff / 128 * 8, firstDiff / 128 * 8 + 7,
+                   EMOTION_BITMAPS[i][firstDiff], drawnByte);
+            mismatches++;
+        }
+        drawTotal += drawNs;
+        blitTotal += blitNs;
+        writesTotal += writes;
+    }
+    
+    printf("\n平均每个表情：原始绘制 %.0f ns、%lu次像素写入；位图拷贝 %.0f ns、%u字节，快%.1f倍\n",
+           drawTotal / EMOTION_BITMAP_COUNT, writesTotal / EMOTION_BITMAP_COUNT,
+           blitTotal / EMOTION_BITMAP_COUNT, (unsigned)EMOTION_BITMAP_SIZE, drawTotal / blitTotal);
+    printf("位图表占用flash %u字节（%u个表情 x %u字节），不占用RAM\n",
+           (unsigned)(EMOTION_BITMAP_COUNT * EMOTION_BITMAP_SIZE), (unsigned)EMOTION_BITMAP_COUNT,
+           (unsigned)EMOTION_BITMAP_SIZE);
+    if (mismatches > 0) {
+        printf("%d个表情与原始绘制结果不一致\n", mismatches);
+        return 1;
+    }
+    printf("全部%u个表情与原始绘制结果逐字节一致\n", (unsigned)EMOTION_BITMAP_COUNT);
+    return 0;
+}
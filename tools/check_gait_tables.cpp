@@ -0,0 +1,130 @@
+// 步态表校验：步态表取代了ServoController中原来逐行调用moveLeftLeg/moveRightLeg/delay的写法，
+// 这里按原standUp/walkForward/walkBackward/stopWalk的调用顺序重放一遍（每次delay结束一个关键帧），
+// 与gait_tables.h中的表逐帧比较角度和保持时间
+// 任何一个步态不一致时以非0状态退出；有意修改步态后，同步修改下面对应的原始序列
+//
+// 构建并运行（在仓库根目录）:
+//   g++ -O2 -std=gnu++11 -Wall -I astrbot_plugin_esp32/src tools/check_gait_tables.cpp
+//       -o check_gait_tables && ./check_gait_tables
+
+#include <cstdio>
+#include <vector>
+#include "gait_tables.h"
+
+// 记录原写法产生的关键帧：moveLeftLeg/moveRightLeg只改变当前角度，delay把当前姿态保持指定时间
+class LegacyRecorder {
+private:
+    int leftAngle;
+    int rightAngle;
+
+public:
+    std::vector<GaitKeyframe> frames;
+    
+    LegacyRecorder() : leftAngle(90), rightAngle(90) {}
+    
+    void moveLeftLeg(int angle) { leftAngle = angle; }
+    void moveRightLeg(int angle) { rightAngle = angle; }
+    void delay(int ms) {
+        GaitKeyframe frame = {(uint8_t)leftAngle, (uint8_t)rightAngle, (uint16_t)ms};
+        frames.push_back(frame);
+    }
+};
+
+// 以下四个函数抄录自原servo_controller.cpp，只去掉了串口输出
+static void standUp(LegacyRecorder& s) {
+    s.moveLeftLeg(180);
+    s.moveRightLeg(0);
+    s.delay(1000);
+    
+    s.moveLeftLeg(90);
+    s.moveRightLeg(90);
+    s.delay(1000);
+}
+
+static void walkForward(LegacyRecorder& s) {
+    s.moveRightLeg(45);
+    s.moveLeftLeg(45);
+    s.delay(500);
+    
+    s.moveRightLeg(30);
+    s.moveLeftLeg(30);
+    s.delay(500);
+    
+    s.moveRightLeg(120);
+    s.moveLeftLeg(120);
+    s.delay(500);
+    
+    s.moveRightLeg(150);
+    s.moveLeftLeg(150);
+    s.delay(500);
+    
+    s.moveRightLeg(90);
+    s.moveLeftLeg(90);
+    s.delay(500);
+}
+
+static void walkBackward(LegacyRecorder& s) {
+    s.moveLeftLeg(120);
+    s.moveRightLeg(120);
+    s.delay(500);
+    
+    s.moveLeftLeg(150);
+    s.moveRightLeg(150);
+    s.delay(500);
+    
+    s.moveLeftLeg(45);
+    s.moveRightLeg(45);
+    s.delay(500);
+    
+    s.moveLeftLeg(30);
+    s.moveRightLeg(30);
+    s.delay(500);
+    
+    s.moveLeftLeg(90);
+    s.moveRightLeg(90);
+    s.delay(500);
+}
+
+static void stopWalk(LegacyRecorder& s) {
+    s.moveLeftLeg(90);
+    s.moveRightLeg(90);
+    s.delay(1000);
+}
+
+static bool check(const Gait& gait, void (*legacy)(LegacyRecorder&)) {
+    LegacyRecorder recorder;
+    legacy(recorder);
+    const std::vector<GaitKeyframe>& expected = recorder.frames;
+    
+    bool match = expected.size() == gait.frameCount;
+    for (size_t i = 0; match && i < expected.size(); i++) {
+        const GaitKeyframe& frame = gait.frames[i];
+        if (frame.leftAngle != expected[i].leftAngle || frame.rightAngle != expected[i].rightAngle ||
+            frame.durationMs != expected[i].durationMs) {
+            printf("  第%u帧：步态表 左%u 右%u %ums，原写法 左%u 右%u %ums\n", (unsigned)i,
+                   frame.leftAngle, frame.rightAngle, frame.durationMs,
+                   expected[i].leftAngle, expected[i].rightAngle, expected[i].durationMs);
+            match = false;
+        }
+    }
+    if (expected.size() != gait.frameCount) {
+        printf("  帧数不同：步态表%u帧，原写法%u帧\n", gait.frameCount, (unsigned)expected.size());
+    }
+    printf("%-14s %s（%u帧）\n", gait.name, match ? "一致" : "不一致", gait.frameCount);
+    return match;
+}
+
+int main() {
+    int mismatches = 0;
+    if (!check(GAIT_STAND_UP, standUp)) mismatches++;
+    if (!check(GAIT_WALK_FORWARD, walkForward)) mismatches++;
+    if (!check(GAIT_WALK_BACKWARD, walkBackward)) mismatches++;
+    if (!check(GAIT_STOP, stopWalk)) mismatches++;
+    
+    if (mismatches > 0) {
+        printf("%d个步态与原写法不一致\n", mismatches);
+        return 1;
+    }
+    printf("全部步态与原写法逐帧一致\n");
+    return 0;
+}
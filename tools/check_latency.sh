@@ -0,0 +1,30 @@
+#!/bin/sh
+# 延迟测量的主机测试：编译主机仿真，用 tools/latency_bench.py --check 作为替身适配器驱动它，
+# 检查每条带t0的命令都回传了latency消息，并且空闲和步态进行中的命令都产生了实际输出。
+#
+# 依赖：与 tools/build_host.sh 相同，另需python3；仿真按config.h连接本机8765端口，该端口须空闲。
+#
+# 用法: tools/check_latency.sh [每个场景的测量次数，默认2]
+#   报告写入 build/host/latency_check.json，失败时以非0状态退出
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+REPETITIONS=${1:-2}
+BUILD="$ROOT/build/host"
+
+"$ROOT/tools/build_host.sh" "$BUILD/esp32_sim"
+
+python3 "$ROOT/tools/latency_bench.py" --encoding bin1 --repetitions "$REPETITIONS" \
+    --label check --output "$BUILD/latency_check.json" --check &
+BENCH=$!
+sleep 1
+
+# 仿真的输出写入日志文件（二进制日志可用 tools/log_decode.py 解码），基准结束后停止仿真
+"$BUILD/esp32_sim" > "$BUILD/latency_check.log" 2>&1 &
+SIM=$!
+
+STATUS=0
+wait $BENCH || STATUS=$?
+kill $SIM 2>/dev/null || true
+wait $SIM 2>/dev/null || true
+exit $STATUS
@@ -0,0 +1,55 @@
+"""对比JSON与bin1两种命令编码的帧大小和主机端解码耗时
+
+用法: python tools/codec_bench.py [--iterations N]
+"""
+import argparse
+import json
+import os
+import sys
+import timeit
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "adapter"))
+from binary_protocol import decode_command, encode_command  # noqa: E402
+
+# 与adapter/main.py实际下发的命令保持一致
+SAMPLES = [
+    {"type": "led_control", "action": "on", "brightness": 80,
+     "from_user": "用户", "timestamp": 12345.678},
+    {"type": "servo_control", "action": "walk_forward",
+     "from_user": "用户", "timestamp": 12345.678},
+    {"type": "servo_control", "action": "move_legs", "left_angle": 45, "right_angle": 135,
+     "duration_ms": 400, "profile": "min_jerk", "from_user": "用户", "timestamp": 12345.678},
+    {"type": "oled_control", "action": "emotion", "content": "happy",
+     "from_user": "用户", "timestamp": 12345.678},
+    {"type": "oled_control", "action": "text", "content": "你好，今天天气不错",
+     "from_user": "用户", "timestamp": 12345.678},
+    {"type": "custom_command", "command": "status",
+     "from_user": "管理员", "timestamp": 12345.678},
+    {"type": "custom_command", "command": "led_on",
+     "from_user": "管理员", "timestamp": 12345.678},
+]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--iterations", type=int, default=100000)
+    args = parser.parse_args()
+
+    print(f"{'命令':<28}{'JSON字节':>10}{'bin1字节':>10}{'JSON解码us':>12}{'bin1解码us':>12}")
+    total_json = total_binary = 0
+    for sample in SAMPLES:
+        text = json.dumps(sample)
+        frame = encode_command(sample)
+        json_us = timeit.timeit(lambda: json.loads(text), number=args.iterations) * 1e6 / args.iterations
+        binary_us = timeit.timeit(lambda: decode_command(frame), number=args.iterations) * 1e6 / args.iterations
+        total_json += len(text.encode("utf-8"))
+        total_binary += len(frame)
+
+        name = f"{sample['type']}:{sample.get('action', sample.get('command'))}"
+        print(f"{name:<28}{len(text.encode('utf-8')):>10}{len(frame):>10}{json_us:>12.2f}{binary_us:>12.2f}")
+
+    print(f"合计: JSON {total_json} 字节, bin1 {total_binary} 字节 ({total_binary / total_json:.0%})")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+"""从BDF点阵字体生成OLED中文子集字库 astrbot_plugin_esp32/src/cjk_font.h
+
+只收录字符表中出现的字符：tools/cjk_charset.txt中的常用字、固件自己发出的状态文本和表情名称
+（FIRMWARE_SOURCES中的字符串常量），另外可用--extra追加文本文件。每个字形按GLYPH_SIZE x GLYPH_SIZE的格子逐行连续打包成1bpp位流，码点按升序排列，
+设备端二分查找后解码到LRU缓存中。ASCII字符使用屏幕库内置的6x8字体，不收录。
+
+仓库自带的字体是tools/fonts/esp32cjk_12.bdf：本项目绘制的12x12点阵，与插件同为MIT许可，
+只包含上述字符表中的字；字符表增加新字时需要先在该BDF中画出字形，否则新字显示为方框。
+也可以换用其他12像素的自由许可BDF字体，例如文泉驿点阵宋体（wenquanyi_9pt.bdf，GPLv2并附字体嵌入例外）。
+生成的头文件记录字体名称、BDF中的COPYRIGHT属性和--license给出的许可，随固件分发时须遵守该许可。
+不指定--bdf时生成空字库，所有非ASCII字符在屏幕上显示为方框。
+
+用法: python tools/gen_cjk_font.py --bdf tools/fonts/esp32cjk_12.bdf --license "MIT（与本插件相同）"
+          [--extra replies.txt]
+"""
+import argparse
+import os
+import re
+
+GLYPH_SIZE = 12
+HERE = os.path.dirname(__file__)
+OUTPUT = os.path.join(HERE, "..", "astrbot_plugin_esp32", "src", "cjk_font.h")
+DEFAULT_CHARSET = os.path.join(HERE, "cjk_charset.txt")
+SOURCE_DIR = os.path.join(HERE, "..", "astrbot_plugin_esp32", "src")
+# 其中的字符串常量会出现在状态回复或屏幕上：命令执行结果、LED状态、拒绝原因、文本命令回复和表情名称
+# 只输出到串口的日志文本（log_messages.h等）不收录
+FIRMWARE_SOURCES = [
+    "command_executor.cpp",
+    "led_controller.cpp",
+    "message_handler.cpp",
+    "oled_display.cpp",
+    "text_command_automaton.h",
+]
+# 注释或字符串常量，按出现顺序匹配，注释中的引号不会被当作字符串
+TOKEN = re.compile(r'//[^\n]*|/\*.*?\*/|"((?:[^"\\\n]|\\.)*)"', re.S)
+
+
+def add_text(codepoints, text):
+    for ch in text:
+        cp = ord(ch)
+        # ASCII由内置字体绘制；只收录BMP内的可见字符
+        if 0x80 <= cp <= 0xFFFF and not ch.isspace():
+            codepoints.add(cp)
+
+
+def load_charset(paths):
+    codepoints = set()
+    for path in paths:
+        with open(path, encoding="utf-8") as f:
+            add_text(codepoints, f.read())
+    return codepoints
+
+
+def load_firmware_strings():
+    codepoints = set()
+    for name in FIRMWARE_SOURCES:
+        with open(os.path.join(SOURCE_DIR, name), encoding="utf-8") as f:
+            for match in TOKEN.finditer(f.read()):
+                if match.group(1):
+                    add_text(codepoints, match.group(1))
+    return codepoints
+
+
+def parse_bdf(path, wanted):
+    """读取BDF字体，返回 ({码点: GLYPH_SIZE行的像素列表}, {属性名: 值})"""
+    glyphs = {}
+    properties = {}
+    font_ascent = GLYPH_SIZE
+    with open(path, encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+
+    for line in lines:
+        if line.startswith("FONT_ASCENT"):
+            font_ascent = int(line.split()[1])
+        if line.startswith(("FONT ", "COPYRIGHT", "NOTICE")):
+            key, _, value = line.partition(" ")
+            properties[key] = value.strip().strip('"')
+        if not line.startswith("STARTCHAR"):
+            continue
+        encoding = -1
+        bbx = (0, 0, 0, 0)
+        for line in lines:
+            if line.startswith("ENCODING"):
+                encoding = int(line.split()[1])
+            elif line.startswith("BBX"):
+                bbx = tuple(int(v) for v in line.split()[1:5])
+            elif line.startswith("BITMAP"):
+                break
+        rows = []
+        for line in lines:
+            if line.startswith("ENDCHAR"):
+                break
+            rows.append(int(line, 16) if line.strip() else 0)
+        if encoding not in wanted:
+            continue
+
+        width, height, offset_x, offset_y = bbx
+        row_bits = ((width + 7) // 8) * 8
+        cell = [[0] * GLYPH_SIZE for _ in range(GLYPH_SIZE)]
+        # BDF以基线为原点，格子顶部对齐字体的ascent
+        top = font_ascent - (height + offset_y)
+        for r, bits in enumerate(rows[:height]):
+            y = top + r
+            if not 0 <= y < GLYPH_SIZE:
+                continue
+            for c in range(width):
+                x = offset_x + c
+                if 0 <= x < GLYPH_SIZE and bits & (1 << (row_bits - 1 - c)):
+                    cell[y][x] = 1
+        glyphs[encoding] = cell
+    return glyphs, properties
+
+
+def pack(cell):
+    """逐行连续打包为位流，高位在前"""
+    data = []
+    acc = 0
+    count = 0
+    for row in cell:
+        for pixel in row:
+            acc = (acc << 1) | pixel
+            count += 1
+            if count == 8:
+                data.append(acc)
+                acc = 0
+                count = 0
+    if count:
+        data.append(acc << (8 - count))
+    return data
+
+
+def write_header(path, glyphs, source_lines):
+    codepoints = sorted(glyphs)
+    glyph_bytes = (GLYPH_SIZE * GLYPH_SIZE + 7) // 8
+    lines = ["// 由 tools/gen_cjk_font.py 生成，请勿手动修改"]
+    lines += [f"// {line}" for line in source_lines]
+    lines += [
+        "#ifndef CJK_FONT_H",
+        "#define CJK_FONT_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f"#define CJK_GLYPH_WIDTH {GLYPH_SIZE}",
+        f"#define CJK_GLYPH_HEIGHT {GLYPH_SIZE}",
+        f"#define CJK_GLYPH_BYTES {glyph_bytes}  // 每个字形逐行连续打包的字节数",
+        "",
+        f"const uint16_t CJK_GLYPH_COUNT = {len(codepoints)};",
+        "",
+        "// 按升序排列的码点，与CJK_GLYPHS中的字形一一对应",
+        "const uint16_t CJK_CODEPOINTS[] PROGMEM = {",
+    ]
+    if codepoints:
+        for i in range(0, len(codepoints), 12):
+            lines.append("    " + ", ".join(f"0x{cp:04X}" for cp in codepoints[i:i + 12]) + ",")
+    else:
+        lines.append("    0x0000  // 空字库占位")
+    lines += ["};", "", "const uint8_t CJK_GLYPHS[] PROGMEM = {"]
+    if codepoints:
+        for cp in codepoints:
+            data = pack(glyphs[cp])
+            lines.append("    " + ", ".join(f"0x{b:02X}" for b in data) + f",  // {chr(cp)}")
+    else:
+        lines.append("    0x00  // 空字库占位")
+    lines += ["};", "", "#endif", ""]
+    with open(path, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成OLED中文子集字库")
+    parser.add_argument("--bdf", help="BDF点阵字体路径，不指定时生成空字库")
+    parser.add_argument("--license", help="字体的许可，使用--bdf时必须给出，原样记录在头文件中")
+    parser.add_argument("--charset", default=DEFAULT_CHARSET, help="需要收录的常用字表")
+    parser.add_argument("--extra", nargs="*", default=[], help="追加收录其中字符的文本文件")
+    args = parser.parse_args()
+    if args.bdf and not args.license:
+        parser.error("使用--bdf时须用--license注明字体许可")
+
+    firmware = load_firmware_strings()
+    wanted = load_charset([args.charset] + args.extra) | firmware
+    if args.bdf:
+        glyphs, properties = parse_bdf(args.bdf, wanted)
+        source_lines = [f"字体来源: {os.path.basename(args.bdf)}" +
+                        (f" ({properties['FONT']})" if "FONT" in properties else "")]
+        for key in ("COPYRIGHT", "NOTICE"):
+            if key in properties:
+                source_lines.append(f"{key}: {properties[key]}")
+        source_lines.append(f"许可: {args.license}")
+        missing = sorted(wanted - set(glyphs))
+        if missing:
+            print(f"警告: {len(missing)}个字符在字体中不存在，将显示为方框: {''.join(chr(cp) for cp in missing)}")
+        lost = sorted(firmware - set(glyphs))
+        if lost:
+            print(f"警告: 其中{len(lost)}个是固件状态文本或表情名称中的字符")
+    else:
+        glyphs = {}
+        source_lines = ["字体来源: 无（空字库）。用--bdf指定自由许可的12像素BDF字体重新生成，见gen_cjk_font.py说明"]
+    source_lines.append(f"字符表: {len(wanted)}个字符（{os.path.basename(args.charset)}，"
+                        f"其中固件状态文本和表情名称{len(firmware)}个）")
+
+    output = os.path.normpath(OUTPUT)
+    write_header(output, glyphs, source_lines)
+    glyph_bytes = (GLYPH_SIZE * GLYPH_SIZE + 7) // 8
+    print(f"已生成 {output}: {len(glyphs)}个字形, 约{len(glyphs) * (glyph_bytes + 2)}字节flash")
+
+
+if __name__ == "__main__":
+    main()
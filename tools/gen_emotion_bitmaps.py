@@ -0,0 +1,443 @@
+"""生成OLED表情位图头文件 astrbot_plugin_esp32/src/emotion_bitmaps.h
+
+光栅化算法逐行移植自Adafruit GFX / Adafruit SSD1306库（drawLine、drawCircle、
+fillCircleHelper、fillRoundRect、drawRoundRect、fillTriangle及其裁剪规则），
+保证生成的像素与设备上直接调用这些绘图函数的结果完全一致。
+表情上的文字（睡觉的Zz、思考的问号）仍在设备上运行时绘制，不包含在位图中。
+
+修改表情时需同时修改本脚本和emotion_primitives.cpp中的绘制过程，重新生成头文件后，
+在主机上运行tools/check_emotion_bitmaps.cpp逐字节比对位图与原始绘制结果并输出耗时；
+也可在config.h中打开OLED_VERIFY_BITMAPS，让设备启动时做同样的比对。
+
+用法: python tools/gen_emotion_bitmaps.py [--preview]
+"""
+import argparse
+import os
+
+WIDTH = 128
+HEIGHT = 64
+WHITE = 1
+BLACK = 0
+
+OUTPUT = os.path.join(os.path.dirname(__file__), "..", "astrbot_plugin_esp32", "src", "emotion_bitmaps.h")
+
+
+def cdiv(a, b):
+    """C语言整数除法（向零取整）"""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b > 0) else -q
+
+
+class Canvas:
+    def __init__(self):
+        self.pixels = [[0] * WIDTH for _ in range(HEIGHT)]
+
+    # ---- Adafruit_SSD1306 底层像素与快速线段（含裁剪） ----
+    def pixel(self, x, y, color):
+        if 0 <= x < WIDTH and 0 <= y < HEIGHT:
+            self.pixels[y][x] = color
+
+    def hline(self, x, y, w, color):
+        if 0 <= y < HEIGHT:
+            if x < 0:
+                w += x
+                x = 0
+            if x + w > WIDTH:
+                w = WIDTH - x
+            for i in range(x, x + w):
+                self.pixels[y][i] = color
+
+    def vline(self, x, y, h, color):
+        if 0 <= x < WIDTH:
+            if y < 0:
+                h += y
+                y = 0
+            if y + h > HEIGHT:
+                h = HEIGHT - y
+            for j in range(y, y + h):
+                self.pixels[j][x] = color
+
+    # ---- Adafruit_GFX 绘图函数 ----
+    def fill_rect(self, x, y, w, h, color):
+        for i in range(x, x + w):
+            self.vline(i, y, h, color)
+
+    def draw_line(self, x0, y0, x1, y1, color):
+        if x0 == x1:
+            if y0 > y1:
+                y0, y1 = y1, y0
+            self.vline(x0, y0, y1 - y0 + 1, color)
+            return
+        if y0 == y1:
+            if x0 > x1:
+                x0, x1 = x1, x0
+            self.hline(x0, y0, x1 - x0 + 1, color)
+            return
+        steep = abs(y1 - y0) > abs(x1 - x0)
+        if steep:
+            x0, y0 = y0, x0
+            x1, y1 = y1, x1
+        if x0 > x1:
+            x0, x1 = x1, x0
+            y0, y1 = y1, y0
+        dx = x1 - x0
+        dy = abs(y1 - y0)
+        err = dx // 2
+        ystep = 1 if y0 < y1 else -1
+        while x0 <= x1:
+            if steep:
+                self.pixel(y0, x0, color)
+            else:
+                self.pixel(x0, y0, color)
+            err -= dy
+            if err < 0:
+                y0 += ystep
+                err += dx
+            x0 += 1
+
+    def draw_circle(self, x0, y0, r, color):
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -2 * r
+        x = 0
+        y = r
+        self.pixel(x0, y0 + r, color)
+        self.pixel(x0, y0 - r, color)
+        self.pixel(x0 + r, y0, color)
+        self.pixel(x0 - r, y0, color)
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            self.pixel(x0 + x, y0 + y, color)
+            self.pixel(x0 - x, y0 + y, color)
+            self.pixel(x0 + x, y0 - y, color)
+            self.pixel(x0 - x, y0 - y, color)
+            self.pixel(x0 + y, y0 + x, color)
+            self.pixel(x0 - y, y0 + x, color)
+            self.pixel(x0 + y, y0 - x, color)
+            self.pixel(x0 - y, y0 - x, color)
+
+    def draw_circle_helper(self, x0, y0, r, corners, color):
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -2 * r
+        x = 0
+        y = r
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            if corners & 0x4:
+                self.pixel(x0 + x, y0 + y, color)
+                self.pixel(x0 + y, y0 + x, color)
+            if corners & 0x2:
+                self.pixel(x0 + x, y0 - y, color)
+                self.pixel(x0 + y, y0 - x, color)
+            if corners & 0x8:
+                self.pixel(x0 - y, y0 + x, color)
+                self.pixel(x0 - x, y0 + y, color)
+            if corners & 0x1:
+                self.pixel(x0 - y, y0 - x, color)
+                self.pixel(x0 - x, y0 - y, color)
+
+    def fill_circle_helper(self, x0, y0, r, corners, delta, color):
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -2 * r
+        x = 0
+        y = r
+        px = x
+        py = y
+        delta += 1
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            if x < y + 1:
+                if corners & 1:
+                    self.vline(x0 + x, y0 - y, 2 * y + delta, color)
+                if corners & 2:
+                    self.vline(x0 - x, y0 - y, 2 * y + delta, color)
+            if y != py:
+                if corners & 1:
+                    self.vline(x0 + py, y0 - px, 2 * px + delta, color)
+                if corners & 2:
+                    self.vline(x0 - py, y0 - px, 2 * px + delta, color)
+                py = y
+            px = x
+
+    def fill_circle(self, x0, y0, r, color):
+        self.vline(x0, y0 - r, 2 * r + 1, color)
+        self.fill_circle_helper(x0, y0, r, 3, 0, color)
+
+    def fill_round_rect(self, x, y, w, h, r, color):
+        r = min(r, min(w, h) // 2)
+        self.fill_rect(x + r, y, w - 2 * r, h, color)
+        self.fill_circle_helper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color)
+        self.fill_circle_helper(x + r, y + r, r, 2, h - 2 * r - 1, color)
+
+    def draw_round_rect(self, x, y, w, h, r, color):
+        r = min(r, min(w, h) // 2)
+        self.hline(x + r, y, w - 2 * r, color)
+        self.hline(x + r, y + h - 1, w - 2 * r, color)
+        self.vline(x, y + r, h - 2 * r, color)
+        self.vline(x + w - 1, y + r, h - 2 * r, color)
+        self.draw_circle_helper(x + r, y + r, r, 1, color)
+        self.draw_circle_helper(x + w - r - 1, y + r, r, 2, color)
+        self.draw_circle_helper(x + w - r - 1, y + h - r - 1, r, 4, color)
+        self.draw_circle_helper(x + r, y + h - r - 1, r, 8, color)
+
+    def fill_triangle(self, x0, y0, x1, y1, x2, y2, color):
+        if y0 > y1:
+            y0, y1 = y1, y0
+            x0, x1 = x1, x0
+        if y1 > y2:
+            y2, y1 = y1, y2
+            x2, x1 = x1, x2
+        if y0 > y1:
+            y0, y1 = y1, y0
+            x0, x1 = x1, x0
+        if y0 == y2:
+            a = b = x0
+            if x1 < a:
+                a = x1
+            elif x1 > b:
+                b = x1
+            if x2 < a:
+                a = x2
+            elif x2 > b:
+                b = x2
+            self.hline(a, y0, b - a + 1, color)
+            return
+        dx01, dy01 = x1 - x0, y1 - y0
+        dx02, dy02 = x2 - x0, y2 - y0
+        dx12, dy12 = x2 - x1, y2 - y1
+        sa = sb = 0
+        last = y1 if y1 == y2 else y1 - 1
+        y = y0
+        while y <= last:
+            a = x0 + cdiv(sa, dy01)
+            b = x0 + cdiv(sb, dy02)
+            sa += dx01
+            sb += dx02
+            if a > b:
+                a, b = b, a
+            self.hline(a, y, b - a + 1, color)
+            y += 1
+        sa = dx12 * (y - y1)
+        sb = dx02 * (y - y0)
+        while y <= y2:
+            a = x1 + cdiv(sa, dy12)
+            b = x0 + cdiv(sb, dy02)
+            sa += dx12
+            sb += dx02
+            if a > b:
+                a, b = b, a
+            self.hline(a, y, b - a + 1, color)
+            y += 1
+
+    def to_pages(self):
+        """转换为SSD1306帧缓冲区布局：每页8行，每字节一列，低位在上"""
+        data = []
+        for page in range(HEIGHT // 8):
+            for x in range(WIDTH):
+                byte = 0
+                for bit in range(8):
+                    if self.pixels[page * 8 + bit][x]:
+                        byte |= 1 << bit
+                data.append(byte)
+        return data
+
+
+# ---- 表情绘制过程，与oled_display.cpp中的draw*Face()一一对应 ----
+
+def draw_happy(d):
+    for i in range(2):
+        d.draw_circle(45, 25, 8 + i, WHITE)
+        d.draw_circle(83, 25, 8 + i, WHITE)
+    d.fill_rect(37, 25, 16, 10, BLACK)
+    d.fill_rect(75, 25, 16, 10, BLACK)
+    d.fill_rect(37, 25, 42, 10, BLACK)
+    d.fill_round_rect(35, 35, 16, 16, 4, WHITE)
+    d.fill_round_rect(77, 35, 16, 16, 4, WHITE)
+    for i in range(3):
+        d.draw_circle(64, 45, 15 + i, WHITE)
+    d.fill_rect(49, 45, 30, 15, BLACK)
+
+
+def draw_sad(d):
+    d.draw_line(35, 18, 50, 25, WHITE)
+    d.draw_line(36, 19, 51, 26, WHITE)
+    d.draw_line(78, 25, 93, 18, WHITE)
+    d.draw_line(77, 26, 92, 19, WHITE)
+    d.fill_round_rect(35, 35, 16, 16, 4, WHITE)
+    d.fill_round_rect(77, 35, 16, 16, 4, WHITE)
+    d.draw_line(43, 51, 43, 58, WHITE)
+    d.draw_line(85, 51, 85, 58, WHITE)
+    d.fill_circle(43, 59, 2, WHITE)
+    d.fill_circle(85, 59, 2, WHITE)
+    for i in range(3):
+        d.draw_circle(64, 75, 15 + i, WHITE)
+    d.fill_rect(49, 60, 30, 15, BLACK)
+
+
+def draw_angry(d):
+    d.fill_triangle(30, 20, 50, 30, 30, 25, WHITE)
+    d.fill_triangle(98, 20, 78, 30, 98, 25, WHITE)
+    d.fill_round_rect(35, 38, 16, 12, 3, WHITE)
+    d.fill_round_rect(77, 38, 16, 12, 3, WHITE)
+    d.fill_circle(62, 50, 1, WHITE)
+    d.fill_circle(66, 50, 1, WHITE)
+    d.draw_line(45, 58, 55, 55, WHITE)
+    d.draw_line(55, 55, 65, 58, WHITE)
+    d.draw_line(65, 58, 75, 55, WHITE)
+    d.draw_line(75, 55, 85, 58, WHITE)
+
+
+def draw_surprised(d):
+    for i in range(2):
+        d.draw_circle(45, 15, 12 + i, WHITE)
+        d.draw_circle(83, 15, 12 + i, WHITE)
+    d.fill_rect(33, 15, 24, 12, BLACK)
+    d.fill_rect(71, 15, 24, 12, BLACK)
+    d.fill_round_rect(30, 30, 20, 20, 5, WHITE)
+    d.fill_round_rect(78, 30, 20, 20, 5, WHITE)
+    d.fill_circle(40, 40, 3, BLACK)
+    d.fill_circle(88, 40, 3, BLACK)
+    d.draw_circle(64, 58, 8, WHITE)
+    d.draw_circle(64, 58, 7, WHITE)
+
+
+def draw_sleepy(d):
+    d.draw_line(35, 22, 50, 18, WHITE)
+    d.draw_line(36, 23, 51, 19, WHITE)
+    d.draw_line(78, 18, 93, 22, WHITE)
+    d.draw_line(77, 19, 92, 23, WHITE)
+    d.fill_round_rect(35, 40, 16, 4, 2, WHITE)
+    d.fill_round_rect(77, 40, 16, 4, 2, WHITE)
+    for i in range(2):
+        d.draw_circle(64, 52, 6 + i, WHITE)
+    d.fill_rect(58, 52, 12, 6, BLACK)
+
+
+def draw_love(d):
+    for i in range(2):
+        d.draw_circle(45, 22, 10 + i, WHITE)
+        d.draw_circle(83, 22, 10 + i, WHITE)
+    d.fill_rect(35, 22, 20, 10, BLACK)
+    d.fill_rect(73, 22, 20, 10, BLACK)
+    d.draw_round_rect(32, 32, 20, 20, 5, WHITE)
+    d.draw_round_rect(76, 32, 20, 20, 5, WHITE)
+    d.fill_circle(38, 38, 3, WHITE)
+    d.fill_circle(46, 38, 3, WHITE)
+    d.fill_triangle(35, 41, 49, 41, 42, 48, WHITE)
+    d.fill_circle(82, 38, 3, WHITE)
+    d.fill_circle(90, 38, 3, WHITE)
+    d.fill_triangle(79, 41, 93, 41, 86, 48, WHITE)
+    for i in range(3):
+        d.draw_circle(64, 45, 15 + i, WHITE)
+    d.fill_rect(49, 45, 30, 15, BLACK)
+
+
+def draw_cool(d):
+    d.fill_rect(35, 18, 18, 3, WHITE)
+    d.fill_rect(75, 18, 18, 3, WHITE)
+    d.fill_round_rect(25, 30, 78, 20, 8, WHITE)
+    d.fill_round_rect(30, 34, 25, 12, 6, BLACK)
+    d.fill_round_rect(73, 34, 25, 12, 6, BLACK)
+    d.fill_rect(55, 38, 18, 4, WHITE)
+    d.draw_line(50, 58, 78, 56, WHITE)
+    d.draw_line(50, 59, 78, 57, WHITE)
+
+
+def draw_thinking(d):
+    for i in range(2):
+        d.draw_circle(45, 20, 8 + i, WHITE)
+    d.fill_rect(37, 20, 16, 8, BLACK)
+    d.draw_line(78, 18, 93, 25, WHITE)
+    d.draw_line(77, 19, 92, 26, WHITE)
+    d.fill_round_rect(35, 35, 16, 16, 4, WHITE)
+    d.fill_round_rect(77, 40, 16, 6, 3, WHITE)
+    d.fill_circle(43, 38, 2, BLACK)
+    d.draw_line(55, 58, 70, 56, WHITE)
+    d.draw_line(55, 59, 70, 57, WHITE)
+    d.draw_circle(100, 15, 10, WHITE)
+    d.fill_circle(90, 25, 3, WHITE)
+    d.fill_circle(85, 30, 2, WHITE)
+    d.fill_circle(82, 33, 1, WHITE)
+
+
+# 顺序必须与oled_display.h中的Emotion枚举一致
+EMOTIONS = [
+    ("happy", draw_happy),
+    ("sad", draw_sad),
+    ("angry", draw_angry),
+    ("surprised", draw_surprised),
+    ("sleepy", draw_sleepy),
+    ("love", draw_love),
+    ("cool", draw_cool),
+    ("thinking", draw_thinking),
+]
+
+
+def render(draw):
+    canvas = Canvas()
+    draw(canvas)
+    return canvas
+
+
+def write_header(path):
+    lines = [
+        "// 由 tools/gen_emotion_bitmaps.py 生成，请勿手动修改",
+        "#ifndef EMOTION_BITMAPS_H",
+        "#define EMOTION_BITMAPS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f"const uint8_t EMOTION_BITMAP_COUNT = {len(EMOTIONS)};",
+        f"const size_t EMOTION_BITMAP_SIZE = {WIDTH * HEIGHT // 8};  // {WIDTH}x{HEIGHT}，SSD1306页布局",
+        "",
+        "const uint8_t EMOTION_BITMAPS[EMOTION_BITMAP_COUNT][EMOTION_BITMAP_SIZE] PROGMEM = {",
+    ]
+    for name, draw in EMOTIONS:
+        data = render(draw).to_pages()
+        lines.append(f"    // {name}")
+        lines.append("    {")
+        for i in range(0, len(data), 16):
+            lines.append("        " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+        lines.append("    },")
+    lines += ["};", "", "#endif", ""]
+    with open(path, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成OLED表情位图头文件")
+    parser.add_argument("--preview", action="store_true", help="在终端打印每个表情的字符画")
+    args = parser.parse_args()
+
+    if args.preview:
+        for name, draw in EMOTIONS:
+            print(f"== {name} ==")
+            for row in render(draw).pixels:
+                print("".join("#" if p else "." for p in row))
+
+    write_header(os.path.normpath(OUTPUT))
+    print(f"已生成 {os.path.normpath(OUTPUT)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,163 @@
+"""生成文本命令关键字匹配自动机 astrbot_plugin_esp32/src/text_command_automaton.h
+
+把关键字表编译成Aho-Corasick自动机，设备端对消息的UTF-8字节只扫描一遍即可找出所有命中的关键字。
+规则按优先级排列，多个规则同时命中时取序号最小的规则，与原先if-else链的判断顺序一致。
+每个状态预先计算了沿失配链可达的最高优先级规则，匹配时不需要再遍历输出链。
+
+修改关键字后重新运行本脚本: python tools/gen_text_commands.py
+"""
+import os
+from collections import deque
+
+OUTPUT = os.path.join(os.path.dirname(__file__), "..", "astrbot_plugin_esp32", "src", "text_command_automaton.h")
+
+# (CommandAction, 日志说明, 关键字)，按优先级从高到低排列
+RULES = [
+    ("LedOn", "执行点亮LED操作", ["亮灯", "开灯", "点亮"]),
+    ("LedOff", "执行关闭LED操作", ["关灯", "熄灭", "关闭"]),
+    ("LedStatus", "查询LED状态", ["LED状态", "灯状态"]),
+    ("WalkForward", "执行前进步态", ["前进", "向前", "走前"]),
+    ("WalkBackward", "执行后退步态", ["后退", "向后", "倒退"]),
+    ("StandUp", "执行站立动作", ["站立", "站起", "起立"]),
+    ("Stop", "执行停止动作", ["停止", "停下", "不动"]),
+    ("LeftForward", "左腿前进动作", ["左腿前", "左脚前"]),
+    ("LeftBackward", "左腿后退动作", ["左腿后", "左脚后"]),
+    ("RightForward", "右腿前进动作", ["右腿前", "右脚前"]),
+    ("RightBackward", "右腿后退动作", ["右腿后", "右脚后"]),
+    ("ServoStatus", "查询舵机状态", ["舵机状态", "腿部状态"]),
+]
+
+NO_RULE = 0xFF
+
+
+def build():
+    goto = [{}]
+    output = [NO_RULE]
+    for rule, (_, _, keywords) in enumerate(RULES):
+        for keyword in keywords:
+            state = 0
+            for byte in keyword.encode("utf-8"):
+                if byte not in goto[state]:
+                    goto.append({})
+                    output.append(NO_RULE)
+                    goto[state][byte] = len(goto) - 1
+                state = goto[state][byte]
+            output[state] = min(output[state], rule)
+
+    # 按广度优先计算失配指针，并把失配链上的最高优先级规则合并到每个状态
+    fail = [0] * len(goto)
+    queue = deque(goto[0].values())
+    while queue:
+        state = queue.popleft()
+        for byte, target in goto[state].items():
+            f = fail[state]
+            while f and byte not in goto[f]:
+                f = fail[f]
+            fail[target] = goto[f].get(byte, 0)
+            output[target] = min(output[target], output[fail[target]])
+            queue.append(target)
+    return goto, fail, output
+
+
+def match(goto, fail, output, text):
+    """与设备端相同的匹配过程，用于生成时自检"""
+    state = 0
+    best = NO_RULE
+    for byte in text.encode("utf-8"):
+        while state and byte not in goto[state]:
+            state = fail[state]
+        state = goto[state].get(byte, 0)
+        best = min(best, output[state])
+    return best
+
+
+def reference(text):
+    """原先if-else链的判断方式"""
+    for rule, (_, _, keywords) in enumerate(RULES):
+        if any(k in text for k in keywords):
+            return rule
+    return NO_RULE
+
+
+def self_check(goto, fail, output):
+    samples = ["请帮我开灯", "左腿前进", "先关闭再前进", "LED状态怎么样", "腿部状态", "你好",
+               "停下来然后倒退", "站起来", "右脚后退一点", "灯状态和舵机状态"]
+    for rule in RULES:
+        samples += rule[2]
+    for text in samples:
+        assert match(goto, fail, output, text) == reference(text), text
+
+
+def c_array(ctype, name, values, per_line=16, fmt="{}"):
+    lines = [f"const {ctype} {name}[] = {{"]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return lines
+
+
+def write_header(path, goto, fail, output):
+    edge_start = []
+    edge_bytes = []
+    edge_targets = []
+    for edges in goto:
+        edge_start.append(len(edge_bytes))
+        for byte in sorted(edges):
+            edge_bytes.append(byte)
+            edge_targets.append(edges[byte])
+    edge_start.append(len(edge_bytes))
+
+    state_type = "uint8_t" if len(goto) <= 256 else "uint16_t"
+    keywords = [(k, rule) for rule, (_, _, ks) in enumerate(RULES) for k in ks]
+
+    lines = [
+        "// 由 tools/gen_text_commands.py 生成，请勿手动修改",
+        "#ifndef TEXT_COMMAND_AUTOMATON_H",
+        "#define TEXT_COMMAND_AUTOMATON_H",
+        "",
+        "#include <stdint.h>",
+        "#include \"command.h\"",
+        "",
+        "// ESP32上const数组直接存放在flash中",
+        "",
+        f"typedef {state_type} TextCommandState;",
+        f"const uint16_t TEXT_COMMAND_STATE_COUNT = {len(goto)};",
+        f"const uint8_t TEXT_COMMAND_RULE_COUNT = {len(RULES)};",
+        f"const uint8_t TEXT_COMMAND_NO_RULE = 0x{NO_RULE:02X};",
+        "",
+        "// 规则按优先级排列，序号越小优先级越高",
+        "const CommandAction TEXT_COMMAND_RULE_ACTIONS[] = {",
+    ]
+    lines += [f"    CommandAction::{action}," for action, _, _ in RULES]
+    lines += ["};", "", "const char* const TEXT_COMMAND_RULE_NAMES[] = {"]
+    lines += [f"    \"{desc}\"," for _, desc, _ in RULES]
+    lines += ["};", "", "// 状态s的转移边为TEXT_COMMAND_EDGE_BYTES[EDGE_START[s] .. EDGE_START[s+1])，按字节升序排列"]
+    lines += c_array("uint16_t", "TEXT_COMMAND_EDGE_START", edge_start)
+    lines += [""] + c_array("uint8_t", "TEXT_COMMAND_EDGE_BYTES", edge_bytes, fmt="0x{:02X}")
+    lines += [""] + c_array(state_type, "TEXT_COMMAND_EDGE_TARGETS", edge_targets)
+    lines += ["", "// 根状态的完整转移表，消息中大多数字节都从根状态出发，避免逐条查找"]
+    lines += c_array(state_type, "TEXT_COMMAND_ROOT", [goto[0].get(b, 0) for b in range(256)])
+    lines += ["", "// 失配指针"] + c_array(state_type, "TEXT_COMMAND_FAIL", fail)
+    lines += ["", "// 到达该状态时命中的最高优先级规则（已合并失配链），没有时为TEXT_COMMAND_NO_RULE"]
+    lines += c_array("uint8_t", "TEXT_COMMAND_OUTPUT", output, fmt="0x{:02X}")
+    lines += ["", "// 原始关键字表，供主机端基准程序对照"]
+    lines += ["const char* const TEXT_COMMAND_KEYWORDS[] = {"]
+    lines += [f"    \"{k}\"," for k, _ in keywords]
+    lines += ["};"]
+    lines += c_array("uint8_t", "TEXT_COMMAND_KEYWORD_RULES", [r for _, r in keywords])
+    lines += [f"const uint8_t TEXT_COMMAND_KEYWORD_COUNT = {len(keywords)};", "", "#endif", ""]
+    with open(path, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    goto, fail, output = build()
+    self_check(goto, fail, output)
+    output_path = os.path.normpath(OUTPUT)
+    write_header(output_path, goto, fail, output)
+    edges = sum(len(g) for g in goto)
+    print(f"已生成 {output_path}: {len(goto)}个状态, {edges}条转移边")
+
+
+if __name__ == "__main__":
+    main()
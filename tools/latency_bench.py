@@ -0,0 +1,256 @@
+"""端到端命令延迟基准：从发送命令到设备实际输出（舵机写入、LED PWM、OLED刷新）
+
+本脚本充当本地的替身适配器，在指定端口等待设备连接，命令中附带t0，设备执行后回传latency消息
+（格式见adapter/latency.py）。分三种场景测量每类命令的p50/p99/最大延迟：
+    idle      设备空闲时逐条发送
+    mid_gait  前进步态进行中发送
+    burst     所有命令连续发送，不等待回传
+结果写成JSON报告，--baseline指定另一份报告时输出两者的对比。
+--check时按check_report()检查报告，有问题以非0状态退出，tools/check_latency.sh用它做主机测试。
+
+配合主机仿真（tools/build_host.sh）：
+    python tools/latency_bench.py --output report.json --encoding bin1 &
+    build/host/esp32_sim
+也可以直接连接真实设备（--host 0.0.0.0，固件config.h中的服务器地址指向本机）。
+"""
+import argparse
+import asyncio
+import datetime
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "adapter"))
+from binary_protocol import ENCODING_NAME, encode_command  # noqa: E402
+import latency  # noqa: E402
+from sim_server import Connection  # noqa: E402
+
+REPORT_TIMEOUT = 6.0   # 单条命令等待latency消息的上限（秒），长于固件等待舵机输出的上限
+GAIT_LEAD_IN = 0.3     # mid_gait场景中步态开始后多久发送被测命令（秒）
+STAND_UP_TIME = 2.1    # stand_up步态播完所需的时间（秒），此后动作队列为空，舵机命令立即开始
+
+
+def make_commands(index: int) -> dict:
+    """每类命令一条；内容随轮次变化，保证每次都会产生实际输出"""
+    even = index % 2 == 0
+    return {
+        "led_on": {"type": "led_control", "action": "on", "brightness": 80 if even else 40},
+        "led_off": {"type": "led_control", "action": "off"},
+        "oled_emotion": {"type": "oled_control", "action": "emotion", "content": "happy" if even else "sad"},
+        "oled_text": {"type": "oled_control", "action": "text", "content": f"延迟测试 {index}"},
+        "move_legs": {"type": "servo_control", "action": "move_legs", "left_angle": 60 if even else 120,
+                      "right_angle": 120 if even else 60, "duration_ms": 200},
+        "walk_forward": {"type": "servo_control", "action": "walk_forward"},
+        "stop": {"type": "servo_control", "action": "stop"},
+    }
+
+
+class Bench:
+    def __init__(self, connection: Connection, use_binary: bool):
+        self.connection = connection
+        self.use_binary = use_binary
+        self.waiting = {}   # t0 -> Future，收到latency消息时完成
+        self.samples = {}   # 场景 -> 命令 -> [估算结果或None]
+
+    async def send(self, message: dict, timed: bool = True):
+        if timed:
+            message = latency.stamp(message)
+            self.waiting[message["t0"]] = asyncio.get_running_loop().create_future()
+        frame = encode_command(message) if self.use_binary else None
+        if frame is not None:
+            await self.connection.send(frame, binary=True)
+        else:
+            await self.connection.send(json.dumps(message, ensure_ascii=False).encode("utf-8"), binary=False)
+        return message.get("t0")
+
+    def on_latency(self, report: dict):
+        future = self.waiting.pop(report.get("t0"), None)
+        if future and not future.done():
+            future.set_result(latency.estimate(report, latency.now_us()))
+
+    async def collect(self, scenario: str, name: str, t0: int):
+        try:
+            result = await asyncio.wait_for(self.waiting[t0], REPORT_TIMEOUT)
+        except asyncio.TimeoutError:
+            self.waiting.pop(t0, None)
+            result = None
+        self.samples.setdefault(scenario, {}).setdefault(name, []).append(result)
+
+    async def settle(self, seconds: float):
+        await self.send({"type": "servo_control", "action": "stand_up"}, timed=False)
+        await asyncio.sleep(STAND_UP_TIME + seconds)
+
+    async def run_idle(self, repetitions: int, gap: float):
+        for index in range(repetitions):
+            for name, message in make_commands(index).items():
+                t0 = await self.send(message)
+                await self.collect("idle", name, t0)
+                await asyncio.sleep(gap)
+            await self.settle(gap)
+
+    async def run_mid_gait(self, repetitions: int, gap: float):
+        for index in range(repetitions):
+            for name, message in make_commands(index).items():
+                # 每条被测命令只对应一个步态：舵机命令排在这个步态之后，测到的是它自己开始输出的时间
+                await self.settle(0)
+                await self.send({"type": "servo_control", "action": "walk_forward"}, timed=False)
+                await asyncio.sleep(GAIT_LEAD_IN)
+                t0 = await self.send(message)
+                await self.collect("mid_gait", name, t0)
+                await asyncio.sleep(gap)
+            await self.settle(gap)
+
+    async def run_burst(self, repetitions: int, gap: float):
+        for index in range(repetitions):
+            sent = []
+            for name, message in make_commands(index).items():
+                sent.append((name, await self.send(message)))
+            await asyncio.gather(*(self.collect("burst", name, t0) for name, t0 in sent))
+            await self.settle(gap * 4)
+
+
+def percentile(values, fraction):
+    """最近秩百分位数"""
+    ordered = sorted(values)
+    rank = max(1, int(-(-fraction * len(ordered) // 1)))
+    return ordered[rank - 1]
+
+
+def summarize(results):
+    summary = {"count": len(results), "lost": 0, "no_output": 0}
+    measured = []
+    for result in results:
+        if result is None:
+            summary["lost"] += 1
+        elif result["e2e_us"] is None:
+            summary["no_output"] += 1
+        else:
+            measured.append(result)
+    for field in ("e2e_us", "output_us", "queue_us", "network_us"):
+        values = [result[field] for result in measured]
+        summary[field] = {
+            "p50": percentile(values, 0.50),
+            "p99": percentile(values, 0.99),
+            "max": max(values),
+        } if values else None
+    return summary
+
+
+def check_report(report):
+    """返回报告中的问题：任何命令都必须收到latency消息；空闲和步态中的命令都必须产生实际输出
+    （突发场景中舵机命令可能在第一次写入前被同一批的stop抢占，允许没有输出）"""
+    problems = []
+    for scenario, commands in report["scenarios"].items():
+        for name, summary in commands.items():
+            if summary["lost"]:
+                problems.append(f"{scenario}/{name}: {summary['lost']}条命令没有收到latency消息")
+            if summary["no_output"] and scenario != "burst":
+                problems.append(f"{scenario}/{name}: {summary['no_output']}条命令没有产生输出")
+    return problems
+
+
+def print_report(report, baseline=None):
+    print(f"{'场景':<10}{'命令':<14}{'样本':>6}{'丢失':>6}{'p50 ms':>10}{'p99 ms':>10}{'max ms':>10}", end="")
+    print(f"{'基线p50':>10}{'基线p99':>10}" if baseline else "")
+    for scenario, commands in report["scenarios"].items():
+        for name, summary in commands.items():
+            e2e = summary["e2e_us"]
+            lost = summary["lost"] + summary["no_output"]
+            if e2e:
+                line = f"{scenario:<10}{name:<14}{summary['count']:>6}{lost:>6}" \
+                       f"{e2e['p50'] / 1000:>10.2f}{e2e['p99'] / 1000:>10.2f}{e2e['max'] / 1000:>10.2f}"
+            else:
+                line = f"{scenario:<10}{name:<14}{summary['count']:>6}{lost:>6}{'-':>10}{'-':>10}{'-':>10}"
+            if baseline:
+                old = baseline.get("scenarios", {}).get(scenario, {}).get(name, {}).get("e2e_us")
+                line += f"{old['p50'] / 1000:>10.2f}{old['p99'] / 1000:>10.2f}" if old else f"{'-':>10}{'-':>10}"
+            print(line)
+
+
+async def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8765)
+    parser.add_argument("--encoding", choices=["json", ENCODING_NAME], default="json")
+    parser.add_argument("--repetitions", type=int, default=20, help="每个场景中每类命令的测量次数")
+    parser.add_argument("--gap-ms", type=int, default=200, help="相邻两条命令之间的间隔")
+    parser.add_argument("--scenarios", default="idle,mid_gait,burst")
+    parser.add_argument("--label", default="", help="写入报告的固件版本说明")
+    parser.add_argument("--output", default="latency_report.json")
+    parser.add_argument("--baseline", help="用于对比的旧报告")
+    parser.add_argument("--check", action="store_true", help="检查报告，有丢失或无输出的样本时以非0状态退出")
+    args = parser.parse_args()
+
+    finished = asyncio.Event()
+    report = {}
+
+    async def on_client(reader, writer):
+        connection = Connection(reader, writer)
+        await connection.handshake()
+        bench = None
+
+        async def read_device():
+            while True:
+                opcode, payload = await connection.receive()
+                if opcode is None or opcode == 0x8:
+                    return
+                try:
+                    message = json.loads(payload)
+                except ValueError:
+                    continue
+                if message.get("type") == "status" and message.get("status") == "connected":
+                    connection.encodings = set(message.get("encodings", ["json"]))
+                    connection.connected.set()
+                elif message.get("type") == "latency" and bench:
+                    bench.on_latency(message)
+
+        reader_task = asyncio.create_task(read_device())
+        await connection.connected.wait()
+        use_binary = args.encoding == ENCODING_NAME and ENCODING_NAME in connection.encodings
+        bench = Bench(connection, use_binary)
+        print(f"[bench] 设备已连接，编码: {ENCODING_NAME if use_binary else 'json'}")
+
+        gap = args.gap_ms / 1000
+        await bench.settle(1.0)
+        for scenario in args.scenarios.split(","):
+            print(f"[bench] 场景 {scenario}")
+            await getattr(bench, f"run_{scenario}")(args.repetitions, gap)
+
+        report.update({
+            "label": args.label,
+            "created": datetime.datetime.now().isoformat(timespec="seconds"),
+            "encoding": ENCODING_NAME if use_binary else "json",
+            "repetitions": args.repetitions,
+            "gap_ms": args.gap_ms,
+            "scenarios": {
+                scenario: {name: summarize(results) for name, results in commands.items()}
+                for scenario, commands in bench.samples.items()
+            },
+        })
+        await connection.close()
+        reader_task.cancel()
+        finished.set()
+
+    server = await asyncio.start_server(on_client, args.host, args.port)
+    print(f"[bench] 等待设备连接 ws://{args.host}:{args.port}/")
+    async with server:
+        await finished.wait()
+
+    with open(args.output, "w", encoding="utf-8") as file:
+        json.dump(report, file, ensure_ascii=False, indent=2)
+    baseline = None
+    if args.baseline:
+        with open(args.baseline, encoding="utf-8") as file:
+            baseline = json.load(file)
+    print_report(report, baseline)
+    print(f"[bench] 报告已写入 {args.output}")
+    if args.check:
+        problems = check_report(report)
+        for problem in problems:
+            print(f"[bench] 检查失败 {problem}")
+        return 1 if problems else 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(asyncio.run(main()))
@@ -0,0 +1,147 @@
+"""把固件串口输出中的二进制日志记录还原为文本
+
+记录格式见astrbot_plugin_esp32/src/binary_log.h，消息目录取自log_messages.h；
+记录之间的普通串口文本（启动信息等）原样输出。只依赖标准库，串口读取需要pyserial：
+    python tools/log_decode.py capture.bin
+    python tools/log_decode.py --port /dev/ttyUSB0 --baud 9600
+    build/host/esp32_sim | python tools/log_decode.py
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+CATALOG = os.path.join(os.path.dirname(__file__), "..", "astrbot_plugin_esp32", "src", "log_messages.h")
+MAGIC = 0x1E
+HEADER = struct.Struct("<IH")  # 毫秒时间戳、消息编号
+RECORD_MAX = 64
+
+
+def load_catalog(path):
+    with open(path, encoding="utf-8") as file:
+        text = file.read()
+    entries = re.findall(r'X\(\s*(\w+)\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', text)
+    return [(name, level, fmt) for name, level, fmt in entries]
+
+
+def decode_args(fmt, payload):
+    """按格式串中的%d/%u/%s依次取出参数，返回渲染后的文本"""
+    out = []
+    offset = 0
+    i = 0
+    while i < len(fmt):
+        c = fmt[i]
+        if c != "%" or i + 1 >= len(fmt):
+            out.append(c)
+            i += 1
+            continue
+        spec = fmt[i + 1]
+        i += 2
+        if spec == "%":
+            out.append("%")
+        elif spec in "du":
+            if offset + 4 > len(payload):
+                out.append("?")
+                continue
+            (value,) = struct.unpack_from("<i" if spec == "d" else "<I", payload, offset)
+            offset += 4
+            out.append(str(value))
+        elif spec == "s":
+            if offset + 1 > len(payload):
+                out.append("?")
+                continue
+            length = payload[offset]
+            out.append(payload[offset + 1:offset + 1 + length].decode("utf-8", errors="replace"))
+            offset += 1 + length
+        else:
+            out.append("%" + spec)
+    return "".join(out)
+
+
+class Decoder:
+    def __init__(self, catalog, output):
+        self.catalog = catalog
+        self.output = output
+        self.buffer = bytearray()
+        self.text = bytearray()
+
+    def feed(self, data: bytes):
+        self.buffer += data
+        while self.buffer:
+            start = self.buffer.find(MAGIC)
+            if start < 0:
+                self.emit_text(self.buffer)
+                self.buffer.clear()
+                return
+            if start > 0:
+                self.emit_text(self.buffer[:start])
+                del self.buffer[:start]
+            if len(self.buffer) < 2:
+                return
+            length = self.buffer[1]
+            if length < HEADER.size or length + 3 > RECORD_MAX:
+                # 不是合法的记录头，把魔数当作普通字节
+                self.emit_text(self.buffer[:1])
+                del self.buffer[:1]
+                continue
+            if len(self.buffer) < length + 3:
+                return
+            body = bytes(self.buffer[2:2 + length])
+            checksum = 0
+            for byte in body:
+                checksum ^= byte
+            if checksum != self.buffer[2 + length]:
+                self.emit_text(self.buffer[:1])
+                del self.buffer[:1]
+                continue
+            del self.buffer[:length + 3]
+            self.emit_record(body)
+
+    def emit_text(self, data):
+        self.text += data
+        while b"\n" in self.text:
+            line, _, rest = bytes(self.text).partition(b"\n")
+            self.text = bytearray(rest)
+            line = line.rstrip(b"\r")
+            if line:
+                self.output.write(line.decode("utf-8", errors="replace") + "\n")
+
+    def emit_record(self, body):
+        timestamp, number = HEADER.unpack_from(body)
+        payload = body[HEADER.size:]
+        if number < len(self.catalog):
+            name, level, fmt = self.catalog[number]
+            message = decode_args(fmt, payload)
+        else:
+            level, message = "?", f"未知消息编号{number}（固件与log_messages.h版本不一致） {payload.hex()}"
+        self.output.write(f"[{timestamp / 1000:10.3f}] {level:<5} {message}\n")
+        self.output.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?", help="串口输出的原始字节文件，默认读取标准输入")
+    parser.add_argument("--port", help="直接从串口读取（需要pyserial）")
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--catalog", default=CATALOG, help="log_messages.h的路径")
+    args = parser.parse_args()
+
+    decoder = Decoder(load_catalog(args.catalog), sys.stdout)
+    if args.port:
+        import serial
+        with serial.Serial(args.port, args.baud) as port:
+            while True:
+                decoder.feed(port.read(port.in_waiting or 1))
+    source = open(args.input, "rb") if args.input else sys.stdin.buffer
+    with source:
+        while True:
+            data = source.read1(4096) if hasattr(source, "read1") else source.read(4096)
+            if not data:
+                break
+            decoder.feed(data)
+    decoder.emit_text(b"\n")
+
+
+if __name__ == "__main__":
+    main()
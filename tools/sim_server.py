@@ -0,0 +1,178 @@
+"""主机仿真用的本地WebSocket服务器：按脚本向设备发送命令，并打印设备发回的消息
+
+只依赖标准库，配合 tools/build_host.sh 编译出的主机仿真程序使用：
+    python tools/sim_server.py --script commands.txt --encoding bin1
+    ESP32_SIM_TRACE=trace.csv build/host/esp32_sim
+
+脚本每行一个JSON命令（格式与adapter/main.py下发的一致），空行和#开头的行忽略；
+{"sleep_ms": N} 表示等待N毫秒再发送下一条。不指定--script时从标准输入逐行读取。
+--encoding bin1 时，对设备声明支持bin1且可以编码的命令改发二进制帧。
+"""
+import argparse
+import asyncio
+import base64
+import hashlib
+import json
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "adapter"))
+from binary_protocol import ENCODING_NAME, encode_command  # noqa: E402
+
+GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+
+class Connection:
+    def __init__(self, reader, writer):
+        self.reader = reader
+        self.writer = writer
+        self.encodings = {"json"}
+        self.connected = asyncio.Event()
+
+    async def handshake(self):
+        request = await self.reader.readuntil(b"\r\n\r\n")
+        key = None
+        for line in request.decode("latin-1").split("\r\n"):
+            name, _, value = line.partition(":")
+            if name.strip().lower() == "sec-websocket-key":
+                key = value.strip()
+        if not key:
+            raise ConnectionError("缺少Sec-WebSocket-Key")
+        accept = base64.b64encode(hashlib.sha1((key + GUID).encode()).digest()).decode()
+        self.writer.write(
+            "HTTP/1.1 101 Switching Protocols\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            f"Sec-WebSocket-Accept: {accept}\r\n\r\n".encode()
+        )
+        await self.writer.drain()
+
+    async def send(self, payload: bytes, binary: bool):
+        opcode = 0x2 if binary else 0x1
+        length = len(payload)
+        if length < 126:
+            header = struct.pack("!BB", 0x80 | opcode, length)
+        elif length <= 0xFFFF:
+            header = struct.pack("!BBH", 0x80 | opcode, 126, length)
+        else:
+            header = struct.pack("!BBQ", 0x80 | opcode, 127, length)
+        self.writer.write(header + payload)
+        await self.writer.drain()
+
+    async def receive(self):
+        """返回 (opcode, payload)，连接关闭时返回 (None, b"")"""
+        try:
+            first, second = await self.reader.readexactly(2)
+            length = second & 0x7F
+            if length == 126:
+                (length,) = struct.unpack("!H", await self.reader.readexactly(2))
+            elif length == 127:
+                (length,) = struct.unpack("!Q", await self.reader.readexactly(8))
+            mask = await self.reader.readexactly(4) if second & 0x80 else b"\0\0\0\0"
+            data = await self.reader.readexactly(length)
+        except (asyncio.IncompleteReadError, ConnectionError):
+            return None, b""
+        return first & 0x0F, bytes(b ^ mask[i & 3] for i, b in enumerate(data))
+
+    async def close(self):
+        try:
+            self.writer.write(struct.pack("!BBH", 0x88, 2, 1000))
+            await self.writer.drain()
+        except ConnectionError:
+            pass
+        self.writer.close()
+
+
+async def read_device(connection: Connection):
+    while True:
+        opcode, payload = await connection.receive()
+        if opcode is None or opcode == 0x8:
+            print("[server] 设备断开")
+            return
+        if opcode == 0x9:
+            continue
+        text = payload.decode("utf-8", errors="replace")
+        print(f"[device] {text}")
+        try:
+            message = json.loads(text)
+        except ValueError:
+            continue
+        if message.get("type") == "status" and message.get("status") == "connected":
+            connection.encodings = set(message.get("encodings", ["json"]))
+            connection.connected.set()
+
+
+async def script_lines(path):
+    if path:
+        with open(path, encoding="utf-8") as file:
+            for line in file:
+                yield line
+        return
+    loop = asyncio.get_running_loop()
+    while True:
+        line = await loop.run_in_executor(None, sys.stdin.readline)
+        if not line:
+            return
+        yield line
+
+
+async def run_script(connection: Connection, args):
+    await connection.connected.wait()
+    use_binary = args.encoding == ENCODING_NAME and ENCODING_NAME in connection.encodings
+    async for line in script_lines(args.script):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        command = json.loads(line)
+        if "sleep_ms" in command:
+            await asyncio.sleep(command["sleep_ms"] / 1000)
+            continue
+        frame = encode_command(command) if use_binary else None
+        if frame is not None:
+            await connection.send(frame, binary=True)
+            print(f"[server] -> bin1 {len(frame)}字节 {line}")
+        else:
+            await connection.send(json.dumps(command, ensure_ascii=False).encode("utf-8"), binary=False)
+            print(f"[server] -> json {line}")
+    await asyncio.sleep(args.linger_ms / 1000)
+
+
+async def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8765)
+    parser.add_argument("--script", help="命令脚本文件，默认从标准输入读取")
+    parser.add_argument("--encoding", choices=["json", ENCODING_NAME], default="json")
+    parser.add_argument("--linger-ms", type=int, default=1000, help="脚本发送完后保持连接的时间")
+    args = parser.parse_args()
+
+    done = asyncio.Event()
+
+    async def on_client(reader, writer):
+        connection = Connection(reader, writer)
+        try:
+            await connection.handshake()
+        except (asyncio.IncompleteReadError, ConnectionError) as error:
+            print(f"[server] 握手失败: {error}")
+            writer.close()
+            return
+        print("[server] 设备已连接")
+        reader_task = asyncio.create_task(read_device(connection))
+        script_task = asyncio.create_task(run_script(connection, args))
+        finished, _ = await asyncio.wait({reader_task, script_task}, return_when=asyncio.FIRST_COMPLETED)
+        if script_task in finished:
+            await connection.close()
+            reader_task.cancel()
+            done.set()
+        else:
+            script_task.cancel()
+
+    server = await asyncio.start_server(on_client, args.host, args.port)
+    print(f"[server] 监听 ws://{args.host}:{args.port}/")
+    async with server:
+        await done.wait()
+
+
+if __name__ == "__main__":
+    asyncio.run(main())